@@ -0,0 +1,129 @@
+// Gingoduino - PitchToMonitor Example
+// Reads a guitar or voice from an I2S ADC, detects the played notes with
+// GingoPitch and feeds them to a GingoMonitor, the same way MIDI input
+// would. Prints each note with its cents deviation and the detected chord
+// and field. Requires Tier 3 (ESP32).
+//
+// Hardware: a 16-bit stereo I2S ADC or codec (PCM1808, WM8960, ...) with
+// the instrument on the left channel.
+//   BCK -> GPIO 11, WS (LRCK) -> GPIO 13, ADC DOUT -> GPIO 10
+//
+// SPDX-License-Identifier: MIT
+
+#include <Gingoduino.h>
+
+#if !GINGODUINO_HAS_PITCH
+  #error "PitchToMonitor requires Tier 3 (define GINGODUINO_TIER >= 3)"
+#endif
+
+#if ESP_ARDUINO_VERSION_MAJOR >= 3
+#include <driver/i2s_std.h>
+#else
+#include <driver/i2s.h>
+#endif
+
+#ifndef I2S_BCK_PIN
+#define I2S_BCK_PIN      11
+#endif
+#ifndef I2S_WS_PIN
+#define I2S_WS_PIN       13
+#endif
+#ifndef I2S_DATA_IN_PIN
+#define I2S_DATA_IN_PIN  10
+#endif
+
+using namespace gingoduino;
+
+static const uint32_t SAMPLE_RATE = 48000;
+static const uint16_t FRAMES      = 256;
+
+static GingoPitch   pitch(SAMPLE_RATE);
+static GingoMonitor monitor;
+static int16_t      pcm[FRAMES * 2];     // stereo, interleaved
+
+#if ESP_ARDUINO_VERSION_MAJOR >= 3
+static i2s_chan_handle_t rx = nullptr;
+#endif
+
+static void beginI2S() {
+#if ESP_ARDUINO_VERSION_MAJOR >= 3
+    // New I2S driver (ESP-IDF 5.x)
+    i2s_chan_config_t chan_cfg = I2S_CHANNEL_DEFAULT_CONFIG(I2S_NUM_0, I2S_ROLE_MASTER);
+    chan_cfg.dma_desc_num  = 4;
+    chan_cfg.dma_frame_num = FRAMES;
+    i2s_new_channel(&chan_cfg, nullptr, &rx);
+
+    i2s_std_config_t std_cfg = {};
+    std_cfg.clk_cfg  = I2S_STD_CLK_DEFAULT_CONFIG(SAMPLE_RATE);
+    std_cfg.slot_cfg = I2S_STD_PHILIPS_SLOT_DEFAULT_CONFIG(I2S_DATA_BIT_WIDTH_16BIT, I2S_SLOT_MODE_STEREO);
+    std_cfg.gpio_cfg.mclk = I2S_GPIO_UNUSED;
+    std_cfg.gpio_cfg.bclk = (gpio_num_t)I2S_BCK_PIN;
+    std_cfg.gpio_cfg.ws   = (gpio_num_t)I2S_WS_PIN;
+    std_cfg.gpio_cfg.dout = I2S_GPIO_UNUSED;
+    std_cfg.gpio_cfg.din  = (gpio_num_t)I2S_DATA_IN_PIN;
+    i2s_channel_init_std_mode(rx, &std_cfg);
+    i2s_channel_enable(rx);
+#else
+    // Legacy I2S driver (ESP-IDF 4.x)
+    i2s_config_t cfg = {};
+    cfg.mode                 = (i2s_mode_t)(I2S_MODE_MASTER | I2S_MODE_RX);
+    cfg.sample_rate          = SAMPLE_RATE;
+    cfg.bits_per_sample      = I2S_BITS_PER_SAMPLE_16BIT;
+    cfg.channel_format       = I2S_CHANNEL_FMT_RIGHT_LEFT;
+    cfg.communication_format = I2S_COMM_FORMAT_STAND_I2S;
+    cfg.intr_alloc_flags     = ESP_INTR_FLAG_LEVEL1;
+    cfg.dma_buf_count        = 4;
+    cfg.dma_buf_len          = FRAMES;
+    cfg.use_apll             = false;
+    i2s_driver_install(I2S_NUM_0, &cfg, 0, nullptr);
+
+    i2s_pin_config_t pins = {};
+    pins.bck_io_num   = I2S_BCK_PIN;
+    pins.ws_io_num    = I2S_WS_PIN;
+    pins.data_out_num = I2S_PIN_NO_CHANGE;
+    pins.data_in_num  = I2S_DATA_IN_PIN;
+    i2s_set_pin(I2S_NUM_0, &pins);
+#endif
+}
+
+static size_t readI2S(int16_t* buf, size_t bytes) {
+    size_t got = 0;
+#if ESP_ARDUINO_VERSION_MAJOR >= 3
+    i2s_channel_read(rx, buf, bytes, &got, portMAX_DELAY);
+#else
+    i2s_read(I2S_NUM_0, buf, bytes, &got, portMAX_DELAY);
+#endif
+    return got;
+}
+
+void setup() {
+    Serial.begin(115200);
+    delay(500);
+    Serial.println(F("=== Gingoduino: Pitch to Monitor ===\n"));
+
+    pitch.setRange(70.0f, 1200.0f);      // guitar: low E to the top frets
+    pitch.setMonitor(&monitor);
+    pitch.onPitch([](const GingoPitchEvent& e) {
+        if (e.type != PITCH_NOTE_ON) return;
+        Serial.print(GingoNote::fromMIDI(e.midiNum).name());
+        Serial.print(GingoNote::octaveFromMIDI(e.midiNum));
+        Serial.print(e.cents >= 0 ? F(" +") : F(" "));
+        Serial.print(e.cents);
+        Serial.println(F(" cents"));
+    });
+    monitor.onChordDetected([](const GingoChord& c) {
+        Serial.print(F("  chord: "));
+        Serial.println(c.name());
+    });
+    monitor.onFieldChanged([](const GingoField& f) {
+        Serial.print(F("  field: "));
+        Serial.println(f.tonic().name());
+    });
+
+    beginI2S();
+}
+
+void loop() {
+    const size_t got = readI2S(pcm, sizeof(pcm));
+    pitch.process(pcm, (uint16_t)(got / (2 * sizeof(int16_t))), 2);   // left channel
+}
@@ -0,0 +1,132 @@
+// Gingoduino - SequenceSynth Example
+// Plays a GingoSequence through GingoSynth to an I2S DAC (PCM5102A or
+// similar), looping. The same player renders WAV files on the host
+// (extras/tools/render_wav.cpp); here the blocks go to the I2S DMA.
+// Requires Tier 3 (ESP32).
+//
+// Wiring (T-Display-S3 MIDI Shield defaults, override before building):
+//   BCK -> GPIO 11, WS (LRCK) -> GPIO 13, DIN -> GPIO 12
+//
+// SPDX-License-Identifier: MIT
+
+#include <Gingoduino.h>
+
+#if !GINGODUINO_HAS_SYNTH
+  #error "SequenceSynth requires Tier 3 (define GINGODUINO_TIER >= 3)"
+#endif
+
+#if ESP_ARDUINO_VERSION_MAJOR >= 3
+#include <driver/i2s_std.h>
+#else
+#include <driver/i2s.h>
+#endif
+
+#ifndef I2S_BCK_PIN
+#define I2S_BCK_PIN       11
+#endif
+#ifndef I2S_WS_PIN
+#define I2S_WS_PIN        13
+#endif
+#ifndef I2S_DATA_OUT_PIN
+#define I2S_DATA_OUT_PIN  12
+#endif
+
+using namespace gingoduino;
+
+static const uint32_t SAMPLE_RATE = 44100;
+static const uint16_t FRAMES      = 256;     // frames per DMA buffer
+
+static GingoSequence       seq(GingoTempo(100), GingoTimeSig(4, 4));
+static GingoSynth          synth(SAMPLE_RATE);
+static GingoSequencePlayer player(seq, synth);
+static int16_t             pcm[FRAMES * 2];  // stereo, interleaved
+
+#if ESP_ARDUINO_VERSION_MAJOR >= 3
+static i2s_chan_handle_t tx = nullptr;
+#endif
+
+static void beginI2S() {
+#if ESP_ARDUINO_VERSION_MAJOR >= 3
+    // New I2S driver (ESP-IDF 5.x)
+    i2s_chan_config_t chan_cfg = I2S_CHANNEL_DEFAULT_CONFIG(I2S_NUM_0, I2S_ROLE_MASTER);
+    chan_cfg.dma_desc_num  = 8;
+    chan_cfg.dma_frame_num = FRAMES;
+    i2s_new_channel(&chan_cfg, &tx, nullptr);
+
+    i2s_std_config_t std_cfg = {};
+    std_cfg.clk_cfg  = I2S_STD_CLK_DEFAULT_CONFIG(SAMPLE_RATE);
+    std_cfg.slot_cfg = I2S_STD_PHILIPS_SLOT_DEFAULT_CONFIG(I2S_DATA_BIT_WIDTH_16BIT, I2S_SLOT_MODE_STEREO);
+    std_cfg.gpio_cfg.mclk = I2S_GPIO_UNUSED;
+    std_cfg.gpio_cfg.bclk = (gpio_num_t)I2S_BCK_PIN;
+    std_cfg.gpio_cfg.ws   = (gpio_num_t)I2S_WS_PIN;
+    std_cfg.gpio_cfg.dout = (gpio_num_t)I2S_DATA_OUT_PIN;
+    std_cfg.gpio_cfg.din  = I2S_GPIO_UNUSED;
+    i2s_channel_init_std_mode(tx, &std_cfg);
+    i2s_channel_enable(tx);
+#else
+    // Legacy I2S driver (ESP-IDF 4.x)
+    i2s_config_t cfg = {};
+    cfg.mode                 = (i2s_mode_t)(I2S_MODE_MASTER | I2S_MODE_TX);
+    cfg.sample_rate          = SAMPLE_RATE;
+    cfg.bits_per_sample      = I2S_BITS_PER_SAMPLE_16BIT;
+    cfg.channel_format       = I2S_CHANNEL_FMT_RIGHT_LEFT;
+    cfg.communication_format = I2S_COMM_FORMAT_STAND_I2S;
+    cfg.intr_alloc_flags     = ESP_INTR_FLAG_LEVEL1;
+    cfg.dma_buf_count        = 8;
+    cfg.dma_buf_len          = FRAMES;
+    cfg.use_apll             = false;
+    cfg.tx_desc_auto_clear   = true;
+    i2s_driver_install(I2S_NUM_0, &cfg, 0, nullptr);
+
+    i2s_pin_config_t pins = {};
+    pins.bck_io_num   = I2S_BCK_PIN;
+    pins.ws_io_num    = I2S_WS_PIN;
+    pins.data_out_num = I2S_DATA_OUT_PIN;
+    pins.data_in_num  = I2S_PIN_NO_CHANGE;
+    i2s_set_pin(I2S_NUM_0, &pins);
+    i2s_zero_dma_buffer(I2S_NUM_0);
+#endif
+}
+
+static void writeI2S(const int16_t* buf, size_t bytes) {
+    size_t written = 0;
+#if ESP_ARDUINO_VERSION_MAJOR >= 3
+    i2s_channel_write(tx, buf, bytes, &written, portMAX_DELAY);
+#else
+    i2s_write(I2S_NUM_0, buf, bytes, &written, portMAX_DELAY);
+#endif
+}
+
+void setup() {
+    Serial.begin(115200);
+    delay(500);
+    Serial.println(F("=== Gingoduino: Sequence Synth ===\n"));
+
+    // ii-V-I in C with a melody note on top
+    seq.add(GingoEvent::chordEvent(GingoChord("Dm7"), GingoDuration("whole"), 3));
+    seq.add(GingoEvent::chordEvent(GingoChord("G7"),  GingoDuration("whole"), 3));
+    seq.add(GingoEvent::chordEvent(GingoChord("C7M"), GingoDuration("half"),  3));
+    seq.add(GingoEvent::noteEvent(GingoNote("E"),     GingoDuration("half"),  5));
+    seq.add(GingoEvent::rest(GingoDuration("whole")));
+
+    synth.setWaveform(WAVE_TRIANGLE);
+    GingoEnvelope env = { 0.01f, 0.3f, 0.6f, 0.4f };
+    synth.setEnvelope(env);
+    player.rewind();
+
+    beginI2S();
+
+    Serial.print(F("Loop length: "));
+    Serial.print(player.totalFrames() / (float)SAMPLE_RATE, 2);
+    Serial.println(F(" s"));
+}
+
+void loop() {
+    // The DMA write blocks until a buffer is free, so this paces itself
+    uint16_t n = player.render(pcm, FRAMES, 2);
+    if (n < FRAMES) {
+        memset(pcm + n * 2, 0, (FRAMES - n) * 2 * sizeof(int16_t));
+        player.rewind();
+    }
+    writeI2S(pcm, sizeof(pcm));
+}
@@ -3,8 +3,9 @@
 
 // ── Simple polyphonic I2S synthesizer for ESP32-S3 ────────────────────────────
 // Hardware: PCM5102A DAC connected via I2S (I2S_BCK_PIN, I2S_WS_PIN, I2S_DATA_OUT_PIN)
-// Waveform: sine wave via lookup table (fast, no floating-point sin per sample)
-// Polyphony: up to 8 voices
+// Voices:    GingoSynth (fixed-point wavetable engine, block-based, voice stealing)
+// Waveform:  sine
+// Polyphony: GINGODUINO_SYNTH_VOICES (8 by default)
 // Release:   ~150 ms fade-out on NoteOff (prevents clicks)
 // Thread safety: FreeRTOS queue - noteOn/noteOff are safe from any task
 
@@ -14,8 +15,7 @@
 #else
 #include <driver/i2s.h>
 #endif
-#include <cmath>
-#include <cstring>
+#include <Gingoduino.h>
 #include "mapping.h"
 
 #if ESP_ARDUINO_VERSION_MAJOR < 3
@@ -23,13 +23,14 @@ static const i2s_port_t SYNTH_PORT     = I2S_NUM_0;
 #endif
 static const int        SYNTH_SR       = 44100;
 static const int        SYNTH_BUF      = 256;    // samples per DMA buffer
-static const int        SYNTH_VOICES   = 8;
-static const int        SYNTH_SIN_LEN  = 512;
 
 class SynthEngine {
 public:
     void begin() {
-        _buildSinTable();
+        // Organ-like: instant attack, full sustain, 150 ms release
+        gingoduino::GingoEnvelope env = { 0.0f, 0.0f, 1.0f, 0.15f };
+        _engine.setEnvelope(env);
+        _engine.setGain(0.6f);
 
 #if ESP_ARDUINO_VERSION_MAJOR >= 3
         // New I2S driver (ESP-IDF 5.x)
@@ -72,7 +73,6 @@ public:
         i2s_zero_dma_buffer(SYNTH_PORT);
 #endif
 
-        memset(_voices, 0, sizeof(_voices));
         _queue = xQueueCreate(64, sizeof(NoteMsg));
 
         // Pin audio task to core 1 (same as loop, OK - FreeRTOS time-slices)
@@ -91,64 +91,14 @@ public:
     }
 
 private:
-    struct Voice {
-        float   phase;
-        float   inc;
-        float   amp;
-        float   release;   // per-sample decrement (0 = sustain)
-        uint8_t note;
-        bool    active;
-    };
     struct NoteMsg { uint8_t note; uint8_t vel; };
 
-    Voice            _voices[SYNTH_VOICES];
-    float            _sinTable[SYNTH_SIN_LEN];
+    gingoduino::GingoSynth _engine{SYNTH_SR};
     QueueHandle_t    _queue;
 #if ESP_ARDUINO_VERSION_MAJOR >= 3
     i2s_chan_handle_t _tx_handle = nullptr;
 #endif
 
-    void _buildSinTable() {
-        for (int i = 0; i < SYNTH_SIN_LEN; i++)
-            _sinTable[i] = sinf(2.0f * M_PI * i / SYNTH_SIN_LEN);
-    }
-
-    static float _freq(uint8_t note) {
-        return 440.0f * powf(2.0f, (note - 69) / 12.0f);
-    }
-
-    void _activateVoice(uint8_t note, uint8_t vel) {
-        // Retrigger same note if already active
-        for (int i = 0; i < SYNTH_VOICES; i++) {
-            if (_voices[i].active && _voices[i].note == note) {
-                _voices[i].amp     = (vel / 127.0f) * 0.7f;
-                _voices[i].release = 0.0f;
-                return;
-            }
-        }
-        // Find free voice, or steal the softest
-        int vi = -1;
-        float minAmp = 999.0f;
-        for (int i = 0; i < SYNTH_VOICES; i++) {
-            if (!_voices[i].active) { vi = i; break; }
-            if (_voices[i].amp < minAmp) { minAmp = _voices[i].amp; vi = i; }
-        }
-        if (vi < 0) return;
-        _voices[vi].note    = note;
-        _voices[vi].phase   = 0.0f;
-        _voices[vi].inc     = _freq(note) / SYNTH_SR;
-        _voices[vi].amp     = (vel / 127.0f) * 0.7f;
-        _voices[vi].release = 0.0f;
-        _voices[vi].active  = true;
-    }
-
-    void _fadeVoice(uint8_t note) {
-        for (int i = 0; i < SYNTH_VOICES; i++) {
-            if (_voices[i].active && _voices[i].note == note && _voices[i].release == 0.0f)
-                _voices[i].release = _voices[i].amp / (SYNTH_SR * 0.15f);  // 150 ms
-        }
-    }
-
     static void _task(void* arg) {
         SynthEngine* s = (SynthEngine*)arg;
         static int16_t buf[SYNTH_BUF * 2];
@@ -157,33 +107,12 @@ private:
         while (true) {
             // Process pending note events
             while (xQueueReceive(s->_queue, &msg, 0) == pdTRUE) {
-                if (msg.vel) s->_activateVoice(msg.note, msg.vel);
-                else         s->_fadeVoice(msg.note);
+                if (msg.vel) s->_engine.noteOn(msg.note, msg.vel);
+                else         s->_engine.noteOff(msg.note);
             }
 
-            // Generate audio buffer
-            for (int i = 0; i < SYNTH_BUF; i++) {
-                float sample = 0.0f;
-                for (int v = 0; v < SYNTH_VOICES; v++) {
-                    if (!s->_voices[v].active) continue;
-                    int ti = (int)(s->_voices[v].phase * SYNTH_SIN_LEN) & (SYNTH_SIN_LEN - 1);
-                    sample += s->_voices[v].amp * s->_sinTable[ti];
-                    s->_voices[v].phase += s->_voices[v].inc;
-                    if (s->_voices[v].phase >= 1.0f) s->_voices[v].phase -= 1.0f;
-                    if (s->_voices[v].release > 0.0f) {
-                        s->_voices[v].amp -= s->_voices[v].release;
-                        if (s->_voices[v].amp <= 0.0f) {
-                            s->_voices[v].amp    = 0.0f;
-                            s->_voices[v].active = false;
-                        }
-                    }
-                }
-                if (sample >  0.95f) sample =  0.95f;
-                if (sample < -0.95f) sample = -0.95f;
-                int16_t s16 = (int16_t)(sample * 28000.0f);
-                buf[i*2]   = s16;
-                buf[i*2+1] = s16;
-            }
+            // Generate audio buffer (stereo, interleaved)
+            s->_engine.render(buf, SYNTH_BUF, 2);
 
             size_t bw;
 #if ESP_ARDUINO_VERSION_MAJOR >= 3
@@ -0,0 +1,864 @@
+// Native benchmark - host timings and memory figures for gingoduino.
+// No Arduino framework needed; gingoduino_config.h provides PROGMEM stubs.
+//
+// Build (from repo root):
+//   g++ -std=c++11 -O2 -DGINGODUINO_TIER=3 -I. -o extras/bench/bench_native extras/bench/bench_native.cpp
+//
+// Usage:
+//   bench_native                          human-readable report
+//   bench_native --json out.json          also write the hot-path results
+//   bench_native --baseline base.json     compare against a stored run;
+//                [--tolerance 50]         exit 1 if any path is slower by
+//                                         more than the tolerance (percent)
+//   bench_native --repeats 9              hot-path passes; each path reports
+//                                         the median pass (default 5)
+//
+// Timings on a shared or frequency-scaling host move by 20-50% between
+// runs even after the median, so the default tolerance only catches gross
+// regressions; on a quiet machine with a pinned clock use --tolerance 10.
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include "src/Gingoduino.h"
+#include "src/gingoduino_progmem.h"
+
+// Pull in all .cpp files for a single-file build (the CMake targets
+// define GINGODUINO_LINKED and link the gingoduino library instead)
+#ifndef GINGODUINO_LINKED
+#include "src/GingoNote.cpp"
+#include "src/GingoInterval.cpp"
+#include "src/GingoChord.cpp"
+#include "src/GingoScale.cpp"
+#include "src/GingoField.cpp"
+#include "src/GingoDuration.cpp"
+#include "src/GingoTempo.cpp"
+#include "src/GingoTimeSig.cpp"
+#include "src/GingoEvent.cpp"
+#include "src/GingoSequence.cpp"
+#include "src/GingoFretboard.cpp"
+#include "src/GingoTree.cpp"
+#include "src/GingoProgression.cpp"
+#include "src/GingoMonitor.cpp"
+#include "src/GingoChordComparison.cpp"
+#include "src/GingoMIDI1.cpp"
+#include "src/GingoProfile.cpp"
+#include "src/GingoTuning.cpp"
+#include "src/GingoSynth.cpp"
+#include "src/GingoPitch.cpp"
+#include "src/GingoChroma.cpp"
+#include "src/GingoArpeggiator.cpp"
+#endif
+
+using namespace gingoduino;
+
+// Keeps results observable so the optimizer cannot drop the work.
+static volatile uint32_t sink = 0;
+
+/// Average microseconds per call of fn over iters calls.
+template <typename Fn>
+static double timeUs(uint32_t iters, Fn fn) {
+    auto t0 = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < iters; i++) fn();
+    auto t1 = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::micro>(t1 - t0).count() / iters;
+}
+
+// =====================================================================
+// Fretboard
+// =====================================================================
+
+static const char* const CHORDS[] = { "CM", "Am", "G7", "F7M", "Bm7(b5)", "E7(9)" };
+static const uint8_t NUM_CHORDS = sizeof(CHORDS) / sizeof(CHORDS[0]);
+
+static void benchFingeringMemory() {
+    printf("\n=== Fingering memory (MAX_STRINGS=%d) ===\n", GINGODUINO_MAX_STRINGS);
+    const unsigned full = (unsigned)sizeof(GingoFingering);
+    const unsigned packed = (unsigned)sizeof(GingoPackedFingering);
+    printf("  GingoFingering        %4u bytes\n", full);
+    printf("  GingoPackedFingering  %4u bytes  (%.1fx smaller)\n", packed, (double)full / packed);
+    printf("  16 results            %4u vs %u bytes\n", 16 * full, 16 * packed);
+}
+
+static void benchFingeringSearch() {
+    printf("\n=== Fingering search (top 8, us/call) ===\n");
+    GingoFretboard boards[] = {
+        GingoFretboard::guitar(),
+        GingoFretboard::bass5(),
+#if GINGODUINO_MAX_STRINGS >= 7
+        GingoFretboard::sevenString(),
+#endif
+#if GINGODUINO_MAX_STRINGS >= 8
+        GingoFretboard::eightString(),
+#endif
+    };
+    for (uint8_t b = 0; b < sizeof(boards) / sizeof(boards[0]); b++) {
+        const GingoFretboard& fb = boards[b];
+        GingoChord chords[NUM_CHORDS];
+        for (uint8_t c = 0; c < NUM_CHORDS; c++) chords[c] = GingoChord(CHORDS[c]);
+
+        GingoPackedFingering packed[8];
+        double usPacked = timeUs(50, [&]() {
+            for (uint8_t c = 0; c < NUM_CHORDS; c++) sink += fb.fingerings(chords[c], packed, 8);
+        }) / NUM_CHORDS;
+
+        GingoFingering full[8];
+        double usFull = timeUs(50, [&]() {
+            for (uint8_t c = 0; c < NUM_CHORDS; c++) sink += fb.fingerings(chords[c], full, 8);
+        }) / NUM_CHORDS;
+
+        printf("  %-12s %d strings  packed %8.1f  full %8.1f\n",
+               fb.name(), fb.numStrings(), usPacked, usFull);
+    }
+}
+
+static void benchShapeLibrary() {
+#if GINGODUINO_HAS_SHAPE_LIBRARY
+    printf("\n=== Position-0 shape (us/chord) ===\n");
+    GingoFretboard guitar = GingoFretboard::guitar();
+    GingoChord chords[NUM_CHORDS];
+    for (uint8_t c = 0; c < NUM_CHORDS; c++) chords[c] = GingoChord(CHORDS[c]);
+    GingoPackedFingering p;
+    double usTable = timeUs(2000, [&]() {
+        for (uint8_t c = 0; c < NUM_CHORDS; c++) sink += guitar.shape(chords[c], p);
+    }) / NUM_CHORDS;
+    GingoPackedFingering ranked[3];
+    double usRanked = timeUs(2000, [&]() {
+        for (uint8_t c = 0; c < NUM_CHORDS; c++) sink += guitar.shapes(chords[c], ranked, 3);
+    }) / NUM_CHORDS;
+    GingoPackedFingering window[1];
+    double usSearch = timeUs(200, [&]() {
+        for (uint8_t c = 0; c < NUM_CHORDS; c++) sink += guitar.fingerings(chords[c], window, 1);
+    }) / NUM_CHORDS;
+    printf("  table lookup %8.2f  ranked shapes %8.2f  full search %8.2f\n",
+           usTable, usRanked, usSearch);
+#endif
+}
+
+static void benchIdentify() {
+    printf("\n=== Fretboard identify (us/shape) ===\n");
+    GingoFretboard guitar = GingoFretboard::guitar();
+    static const uint8_t SHAPES[][6] = {
+        { 255, 3, 2, 0, 1, 0 }, { 255, 0, 2, 2, 1, 0 }, { 0, 3, 2, 0, 1, 0 },
+        { 3, 2, 0, 0, 0, 1 },   { 1, 3, 3, 2, 1, 1 },   { 255, 0, 2, 0, 1, 0 },
+    };
+    const uint8_t n = sizeof(SHAPES) / sizeof(SHAPES[0]);
+    char name[16];
+    double us = timeUs(2000, [&]() {
+        for (uint8_t i = 0; i < n; i++) sink += guitar.identify(SHAPES[i], 6, name, sizeof(name));
+    }) / n;
+    ChordMatch alts[4];
+    double usRanked = timeUs(2000, [&]() {
+        for (uint8_t i = 0; i < n; i++) sink += guitar.identify(SHAPES[i], 6, alts, 4);
+    }) / n;
+    printf("  best name %8.2f  top-4 ranked %8.2f\n", us, usRanked);
+}
+
+// =====================================================================
+// Chord comparison
+// =====================================================================
+
+/// One value from every flag group, so no requested field is dead code.
+static uint32_t comparisonDigest(const GingoChordComparison& c) {
+    return c.common_count + c.root_distance + c.common_interval_mask + c.subset +
+           (uint8_t)c.transposition + (uint8_t)c.voice_leading + c.transformation +
+           c.interval_vector_a[0] + c.interval_vector_b[0];
+}
+
+static void benchComparisonMatrix() {
+    printf("\n=== Chord comparison matrix (ns/pair) ===\n");
+    static const char* const FIELD[] = {
+        "CM", "Dm7", "Em7", "F7M", "G7", "Am7", "Bm7(b5)", "A7", "D7", "E7", "C7", "Fm6"
+    };
+    const uint8_t n = sizeof(FIELD) / sizeof(FIELD[0]);
+    GingoChord chords[n];
+    for (uint8_t i = 0; i < n; i++) chords[i] = GingoChord(FIELD[i]);
+
+    uint8_t all[CMP_DIM_COUNT];
+    for (uint8_t d = 0; d < CMP_DIM_COUNT; d++) all[d] = d;
+    static int8_t m[CMP_DIM_COUNT * 12 * 12];
+
+    const double pairs = (double)n * n;
+    double nsCompute = timeUs(200, [&]() {
+        for (uint8_t i = 0; i < n; i++)
+            for (uint8_t j = 0; j < n; j++)
+                sink += comparisonDigest(GingoChordComparison::compute(chords[i], chords[j]));
+    }) * 1000.0 / pairs;
+    double nsMatrix = timeUs(200, [&]() {
+        sink += GingoChordComparison::matrix(chords, n, all, CMP_DIM_COUNT, m);
+    }) * 1000.0 / pairs;
+    printf("  %d chords   compute() x N^2 %8.1f   matrix (13 dims) %8.1f\n", n, nsCompute, nsMatrix);
+
+    // Corpus-sized batch from precomputed profiles, one dimension at a time,
+    // against a dimension() call per pair
+    const uint16_t N = 1024;
+    static GingoChordProfile profiles[N];
+    static int8_t out[N * N];
+    static const char* const TYPES[] = { "M", "m", "7", "m7", "7M", "6", "m6", "dim7", "m7(b5)", "sus4" };
+    for (uint16_t i = 0; i < N; i++) {
+        char name[16];
+        data::readChromaticName((uint8_t)(i % 12), name, sizeof(name));
+        strcat(name, TYPES[(i / 12) % 10]);
+        profiles[i] = GingoChordComparison::profile(GingoChord(name));
+    }
+    static const char* const DIM_NAMES[CMP_DIM_COUNT] = {
+        "common_count", "root_distance", "root_direction", "same_quality",
+        "same_size", "common_intervals", "enharmonic", "subset", "inversion",
+        "transposition", "voice_leading", "transformation", "same_iv"
+    };
+    printf("  %d profiles, one plane (tile %d):\n", N, GINGODUINO_MATRIX_TILE);
+    printf("    %-18s %8s %8s\n", "dimension", "matrix", "per pair");
+    for (uint8_t d = 0; d < CMP_DIM_COUNT; d++) {
+        double ns = timeUs(4, [&]() {
+            GingoChordComparison::matrix(profiles, N, &all[d], 1, out);
+            sink += (uint8_t)out[N + 1];
+        }) * 1000.0 / ((double)N * N);
+        double nsPair = timeUs(2, [&]() {
+            for (uint16_t i = 0; i < N; i++)
+                for (uint16_t j = 0; j < N; j++)
+                    out[(uint32_t)i * N + j] = GingoChordComparison::dimension(profiles[i], profiles[j], d);
+            sink += (uint8_t)out[N + 1];
+        }) * 1000.0 / ((double)N * N);
+        printf("    %-18s %8.2f %8.2f\n", DIM_NAMES[d], ns, nsPair);
+    }
+}
+
+static void benchSelectiveCompare() {
+    printf("\n=== Selective compare (ns/pair) ===\n");
+    static const char* const NAMES[] = { "CM", "Am7", "G7", "F7M", "Bm7(b5)", "E7(9)", "Ebdim7", "Dsus4" };
+    const uint8_t n = sizeof(NAMES) / sizeof(NAMES[0]);
+    GingoChord chords[n];
+    GingoChordProfile profiles[n];
+    for (uint8_t i = 0; i < n; i++) {
+        chords[i] = GingoChord(NAMES[i]);
+        profiles[i] = GingoChordComparison::profile(chords[i]);
+    }
+    struct Group { const char* name; uint16_t flags; };
+    static const Group GROUPS[] = {
+        { "overlap",         CMP_F_OVERLAP },
+        { "root",            CMP_F_ROOT },
+        { "quality",         CMP_F_QUALITY },
+        { "set",             CMP_F_SET },
+        { "transposition",   CMP_F_TRANSPOSITION },
+        { "voice_leading",   CMP_F_VOICE_LEADING },
+        { "transformation",  CMP_F_TRANSFORMATION },
+        { "interval_vector", CMP_F_INTERVAL_VECTOR },
+        { "all",             CMP_F_ALL },
+    };
+    const double pairs = (double)n * n;
+    printf("  %-16s %10s %10s\n", "flags", "chords", "profiles");
+    for (uint8_t g = 0; g < sizeof(GROUPS) / sizeof(GROUPS[0]); g++) {
+        const uint16_t flags = GROUPS[g].flags;
+        double nsChord = timeUs(100, [&]() {
+            for (uint8_t i = 0; i < n; i++)
+                for (uint8_t j = 0; j < n; j++)
+                    sink += comparisonDigest(GingoChordComparison::compute(chords[i], chords[j], flags));
+        }) * 1000.0 / pairs;
+        double nsProfile = timeUs(2000, [&]() {
+            for (uint8_t i = 0; i < n; i++)
+                for (uint8_t j = 0; j < n; j++)
+                    sink += comparisonDigest(GingoChordComparison::compute(profiles[i], profiles[j], flags));
+        }) * 1000.0 / pairs;
+        printf("  %-16s %10.1f %10.1f\n", GROUPS[g].name, nsChord, nsProfile);
+    }
+}
+
+static void benchVoicingLeading() {
+    printf("\n=== Voicing voice leading (ns/call) ===\n");
+    static const uint8_t A[] = { 36, 48, 55, 60, 64, 67, 72, 76 };
+    static const uint8_t B[] = { 43, 50, 55, 59, 62, 65, 71, 74 };
+    VoiceMove moves[GINGODUINO_MAX_VOICES];
+    const uint8_t sizes[][2] = { { 3, 3 }, { 4, 4 }, { 3, 4 }, { 6, 4 }, { 8, 8 } };
+    for (uint8_t k = 0; k < sizeof(sizes) / sizeof(sizes[0]); k++) {
+        const uint8_t na = sizes[k][0], nb = sizes[k][1];
+        double ns = timeUs(20000, [&]() {
+            sink += (uint32_t)GingoChordComparison::voiceLeading(A, na, B, nb, moves, GINGODUINO_MAX_VOICES);
+        }) * 1000.0;
+        printf("  %d -> %d voices %8.1f\n", na, nb, ns);
+    }
+}
+
+static void benchSynthVoices() {
+    printf("\n=== Synth voices per core at 48 kHz ===\n");
+    static GingoSynth synth(48000);
+    static int16_t pcm[1024];
+    synth.setWaveform(WAVE_SAW);
+    const uint8_t counts[] = { 1, (uint8_t)(GingoSynth::VOICES / 2), GingoSynth::VOICES };
+    for (uint8_t k = 0; k < sizeof(counts) / sizeof(counts[0]); k++) {
+        synth.reset();
+        for (uint8_t v = 0; v < counts[k]; v++) synth.noteOn((uint8_t)(48 + 4 * v));
+        double nsFrame = timeUs(200, [&]() {
+            synth.render(pcm, 1024);
+            sink += (uint32_t)pcm[1023];
+        }) * 1000.0 / 1024;
+        double nsVoice = nsFrame / counts[k];
+        printf("  %2d voices %8.1f ns/frame %6.1f ns/voice-frame  %6.0f voices/core\n",
+               counts[k], nsFrame, nsVoice, (1e9 / 48000.0) / nsVoice);
+    }
+}
+
+static void benchPitch() {
+    printf("\n=== Pitch detection on synthesized signals (48 kHz) ===\n");
+    static const uint8_t NOTES[] = { 40, 45, 52, 57, 64, 69, 76, 84 };   // E2..C6
+    static const char* const WAVES[] = { "sine", "triangle", "saw", "square" };
+    const uint8_t N = sizeof(NOTES);
+    static GingoSynth synth(48000);
+    static GingoPitch pitch(48000);
+    static int16_t pcm[GingoPitch::HOP];
+    GingoEnvelope env = { 0.0f, 0.0f, 1.0f, 0.05f };
+    synth.setEnvelope(env);
+    printf("  %-9s %8s %12s %12s %14s\n", "wave", "found", "|cents| avg", "|cents| max", "latency ms avg/max");
+
+    for (uint8_t w = 0; w < 4; w++) {
+        synth.setWaveform((SynthWaveform)w);
+        uint8_t found = 0;
+        double centsSum = 0.0, centsMax = 0.0, latSum = 0.0, latMax = 0.0;
+        uint32_t centsCount = 0;
+        for (uint8_t k = 0; k < N; k++) {
+            synth.reset();
+            pitch.reset();
+            synth.noteOn(NOTES[k], 100);
+            const double freq = 440.0 * pow(2.0, (NOTES[k] - 69) / 12.0);
+            uint32_t onFrame = 0;
+            for (uint16_t h = 0; h < 48000 / GingoPitch::HOP / 2; h++) {   // 0.5 s
+                synth.render(pcm, GingoPitch::HOP);
+                pitch.process(pcm, GingoPitch::HOP);
+                if (!onFrame && pitch.note() == NOTES[k]) onFrame = pitch.frames();
+                if (onFrame && pitch.voiced() && pitch.frames() > onFrame + 4800) {
+                    const double c = fabs(1200.0 * log2(pitch.frequency() / freq));
+                    centsSum += c;
+                    if (c > centsMax) centsMax = c;
+                    centsCount++;
+                }
+            }
+            if (onFrame && pitch.note() == NOTES[k]) {
+                found++;
+                const double ms = onFrame * 1000.0 / 48000.0;
+                latSum += ms;
+                if (ms > latMax) latMax = ms;
+            }
+        }
+        printf("  %-9s %5d/%-2d %12.3f %12.3f %8.1f / %.1f\n", WAVES[w], found, N,
+               centsCount ? centsSum / centsCount : 0.0, centsMax,
+               found ? latSum / found : 0.0, latMax);
+    }
+
+    // Throughput on a held A3
+    synth.setWaveform(WAVE_SAW);
+    synth.reset();
+    pitch.reset();
+    synth.noteOn(57, 100);
+    static int16_t block[1024];
+    synth.render(block, 1024);
+    double nsSample = timeUs(50, [&]() {
+        pitch.process(block, 1024);
+        sink += pitch.note();
+    }) * 1000.0 / 1024;
+    printf("  %.1f ns/sample, %.1f%% of one core at 48 kHz (window %d, lags to %d, hop %d)\n",
+           nsSample, nsSample * 48000.0 / 1e7, GingoPitch::WINDOW, (int)(48000 / pitch.minFrequency()),
+           GingoPitch::HOP);
+}
+
+static void benchChroma() {
+    printf("\n=== Chord detection from audio (48 kHz) ===\n");
+    // Root-position voicings from C3, octave doubled: M, m, 7, m7, 7M
+    static const uint8_t FORMULAS[] = { 0, 5, 10, 6, 1 };
+    static const uint8_t VOICING[][4] = {
+        { 0, 4, 7, 12 }, { 0, 3, 7, 12 }, { 0, 4, 7, 10 }, { 0, 3, 7, 10 }, { 0, 4, 7, 11 }
+    };
+    static const char* const WAVES[] = { "sine", "triangle", "saw", "square" };
+    static GingoSynth synth(48000);
+    static GingoChroma chroma(48000);
+    static int16_t pcm[256];
+    GingoEnvelope env = { 0.0f, 0.0f, 1.0f, 0.05f };
+    synth.setEnvelope(env);
+    printf("  %-9s %8s %14s\n", "wave", "correct", "latency ms avg");
+
+    for (uint8_t w = 0; w < 4; w++) {
+        synth.setWaveform((SynthWaveform)w);
+        uint8_t correct = 0, total = 0;
+        double latSum = 0.0;
+        for (uint8_t q = 0; q < sizeof(FORMULAS); q++) {
+            for (uint8_t root = 0; root < 12; root++) {
+                char want[20];
+                data::readChromaticName(root, want, 4);
+                const uint8_t len = (uint8_t)strlen(want);
+                data::readCanonicalChordType(FORMULAS[q], want + len, (uint8_t)(sizeof(want) - len));
+                synth.reset();
+                chroma.reset();
+                for (uint8_t v = 0; v < 4; v++) synth.noteOn((uint8_t)(48 + root + VOICING[q][v]), 100);
+                uint32_t onFrame = 0, frame = 0;
+                for (uint16_t b = 0; b < 48000 / 256 / 2; b++) {   // 0.5 s
+                    synth.render(pcm, 256);
+                    chroma.process(pcm, 256);
+                    frame += 256;
+                    const bool hit = chroma.hasChord() && strcmp(chroma.currentChord().name(), want) == 0;
+                    if (hit && !onFrame) onFrame = frame;
+                }
+                total++;
+                if (chroma.hasChord() && strcmp(chroma.currentChord().name(), want) == 0) {
+                    correct++;
+                    latSum += onFrame * 1000.0 / 48000.0;
+                }
+            }
+        }
+        printf("  %-9s %5d/%-2d %14.1f\n", WAVES[w], correct, total, correct ? latSum / correct : 0.0);
+    }
+
+    // Cost of one hop on a held saw chord
+    synth.setWaveform(WAVE_SAW);
+    synth.reset();
+    chroma.reset();
+    for (uint8_t v = 0; v < 4; v++) synth.noteOn((uint8_t)(48 + VOICING[3][v]), 100);
+    static int16_t block[GingoChroma::HOP];
+    synth.render(block, GingoChroma::HOP);
+    double usHop = timeUs(50, [&]() {
+        chroma.process(block, GingoChroma::HOP);
+        sink += chroma.hops();
+    });
+    const double hopUs = GingoChroma::HOP * 1e6 / 48000.0;
+    printf("  %.1f us/hop, %.1f%% of the %.1f ms hop (FFT %d)\n",
+           usHop, usHop * 100.0 / hopUs, hopUs / 1000.0, GingoChroma::FFT_SIZE);
+}
+
+// =====================================================================
+// Hot paths: fixed seeded workloads, recorded for --json / --baseline
+// =====================================================================
+
+static const uint8_t MAX_REPEATS = 15;
+
+struct BenchResult {
+    const char* name;
+    double      nsPerOp;               ///< median of samples
+    double      samples[MAX_REPEATS];  ///< one per --repeats pass
+    uint8_t     count;
+};
+
+static const uint8_t MAX_RESULTS = 32;
+static BenchResult results[MAX_RESULTS];
+static uint8_t resultCount = 0;
+
+/// Fixed-seed LCG so every run times the same workload.
+static const uint32_t RNG_SEED = 0x6A09E667UL;
+static uint32_t rngState = RNG_SEED;
+static uint32_t rnd(uint32_t n) {
+    rngState = rngState * 1664525UL + 1013904223UL;
+    return (rngState >> 8) % n;
+}
+
+/// Best of 7 runs of at least 10 ms each, in nanoseconds per op (each
+/// call of fn does ops ops). Iterations are calibrated per path so fast
+/// and slow paths get the same timing resolution.
+template <typename Fn>
+static double bestNs(uint32_t ops, Fn fn) {
+    uint32_t iters = 1;
+    while (iters < (1UL << 24) && timeUs(iters, fn) * iters < 10000.0) iters *= 2;
+    double best = 1e30;
+    for (uint8_t r = 0; r < 7; r++) {
+        double us = timeUs(iters, fn);
+        if (us < best) best = us;
+    }
+    return best * 1000.0 / ops;
+}
+
+/// Add one sample for a path; printHotPaths() reports the median.
+static void record(const char* name, double nsPerOp) {
+    uint8_t i = 0;
+    while (i < resultCount && strcmp(results[i].name, name) != 0) i++;
+    if (i == resultCount) {
+        if (resultCount == MAX_RESULTS) return;
+        results[i].name = name;
+        results[i].count = 0;
+        resultCount++;
+    }
+    BenchResult& r = results[i];
+    if (r.count < MAX_REPEATS) r.samples[r.count++] = nsPerOp;
+}
+
+/// Median of each path's samples into nsPerOp, then the report.
+static void printHotPaths(uint8_t repeats) {
+    printf("\n=== Hot paths (median of %u passes, each best of 7) ===\n", repeats);
+    for (uint8_t i = 0; i < resultCount; i++) {
+        BenchResult& r = results[i];
+        double v[MAX_REPEATS];
+        for (uint8_t k = 0; k < r.count; k++) {
+            uint8_t j = k;
+            for (; j > 0 && v[j - 1] > r.samples[k]; j--) v[j] = v[j - 1];
+            v[j] = r.samples[k];
+        }
+        r.nsPerOp = (r.count & 1) ? v[r.count / 2] : (v[r.count / 2 - 1] + v[r.count / 2]) / 2;
+        printf("  %-30s %10.1f ns/op %12.0f ops/s\n", r.name, r.nsPerOp, 1e9 / r.nsPerOp);
+    }
+}
+
+static const char* const HOT_TYPES[] = { "M", "m", "7", "m7", "7M", "dim", "m7(b5)", "6", "sus4", "aug" };
+static const uint8_t NUM_HOT_TYPES = sizeof(HOT_TYPES) / sizeof(HOT_TYPES[0]);
+
+/// Random chord name (root + type) into buf.
+static void randomChordName(char* buf, uint8_t len) {
+    data::readChromaticName((uint8_t)rnd(12), buf, len);
+    strcat(buf, HOT_TYPES[rnd(NUM_HOT_TYPES)]);
+}
+
+static void benchHotPaths() {
+    rngState = RNG_SEED;
+    const uint8_t W = 64;   // workload size per path
+
+    // GingoChord::identify / identifyMask
+    {
+        static GingoNote notes[W][GINGODUINO_MAX_CHORD_NOTES];
+        static uint8_t counts[W];
+        static uint16_t masks[W];
+        for (uint8_t i = 0; i < W; i++) {
+            char name[16];
+            randomChordName(name, sizeof(name));
+            counts[i] = GingoChord(name).notes(notes[i], GINGODUINO_MAX_CHORD_NOTES);
+            masks[i] = 0;
+            for (uint8_t k = 0; k < counts[i]; k++) masks[i] |= (uint16_t)(1u << notes[i][k].semitone());
+        }
+        char out[16];
+        record("chord.identify", bestNs(W, [&]() {
+            for (uint8_t i = 0; i < W; i++) sink += GingoChord::identify(notes[i], counts[i], out, sizeof(out));
+        }));
+        ChordMatch m[4];
+        record("chord.identifyMask", bestNs(W, [&]() {
+            for (uint8_t i = 0; i < W; i++) sink += GingoChord::identifyMask(masks[i], 255, m, 4);
+        }));
+    }
+
+    // Letter spelling: scales and chords on random roots
+    {
+        static GingoField fields[W];   // GingoScale has no default constructor
+        static GingoChord chords[W];
+        static const ScaleType TYPES[] = { SCALE_MAJOR, SCALE_NATURAL_MINOR, SCALE_HARMONIC_MINOR, SCALE_BLUES };
+        for (uint8_t i = 0; i < W; i++) {
+            char name[16];
+            data::readChromaticName((uint8_t)rnd(12), name, sizeof(name));
+            fields[i] = GingoField(name, TYPES[rnd(4)]);
+            randomChordName(name, sizeof(name));
+            chords[i] = GingoChord(name);
+        }
+        GingoNote out[12];
+        record("scale.formalNotes", bestNs(W, [&]() {
+            for (uint8_t i = 0; i < W; i++) sink += fields[i].scale().formalNotes(out, 12);
+        }));
+        record("chord.formalNotes", bestNs(W, [&]() {
+            for (uint8_t i = 0; i < W; i++) sink += chords[i].formalNotes(out, 7);
+        }));
+    }
+
+    // GingoField::deduce: four diatonic chords of a random major key
+    {
+        const uint8_t N = 16;
+        static char names[N][4][16];
+        static const char* items[N][4];
+        for (uint8_t i = 0; i < N; i++) {
+            char tonic[4];
+            data::readChromaticName((uint8_t)rnd(12), tonic, sizeof(tonic));
+            GingoField field(tonic, SCALE_MAJOR);
+            for (uint8_t k = 0; k < 4; k++) {
+                strcpy(names[i][k], field.chord((uint8_t)(1 + rnd(7))).name());
+                items[i][k] = names[i][k];
+            }
+        }
+        FieldMatch fm[4];
+        record("field.deduce", bestNs(N, [&]() {
+            for (uint8_t i = 0; i < N; i++) sink += GingoField::deduce(items[i], 4, fm, 4);
+        }));
+    }
+
+    // GingoMonitor::noteOn: random chords played and released
+    {
+        static uint8_t midi[W][4];
+        for (uint8_t i = 0; i < W; i++) {
+            char name[16];
+            randomChordName(name, sizeof(name));
+            GingoNote cn[GINGODUINO_MAX_CHORD_NOTES];
+            uint8_t n = GingoChord(name).notes(cn, GINGODUINO_MAX_CHORD_NOTES);
+            for (uint8_t k = 0; k < 4; k++) midi[i][k] = (uint8_t)(48 + cn[k % n].semitone() + 12 * (k / n));
+        }
+        GingoMonitor mon;
+        record("monitor.noteOn", bestNs(W * 4, [&]() {
+            for (uint8_t i = 0; i < W; i++) {
+                for (uint8_t k = 0; k < 4; k++) mon.noteOn(0, midi[i][k], 100);
+                for (uint8_t k = 0; k < 4; k++) mon.noteOff(0, midi[i][k]);
+            }
+            sink += mon.hasChord();
+        }));
+    }
+
+    // GingoArpeggiator: one tick of a two-octave up-down seventh chord,
+    // and a follow() whose input did not change
+    {
+        GingoMonitor mon;
+        const uint8_t held[] = { 48, 55, 58, 64 };
+        for (uint8_t k = 0; k < 4; k++) mon.noteOn(0, held[k], 100);
+        GingoArpeggiator arp;
+        arp.setPattern(ARP_UP_DOWN);
+        arp.setOctaves(2);
+        arp.onNote([](uint8_t note, uint8_t vel, void*) { sink += note + vel; });
+        arp.follow(mon);
+        record("arp.tick", bestNs(GingoArpeggiator::PPQN, [&]() {
+            for (uint16_t t = 0; t < GingoArpeggiator::PPQN; t++) arp.tick();
+        }));
+        record("arp.follow", bestNs(W, [&]() {
+            for (uint8_t i = 0; i < W; i++) arp.follow(mon);
+            sink += arp.steps();
+        }));
+    }
+
+    // GingoTree::harmonize: a 64-bar melody, one chord per beat
+    {
+        static uint16_t masks[256];
+        static const uint16_t SCALE[] = { 0, 2, 4, 5, 7, 9, 11 };
+        for (uint16_t i = 0; i < 256; i++) {
+            masks[i] = (uint16_t)(1u << SCALE[rnd(7)]);
+            if (rnd(2)) masks[i] |= (uint16_t)(1u << SCALE[rnd(7)]);
+        }
+        GingoTree tree("C", SCALE_MAJOR, 0);
+        static HarmonyStep out[256];
+        record("tree.harmonize", bestNs(256, [&]() {
+            sink += tree.harmonize(masks, 256, out, 256);
+        }));
+    }
+
+    // GingoProgression::predict: partial roman-numeral sequences
+    {
+        static const char* const BRANCHES[] = { "I", "IIm", "IIIm", "IV", "V7", "VIm", "V", "IIm7" };
+        const uint8_t N = 16;
+        static const char* seqs[N][3];
+        static uint8_t lens[N];
+        for (uint8_t i = 0; i < N; i++) {
+            lens[i] = (uint8_t)(1 + rnd(3));
+            for (uint8_t k = 0; k < lens[i]; k++) seqs[i][k] = BRANCHES[rnd(8)];
+        }
+        GingoProgression prog("C", SCALE_MAJOR);
+        ProgressionRoute routes[8];
+        record("progression.predict", bestNs(N, [&]() {
+            for (uint8_t i = 0; i < N; i++) sink += prog.predict(seqs[i], lens[i], routes, 8);
+        }));
+    }
+
+    // GingoFretboard::fingerings (cache off), full and packed
+    {
+        const uint8_t N = 16;
+        static GingoChord chords[N];
+        for (uint8_t i = 0; i < N; i++) {
+            char name[16];
+            randomChordName(name, sizeof(name));
+            chords[i] = GingoChord(name);
+        }
+        GingoFretboard guitar = GingoFretboard::guitar();
+        GingoFingering full[5];
+        record("fretboard.fingerings", bestNs(N, [&]() {
+            for (uint8_t i = 0; i < N; i++) sink += guitar.fingerings(chords[i], full, 5);
+        }));
+        GingoPackedFingering packed[5];
+        record("fretboard.fingerings.packed", bestNs(N, [&]() {
+            for (uint8_t i = 0; i < N; i++) sink += guitar.fingerings(chords[i], packed, 5);
+        }));
+    }
+
+    // GingoChordComparison::compute, from chords and from profiles
+    {
+        const uint8_t N = 16;
+        static GingoChord chords[N];
+        static GingoChordProfile profiles[N];
+        for (uint8_t i = 0; i < N; i++) {
+            char name[16];
+            randomChordName(name, sizeof(name));
+            chords[i] = GingoChord(name);
+            profiles[i] = GingoChordComparison::profile(chords[i]);
+        }
+        record("comparison.compute", bestNs(N * N, [&]() {
+            for (uint8_t i = 0; i < N; i++)
+                for (uint8_t j = 0; j < N; j++)
+                    sink += comparisonDigest(GingoChordComparison::compute(chords[i], chords[j]));
+        }));
+        record("comparison.compute.profile", bestNs(N * N, [&]() {
+            for (uint8_t i = 0; i < N; i++)
+                for (uint8_t j = 0; j < N; j++)
+                    sink += comparisonDigest(GingoChordComparison::compute(profiles[i], profiles[j]));
+        }));
+    }
+
+    // MIDI encoders
+    {
+        const uint8_t N = 32;
+        static GingoEvent events[N];
+        static GingoChord chords[N];
+        GingoSequence seq;
+        for (uint8_t i = 0; i < N; i++) {
+            events[i] = GingoEvent::fromMIDI((uint8_t)(36 + rnd(48)));
+            seq.add(events[i]);
+            char name[16];
+            randomChordName(name, sizeof(name));
+            chords[i] = GingoChord(name);
+        }
+        uint8_t buf[6 * N];
+        record("midi1.fromEvent", bestNs(N, [&]() {
+            for (uint8_t i = 0; i < N; i++) sink += GingoMIDI1::fromEvent(events[i], buf, sizeof(buf));
+        }));
+        record("midi1.fromSequence", bestNs(N, [&]() {
+            sink += GingoMIDI1::fromSequence(seq, buf, sizeof(buf));
+        }));
+        record("midi2.chordName", bestNs(N, [&]() {
+            for (uint8_t i = 0; i < N; i++) sink += GingoMIDI2::chordName(chords[i]).words[1];
+        }));
+        GingoScale scale("D", SCALE_MAJOR);
+        record("midi2.keySignature", bestNs(1, [&]() {
+            sink += GingoMIDI2::keySignature(scale).words[1];
+        }));
+    }
+
+    // GingoPitch::process: held saw note, ns per sample
+    {
+        static GingoSynth synth(48000);
+        static GingoPitch pitch(48000);
+        static int16_t pcm[1024];
+        synth.setWaveform(WAVE_SAW);
+        synth.noteOn(57, 100);
+        synth.render(pcm, 1024);
+        record("pitch.process", bestNs(1024, [&]() {
+            pitch.process(pcm, 1024);
+            sink += pitch.note();
+        }));
+    }
+
+    // GingoChroma::process: held saw chord, ns per sample
+    {
+        static GingoSynth synth(48000);
+        static GingoChroma chroma(48000);
+        static int16_t pcm[GingoChroma::HOP];
+        synth.setWaveform(WAVE_SAW);
+        synth.noteOn(57);   // Am
+        synth.noteOn(60);
+        synth.noteOn(64);
+        synth.render(pcm, GingoChroma::HOP);
+        record("chroma.process", bestNs(GingoChroma::HOP, [&]() {
+            chroma.process(pcm, GingoChroma::HOP);
+            sink += chroma.hops();
+        }));
+    }
+
+    // GingoSynth::render: every voice sustaining, ns per frame
+    {
+        static GingoSynth synth(48000);
+        synth.setWaveform(WAVE_SAW);
+        for (uint8_t v = 0; v < GingoSynth::VOICES; v++) synth.noteOn((uint8_t)(48 + 4 * v));
+        static int16_t pcm[1024];
+        record("synth.render", bestNs(1024, [&]() {
+            synth.render(pcm, 1024);
+            sink += pcm[1023];
+        }));
+    }
+}
+
+// =====================================================================
+// JSON results and baseline comparison
+// =====================================================================
+
+static bool writeJson(const char* path) {
+    FILE* f = fopen(path, "w");
+    if (!f) return false;
+    fprintf(f, "{\n  \"library\": \"gingoduino\",\n  \"tier\": %d,\n  \"results\": [\n",
+            GINGODUINO_TIER);
+    for (uint8_t i = 0; i < resultCount; i++) {
+        fprintf(f, "    {\"name\": \"%s\", \"ns_per_op\": %.1f, \"ops_per_s\": %.0f}%s\n",
+                results[i].name, results[i].nsPerOp, 1e9 / results[i].nsPerOp,
+                (i + 1 < resultCount) ? "," : "");
+    }
+    fprintf(f, "  ]\n}\n");
+    fclose(f);
+    return true;
+}
+
+/// Compare against a file written by --json. Returns the number of paths
+/// slower than baseline by more than tolerancePct, or -1 if unreadable.
+static int compareBaseline(const char* path, double tolerancePct) {
+    FILE* f = fopen(path, "r");
+    if (!f) return -1;
+    printf("\n=== Baseline %s (tolerance %.0f%%) ===\n", path, tolerancePct);
+    int regressions = 0;
+    char line[256];
+    while (fgets(line, sizeof(line), f)) {
+        char name[64];
+        double baseNs;
+        const char* obj = strchr(line, '{');
+        if (!obj || sscanf(obj, "{\"name\": \"%63[^\"]\", \"ns_per_op\": %lf", name, &baseNs) != 2) {
+            continue;
+        }
+        for (uint8_t i = 0; i < resultCount; i++) {
+            if (strcmp(results[i].name, name) != 0) continue;
+            double delta = (results[i].nsPerOp - baseNs) * 100.0 / baseNs;
+            bool slow = delta > tolerancePct;
+            if (slow) regressions++;
+            printf("  %-30s %10.1f -> %10.1f ns/op  %+6.1f%%%s\n",
+                   name, baseNs, results[i].nsPerOp, delta, slow ? "  REGRESSION" : "");
+        }
+    }
+    fclose(f);
+    return regressions;
+}
+
+// =====================================================================
+// Main
+// =====================================================================
+
+int main(int argc, char** argv) {
+    const char* jsonPath = nullptr;
+    const char* baselinePath = nullptr;
+    double tolerancePct = 50.0;
+    unsigned repeats = 5;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--json") == 0 && i + 1 < argc) {
+            jsonPath = argv[++i];
+        } else if (strcmp(argv[i], "--baseline") == 0 && i + 1 < argc) {
+            baselinePath = argv[++i];
+        } else if (strcmp(argv[i], "--tolerance") == 0 && i + 1 < argc) {
+            tolerancePct = atof(argv[++i]);
+        } else if (strcmp(argv[i], "--repeats") == 0 && i + 1 < argc) {
+            repeats = (unsigned)atoi(argv[++i]);
+            if (repeats < 1) repeats = 1;
+            if (repeats > MAX_REPEATS) repeats = MAX_REPEATS;
+        } else {
+            fprintf(stderr, "usage: %s [--json FILE] [--baseline FILE] [--tolerance PCT]"
+                            " [--repeats N]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    printf("Gingoduino Native Benchmark\n");
+    printf("===========================\n");
+
+    benchFingeringMemory();
+    benchFingeringSearch();
+    benchShapeLibrary();
+    benchIdentify();
+    benchComparisonMatrix();
+    benchSelectiveCompare();
+    benchVoicingLeading();
+    benchSynthVoices();
+    benchPitch();
+    benchChroma();
+    for (unsigned r = 0; r < repeats; r++) benchHotPaths();
+    printHotPaths((uint8_t)repeats);
+
+    if (jsonPath && !writeJson(jsonPath)) {
+        fprintf(stderr, "cannot write %s\n", jsonPath);
+        return 2;
+    }
+    if (baselinePath) {
+        int regressions = compareBaseline(baselinePath, tolerancePct);
+        if (regressions < 0) {
+            fprintf(stderr, "cannot read %s\n", baselinePath);
+            return 2;
+        }
+        if (regressions > 0) {
+            printf("%d path(s) slower than baseline\n", regressions);
+            return 1;
+        }
+    }
+    return sink == 0xFFFFFFFFUL ? 1 : 0;
+}
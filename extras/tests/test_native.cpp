@@ -4,11 +4,15 @@
 // Build (from repo root):
 //   g++ -std=c++11 -DGINGODUINO_TIER=3 -I. -o extras/tests/test_native extras/tests/test_native.cpp
 
+#include <cctype>
 #include <cstdio>
 #include <cstring>
 #include "src/Gingoduino.h"
+#include "src/gingoduino_progmem.h"
 
-// Pull in all .cpp files for a single-file build
+// Pull in all .cpp files for a single-file build (the CMake targets
+// define GINGODUINO_LINKED and link the gingoduino library instead)
+#ifndef GINGODUINO_LINKED
 #include "src/GingoNote.cpp"
 #include "src/GingoInterval.cpp"
 #include "src/GingoChord.cpp"
@@ -25,6 +29,13 @@
 #include "src/GingoMonitor.cpp"
 #include "src/GingoChordComparison.cpp"
 #include "src/GingoMIDI1.cpp"
+#include "src/GingoProfile.cpp"
+#include "src/GingoTuning.cpp"
+#include "src/GingoSynth.cpp"
+#include "src/GingoPitch.cpp"
+#include "src/GingoChroma.cpp"
+#include "src/GingoArpeggiator.cpp"
+#endif
 
 using namespace gingoduino;
 
@@ -213,6 +224,96 @@ void testChord() {
     if (found) {
         printf("         identified as: %s\n", identified);
     }
+
+    // Formula mask index agrees with the interval formulas
+    bool masksOk = true;
+    for (uint8_t fi = 0; fi < data::CHORD_FORMULA_COUNT; fi++) {
+        uint8_t iv[7], cnt;
+        data::readChordFormula(fi, iv, &cnt);
+        uint16_t m = 0;
+        for (uint8_t i = 0; i < cnt; i++) m |= (uint16_t)(1u << (iv[i] % 12));
+        if (m != data::CHORD_FORMULA_MASKS[fi]) masksOk = false;
+    }
+    CHECK(masksOk, "CHORD_FORMULA_MASKS match CHORD_FORMULAS");
+
+    // Canonical alias index: shortest alias with a letter or digit, first on ties
+    bool canonOk = true;
+    for (uint8_t fi = 0; fi < data::CHORD_FORMULA_COUNT; fi++) {
+        uint8_t best = 255, bestLen = 255;
+        for (uint8_t a = 0; a < data::CHORD_TYPE_MAP_SIZE; a++) {
+            const char* alias = data::CHORD_TYPE_MAP[a].name;
+            if (data::CHORD_TYPE_MAP[a].formulaIdx != fi) continue;
+            uint8_t len = (uint8_t)strlen(alias);
+            bool alnum = false;
+            for (uint8_t c = 0; c < len; c++) {
+                if (isalnum((unsigned char)alias[c])) alnum = true;
+            }
+            if (alnum && len < bestLen) { best = a; bestLen = len; }
+        }
+        if (best != data::CHORD_CANONICAL_ALIAS[fi]) canonOk = false;
+    }
+    CHECK(canonOk, "CHORD_CANONICAL_ALIAS matches CHORD_TYPE_MAP");
+    char canon[10];
+    data::readCanonicalChordType(15, canon, sizeof(canon));
+    CHECK(strcmp(canon, "m7(b5)") == 0, "canonical type of half-diminished = m7(b5)");
+    data::readCanonicalChordType(15, canon, 6);
+    CHECK(canon[0] == '\0', "canonical type left empty when it does not fit");
+
+    // CHORD_MASK_INDEX: rebuilt from CHORD_FORMULA_MASKS, in (mask, formula) order
+    data::ChordMaskEntry idx[2 * data::CHORD_FORMULA_COUNT];
+    uint8_t ni = 0;
+    for (uint8_t fi = 0; fi < data::CHORD_FORMULA_COUNT; fi++) {
+        uint16_t fm = data::CHORD_FORMULA_MASKS[fi];
+        bool dup = false;
+        for (uint8_t fj = 0; fj < fi && !dup; fj++) dup = data::CHORD_FORMULA_MASKS[fj] == fm;
+        if (dup) continue;
+        uint8_t tones = 0;
+        for (uint16_t m = fm; m; m &= (uint16_t)(m - 1)) tones++;
+        idx[ni].mask = fm; idx[ni].formula = fi; idx[ni].rank = 0; ni++;
+        if ((fm & 0x80) && tones >= 4) {
+            idx[ni].mask = (uint16_t)(fm & ~0x80); idx[ni].formula = fi; idx[ni].rank = 2; ni++;
+        }
+    }
+    for (uint8_t i = 1; i < ni; i++) {
+        data::ChordMaskEntry key = idx[i];
+        uint8_t j = i;
+        while (j > 0 && (idx[j - 1].mask > key.mask ||
+               (idx[j - 1].mask == key.mask && idx[j - 1].formula > key.formula))) {
+            idx[j] = idx[j - 1];
+            j--;
+        }
+        idx[j] = key;
+    }
+    bool idxOk = ni == data::CHORD_MASK_INDEX_COUNT;
+    for (uint8_t i = 0; idxOk && i < ni; i++) {
+        const data::ChordMaskEntry& e = data::CHORD_MASK_INDEX[i];
+        idxOk = e.mask == idx[i].mask && e.formula == idx[i].formula && e.rank == idx[i].rank;
+    }
+    CHECK(idxOk, "CHORD_MASK_INDEX matches CHORD_FORMULA_MASKS");
+
+    // Mask identification: inversions, omitted fifth, ranked alternatives
+    ChordMatch cm[8];
+    const uint16_t C = 1u << 0, E = 1u << 4, G = 1u << 7, A = 1u << 9, Bb = 1u << 10;
+    uint8_t nm = GingoChord::identifyMask(C | E | G, 4, cm, 8);
+    CHECK(nm >= 1 && strcmp(cm[0].name.c_str(), "CM/E") == 0 && cm[0].rank == 4,
+          "identifyMask CEG over E = CM/E");
+    nm = GingoChord::identifyMask(C | E | Bb, 0, cm, 8);
+    CHECK(nm >= 1 && strcmp(cm[0].name.c_str(), "C7") == 0 && cm[0].rank == 2,
+          "identifyMask C E Bb = C7 without fifth");
+    nm = GingoChord::identifyMask(A | C | E | G, 9, cm, 8);
+    bool hasC6 = false;
+    for (uint8_t i = 1; i < nm; i++) {
+        if (strcmp(cm[i].name.c_str(), "C6/A") == 0) hasC6 = true;
+    }
+    CHECK(nm >= 2 && strcmp(cm[0].name.c_str(), "Am7") == 0 && hasC6,
+          "identifyMask ACEG: Am7 first, C6/A as alternative");
+    bool ranked = true;
+    for (uint8_t i = 1; i < nm; i++) {
+        if (cm[i].rank < cm[i - 1].rank) ranked = false;
+    }
+    CHECK(ranked, "identifyMask results ranked");
+    CHECK(GingoChord::identifyMask(A | C | E | G, 9, cm, 1) == 1 &&
+          strcmp(cm[0].name.c_str(), "Am7") == 0, "identifyMask keeps the best when truncated");
 }
 
 void testChordIntervals() {
@@ -401,6 +502,90 @@ void testFieldExtended() {
     CHECK(strcmp(buf, "transitive") == 0, "roleOf('Em')=transitive");
 }
 
+// =====================================================================
+// Formal notes (letter spelling)
+// =====================================================================
+
+/// Space-separated note names.
+static const char* joinNames(const GingoNote* notes, uint8_t n, char* buf) {
+    buf[0] = '\0';
+    for (uint8_t i = 0; i < n; i++) {
+        if (i) strcat(buf, " ");
+        strcat(buf, notes[i].name());
+    }
+    return buf;
+}
+
+void testFormalNotes() {
+    printf("\n=== Formal notes ===\n");
+    GingoNote out[12];
+    char buf[64];
+
+    // GingoNote::spell
+    CHECK(strcmp(GingoNote("F").spell(5, 3).name(), "Bb") == 0, "spell: F + P4 = Bb");
+    CHECK(strcmp(GingoNote("C").spell(8, 4).name(), "G#") == 0, "spell: C + #5 = G#");
+    CHECK(strcmp(GingoNote("B").spell(9, 6).name(), "Ab") == 0, "spell: B + d7 = Ab");
+    GingoNote es = GingoNote("C#").spell(4, 2);
+    CHECK(strcmp(es.name(), "E#") == 0 && strcmp(es.natural(), "F") == 0 &&
+          es.semitone() == 5 && es.sound() == 'E', "spell: E# keeps letter, natural F");
+    CHECK(strcmp(GingoNote("Eb").spell(9, 6).name(), "Dbb") == 0 &&
+          strcmp(GingoNote("D#").spell(4, 2).name(), "F##") == 0, "spell: double accidentals");
+    CHECK(strcmp(GingoNote("C").spell(6, 1).name(), "F#") == 0, "spell: beyond a double accidental");
+    bool spellNatural = true;
+    for (uint8_t t = 0; t < 12; t++) {
+        for (uint8_t steps = 0; steps < 7; steps++) {
+            GingoNote sp = GingoNote("C").spell(t, steps);
+            if (strcmp(sp.natural(), GingoNote::fromMIDI(60 + t).natural()) != 0) spellNatural = false;
+        }
+    }
+    CHECK(spellNatural, "spell: natural matches the chromatic table for every target");
+
+    // Scales
+    GingoScale fMaj("F", SCALE_MAJOR);
+    CHECK(strcmp(joinNames(out, fMaj.formalNotes(out, 12), buf), "F G A Bb C D E") == 0,
+          "formal: F major has Bb");
+    uint8_t n = fMaj.notes(out, 12);
+    CHECK(n == 7 && strcmp(out[3].name(), "A#") == 0, "notes(): still sharp-based");
+    printf("         F major: %s\n", joinNames(out, fMaj.formalNotes(out, 12), buf));
+    CHECK(strcmp(joinNames(out, GingoScale("Gb", SCALE_MAJOR).formalNotes(out, 12), buf),
+                 "Gb Ab Bb Cb Db Eb F") == 0, "formal: Gb major has Cb");
+    CHECK(strcmp(joinNames(out, GingoScale("F#", SCALE_MAJOR).formalNotes(out, 12), buf),
+                 "F# G# A# B C# D# E#") == 0, "formal: F# major has E#");
+    CHECK(strcmp(joinNames(out, GingoScale("A", SCALE_HARMONIC_MINOR).formalNotes(out, 12), buf),
+                 "A B C D E F G#") == 0, "formal: A harmonic minor");
+    CHECK(strcmp(joinNames(out, GingoScale("C", "altered").formalNotes(out, 12), buf),
+                 "C Db Eb Fb Gb Ab Bb") == 0, "formal: C altered");
+    CHECK(strcmp(joinNames(out, GingoScale("D", "dorian").formalNotes(out, 12), buf),
+                 "D E F G A B C") == 0, "formal: D dorian");
+    CHECK(strcmp(joinNames(out, GingoScale("Eb", "minor pentatonic").formalNotes(out, 12), buf),
+                 "Eb Gb Ab Bb Db") == 0, "formal: Eb minor pentatonic");
+    CHECK(strcmp(joinNames(out, GingoScale("C", SCALE_BLUES).formalNotes(out, 12), buf),
+                 "C Eb F F# G Bb") == 0, "formal: C blues");
+    CHECK(strcmp(joinNames(out, GingoScale("C", SCALE_WHOLE_TONE).formalNotes(out, 12), buf),
+                 "C D E Gb Ab Bb") == 0, "formal: C whole tone");
+    CHECK(GingoScale("C", SCALE_CHROMATIC).formalNotes(out, 12) == 12 && strcmp(out[10].name(), "A#") == 0,
+          "formal: chromatic");
+    CHECK(GingoScale("F", SCALE_MAJOR).formalNotes(out, 3) == 3, "formal: maxNotes respected");
+
+    // Chords
+    CHECK(strcmp(joinNames(out, GingoChord("Bb7").formalNotes(out, 7), buf), "Bb D F Ab") == 0,
+          "formal: Bb7");
+    CHECK(strcmp(joinNames(out, GingoChord("Caug").formalNotes(out, 7), buf), "C E G#") == 0,
+          "formal: Caug");
+    CHECK(strcmp(joinNames(out, GingoChord("Bdim7").formalNotes(out, 7), buf), "B D F Ab") == 0,
+          "formal: Bdim7");
+    CHECK(strcmp(joinNames(out, GingoChord("Ebm7(b5)").formalNotes(out, 7), buf), "Eb Gb Bbb Db") == 0,
+          "formal: Ebm7(b5)");
+    CHECK(strcmp(joinNames(out, GingoChord("Db7+9").formalNotes(out, 7), buf), "Db F Ab Cb E") == 0,
+          "formal: Db7(#9)");
+    CHECK(GingoChord("Cxyz").formalNotes(out, 7) == 0, "formal: unknown chord");
+
+    // Field
+    GingoField dMin("D", SCALE_NATURAL_MINOR);
+    CHECK(strcmp(joinNames(out, dMin.formalNotes(out, 12), buf), "D E F G A Bb C") == 0,
+          "formal: D minor field");
+}
+
 // =====================================================================
 // Duration
 // =====================================================================
@@ -723,6 +908,10 @@ void testFretboard() {
     CHECK(guitar.numStrings() == 6, "violao numStrings=6");
     CHECK(guitar.numFrets() == 19, "violao numFrets=19");
     CHECK(strcmp(guitar.name(), "Violao") == 0, "violao name");
+    CHECK(GingoFretboard::guitar(40).numFrets() == GingoFretboard::MAX_FRETS,
+          "numFrets above MAX_FRETS is clamped");
+    CHECK(GingoFretboard::guitar(40).fretMask(0xFFF, 0) == 0xFFFFFFFFUL,
+          "clamped board indexes frets 0-31");
 
     // Open string MIDI
     CHECK(guitar.openMidi(0) == 40, "open E2 = MIDI 40");
@@ -757,6 +946,50 @@ void testFretboard() {
     CHECK(count > 0, "C Major positions (frets 0-4)");
     printf("         C Major (frets 0-4): %d positions\n", count);
 
+    // Position index agrees with direct MIDI arithmetic
+    {
+        GingoFretboard idx = GingoFretboard::guitar();
+        idx.setString(0, 38);               // retune rebuilds the index
+        GingoFretboard capoIdx = idx.capo(3);
+        const GingoFretboard* boards[] = { &guitar, &idx, &capoIdx };
+        bool agree = true;
+        for (uint8_t b = 0; b < 3; b++) {
+            const GingoFretboard& fb = *boards[b];
+            for (uint8_t s = 0; s < fb.numStrings(); s++) {
+                for (uint8_t pc = 0; pc < 12; pc++) {
+                    uint32_t expect = 0;
+                    for (uint8_t f = 0; f <= fb.numFrets(); f++) {
+                        if (fb.midiAt(s, f) % 12 == pc) expect |= (uint32_t)1 << f;
+                    }
+                    if (fb.fretMask((uint16_t)(1u << pc), s) != expect) agree = false;
+                }
+            }
+        }
+        CHECK(agree, "fretMask matches midiAt for every cell (tuning, setString, capo)");
+
+        GingoScale dDor("D", "dorian");
+        GingoFretPos sp[96];
+        uint8_t ns = capoIdx.scalePositions(dDor, sp, 96, 2, 9);
+        bool allIn = true, ordered = true;
+        uint8_t brute = 0;
+        for (uint8_t s = 0; s < capoIdx.numStrings(); s++) {
+            for (uint8_t f = 2; f <= 9; f++) {
+                if (dDor.contains(capoIdx.noteAt(s, f))) brute++;
+            }
+        }
+        for (uint8_t i = 0; i < ns; i++) {
+            if (!dDor.contains(sp[i].note) || sp[i].midi != capoIdx.midiAt(sp[i].string, sp[i].fret))
+                allIn = false;
+            if (i > 0 && (sp[i].string < sp[i - 1].string ||
+                (sp[i].string == sp[i - 1].string && sp[i].fret <= sp[i - 1].fret)))
+                ordered = false;
+        }
+        CHECK(ns == brute, "scalePositions count matches brute force");
+        CHECK(allIn, "scalePositions notes belong to the scale");
+        CHECK(ordered, "scalePositions ordered by string then fret");
+        CHECK(idx.scalePositions(dDor, sp, 4) == 4, "scalePositions honors maxPositions");
+    }
+
     // Fingering
     GingoFingering fg;
     bool found = guitar.fingering(GingoChord("CM"), 0, fg);
@@ -771,12 +1004,365 @@ void testFretboard() {
     CHECK(nfg > 0, "CM has at least 1 fingering");
     printf("         CM fingerings found: %d\n", nfg);
 
+    // Exhaustive search finds the standard open shapes first
+    {
+        struct Shape { const char* chord; const char* frets; };
+        static const Shape SHAPES[] = {
+            { "CM", "x32010" }, { "Am", "x02210" }, { "EM", "022100" },
+            { "Em", "022000" }, { "DM", "xx0232" }, { "GM", "320003" },
+            { "FM", "133211" },
+        };
+        for (uint8_t i = 0; i < sizeof(SHAPES) / sizeof(SHAPES[0]); i++) {
+            GingoFingering best;
+            char shape[7] = "";
+            if (guitar.fingerings(GingoChord(SHAPES[i].chord), &best, 1) == 1) {
+                for (uint8_t s = 0; s < 6; s++) {
+                    shape[s] = (best.strings[s].action == STRING_MUTED)
+                             ? 'x' : (char)('0' + best.strings[s].fret);
+                }
+                shape[6] = '\0';
+            }
+            char msg[48];
+            snprintf(msg, sizeof(msg), "best %s fingering = %s (got %s)",
+                     SHAPES[i].chord, SHAPES[i].frets, shape);
+            CHECK(strcmp(shape, SHAPES[i].frets) == 0, msg);
+        }
+    }
+
+#if GINGODUINO_HAS_SHAPE_LIBRARY
+    // Shape library: table lookup agrees with the search, through capo and
+    // transposed tunings
+    {
+        GingoFretboard boards[] = { GingoFretboard::guitar(), GingoFretboard::dadgad(),
+                                    GingoFretboard::ukulele(), GingoFretboard::cavaquinho() };
+        const char* types[] = { "M", "m", "7", "m7", "7M", "m7(b5)", "sus4" };
+        bool agree = true, covered = true;
+        for (uint8_t b = 0; b < 4; b++) {
+            for (uint8_t t = 0; t < 7; t++) {
+                for (uint8_t root = 0; root < 12; root++) {
+                    char name[16];
+                    data::readChromaticName(root, name, sizeof(name));
+                    strcat(name, types[t]);
+                    GingoChord chord(name);
+                    GingoPackedFingering best, tab;
+                    bool has = boards[b].shape(chord, tab);
+                    if (!has) continue;
+                    uint16_t pcs = 0;
+                    for (uint8_t s = 0; s < tab.numStrings; s++) {
+                        if (tab.isMuted(s)) continue;
+                        if (tab.fret(s) > 4) covered = false;
+                        pcs |= (uint16_t)(1u << ((boards[b].openMidi(s) + tab.fret(s)) % 12));
+                    }
+                    if (!(pcs & (1u << root))) covered = false;
+                    // When the best full-neck shape sits in frets 0-4, the table has it
+                    if (boards[b].fingerings(chord, &best, 1) == 1) {
+                        bool low = true;
+                        for (uint8_t s = 0; s < best.numStrings; s++) {
+                            if (!best.isMuted(s) && best.fret(s) > 4) low = false;
+                        }
+                        if (low && best.score != tab.score) agree = false;
+                    }
+                }
+            }
+        }
+        CHECK(agree, "shape library matches the best search result in frets 0-4");
+        CHECK(covered, "shape library entries stay in frets 0-4 and sound the root");
+
+        GingoPackedFingering c, d, e;
+        CHECK(guitar.shape(GingoChord("CM"), c) && guitar.capo(2).shape(GingoChord("DM"), d) &&
+              memcmp(c.frets, d.frets, 6) == 0 && d.capoFret == 2,
+              "capo 2: D uses the C shape");
+        const uint8_t ebStd[6] = { 39, 44, 49, 54, 58, 63 };
+        GingoFretboard eb("Eb standard", ebStd, 6);
+        CHECK(guitar.shape(GingoChord("EM"), c) && eb.shape(GingoChord("D#M"), e) &&
+              memcmp(c.frets, e.frets, 6) == 0, "transposed tuning reuses the table");
+        CHECK(!guitar.shape(GingoChord("C13"), c), "chord type outside the library");
+        const uint8_t odd[6] = { 40, 45, 50, 55, 60, 64 };
+        CHECK(!GingoFretboard("odd", odd, 6).shape(GingoChord("CM"), c), "unknown tuning");
+
+        GingoFingering open1;
+        CHECK(guitar.openFingerings(GingoChord("Am"), &open1, 1) == 1 &&
+              open1.strings[0].action == STRING_MUTED && open1.strings[2].fret == 2 &&
+              open1.strings[4].fret == 1, "openFingerings(1) Am from the library");
+
+        // Ranked shapes: the table shape plus E- and A-form barres
+        GingoPackedFingering sh[3];
+        const uint8_t fE[6] = { 1, 3, 3, 2, 1, 1 };
+        const uint8_t bmA[6] = { GingoPackedFingering::MUTED, 2, 4, 4, 3, 2 };
+        uint8_t nf = guitar.shapes(GingoChord("FM"), sh, 3);
+        bool hasFE = false;
+        for (uint8_t i = 0; i < nf; i++) hasFE |= memcmp(sh[i].frets, fE, 6) == 0;
+        CHECK(nf >= 2 && hasFE, "shapes(F) includes the E-form barre 133211");
+        uint8_t nb = guitar.shapes(GingoChord("Bm"), sh, 3);
+        bool hasBmA = false, ranked = true;
+        for (uint8_t i = 0; i < nb; i++) {
+            hasBmA |= memcmp(sh[i].frets, bmA, 6) == 0;
+            if (i > 0 && sh[i].score < sh[i - 1].score) ranked = false;
+            if (sh[i].rootPc != 11 || sh[i].formula != GingoChord("Bm").formulaIndex()) ranked = false;
+        }
+        CHECK(nb >= 2 && hasBmA && ranked, "shapes(Bm) ranked, includes the A-form barre x24432");
+        uint8_t na = guitar.shapes(GingoChord("Am"), sh, 3);
+        CHECK(na == 2 && guitar.shape(GingoChord("Am"), c) && memcmp(sh[0].frets, c.frets, 6) == 0 &&
+              sh[1].frets[0] == 5 && sh[1].frets[2] == 7, "shapes(Am): open shape, then the E form at 5");
+        CHECK(guitar.shapes(GingoChord("Bm"), sh, 1) == 1 && guitar.shapes(GingoChord("C13"), sh, 3) == 0,
+              "shapes respects maxResults and the library's chord types");
+        bool barresPlay = true;
+        GingoFretboard capo3 = guitar.capo(3);
+        for (uint8_t b = 0; b < 12; b++) {
+            char name[8];
+            data::readChromaticName(b, name, sizeof(name));
+            strcat(name, "7");
+            GingoChord chord(name);
+            uint8_t n = capo3.shapes(chord, sh, 3);
+            for (uint8_t i = 0; i < n; i++) {
+                uint16_t pcs = 0;
+                for (uint8_t s = 0; s < 6; s++) {
+                    if (sh[i].isMuted(s)) continue;
+                    if (sh[i].fret(s) > capo3.numFrets()) barresPlay = false;
+                    pcs |= (uint16_t)(1u << ((capo3.openMidi(s) + sh[i].fret(s)) % 12));
+                }
+                if (!(pcs & (1u << b))) barresPlay = false;
+            }
+        }
+        CHECK(barresPlay, "shapes on a capo board sound the root and fit the neck");
+    }
+#endif
+
+    // Every result covers all chord tones, within span, sorted by score
+    {
+        GingoChord g7("G7");
+        GingoPackedFingering pm[16];
+        GingoFingering many[16];
+        uint8_t nm = guitar.fingerings(g7, pm, 16);
+        CHECK(nm == 16, "G7 has at least 16 playable fingerings");
+        for (uint8_t i = 0; i < nm; i++) guitar.unpack(pm[i], many[i]);
+        bool sorted = true, complete = true, spanOk = true;
+        for (uint8_t i = 0; i < nm; i++) {
+            if (i > 0 && many[i].score < many[i - 1].score) sorted = false;
+            uint8_t lo = 255, hi = 0;
+            uint16_t pcs = 0;
+            for (uint8_t j = 0; j < many[i].numNotes; j++) {
+                pcs |= (uint16_t)(1u << (many[i].midiNotes[j] % 12));
+            }
+            for (uint8_t s = 0; s < 6; s++) {
+                if (many[i].strings[s].action != STRING_FRETTED) continue;
+                uint8_t f = many[i].strings[s].fret;
+                if (f < lo) lo = f;
+                if (f > hi) hi = f;
+            }
+            if (pcs != ((1u << 7) | (1u << 11) | (1u << 2) | (1u << 5))) complete = false;
+            if (lo != 255 && hi - lo > 3) spanOk = false;
+        }
+        CHECK(sorted, "G7 fingerings sorted by score");
+        CHECK(complete, "G7 fingerings cover G B D F");
+        CHECK(spanOk, "G7 fingerings span at most 4 frets");
+
+        GingoFingering two[2];
+        CHECK(guitar.fingerings(g7, two, 2) == 2, "maxResults bounds output");
+        CHECK(two[0].score == many[0].score && two[1].score == many[1].score,
+              "top-K independent of K");
+        CHECK(guitar.fingerings(g7, many, 16) == GINGODUINO_MAX_FINGERINGS + 4,
+              "GingoFingering results capped at MAX_FINGERINGS + 4");
+    }
+
+    // Window search: position 1 (frets 4-8) excludes the open shape
+    {
+        GingoFingering w;
+        CHECK(guitar.fingering(GingoChord("Am"), 1, w), "Am found in window 1");
+        bool inWindow = true;
+        for (uint8_t s = 0; s < 6; s++) {
+            if (w.strings[s].action == STRING_FRETTED &&
+                (w.strings[s].fret < 4 || w.strings[s].fret > 8)) inWindow = false;
+        }
+        CHECK(inWindow, "window 1 fingering stays within frets 4-8");
+    }
+
+    // Progression planning: Viterbi path equals brute force over top-K
+    {
+        const uint8_t K = GINGODUINO_PLAN_CANDIDATES;
+        GingoChord prog[5] = { GingoChord("CM"), GingoChord("Am"), GingoChord("FM"),
+                               GingoChord("GM"), GingoChord("Em") };
+        GingoFingering plan[5];
+        CHECK(guitar.planFingerings(prog, 5, plan, 5) == 5, "planFingerings writes 5");
+
+        GingoFingering cand[5][GINGODUINO_PLAN_CANDIDATES];
+        uint8_t nc[5];
+        for (uint8_t i = 0; i < 5; i++) nc[i] = guitar.fingerings(prog[i], cand[i], K);
+
+        uint32_t planCost = plan[0].score;
+        for (uint8_t i = 1; i < 5; i++) {
+            planCost += plan[i].score + GingoFretboard::transitionCost(plan[i - 1], plan[i]);
+        }
+        uint32_t best = 0xFFFFFFFFUL;
+        uint16_t combos = 1;
+        for (uint8_t i = 0; i < 5; i++) combos *= nc[i];
+        for (uint16_t c = 0; c < combos; c++) {
+            uint16_t r = c;
+            uint8_t pick[5];
+            for (uint8_t i = 0; i < 5; i++) { pick[i] = r % nc[i]; r /= nc[i]; }
+            uint32_t cost = cand[0][pick[0]].score;
+            for (uint8_t i = 1; i < 5; i++) {
+                cost += cand[i][pick[i]].score +
+                        GingoFretboard::transitionCost(cand[i - 1][pick[i - 1]], cand[i][pick[i]]);
+            }
+            if (cost < best) best = cost;
+        }
+        CHECK(planCost == best, "planFingerings path is optimal over top-K");
+
+        bool fromCands = true;
+        for (uint8_t i = 0; i < 5; i++) {
+            bool hit = false;
+            for (uint8_t j = 0; j < nc[i]; j++) {
+                if (memcmp(plan[i].strings, cand[i][j].strings, sizeof(plan[i].strings)) == 0) hit = true;
+            }
+            if (!hit) fromCands = false;
+        }
+        CHECK(fromCands, "planned fingerings come from each chord's top-K");
+
+        CHECK(GingoFretboard::transitionCost(plan[0], plan[0]) == 0, "transition to itself is free");
+        CHECK(guitar.planFingerings(prog, 5, plan, 2) == 2, "planFingerings honors maxResults");
+    }
+
+    // Packed fingerings: same search, one byte per string
+    {
+        CHECK(sizeof(GingoPackedFingering) * 3 < sizeof(GingoFingering),
+              "packed fingering is under a third of GingoFingering");
+        GingoChord cm("CM");
+        GingoPackedFingering pk[4];
+        GingoFingering full[4];
+        uint8_t np = guitar.fingerings(cm, pk, 4);
+        uint8_t nf = guitar.fingerings(cm, full, 4);
+        bool same = (np == nf && np == 4);
+        for (uint8_t i = 0; same && i < np; i++) {
+            GingoFingering u;
+            guitar.unpack(pk[i], u);
+            same = u.score == full[i].score && u.baseFret == full[i].baseFret &&
+                   u.numNotes == full[i].numNotes &&
+                   memcmp(u.strings, full[i].strings, sizeof(u.strings)) == 0 &&
+                   memcmp(u.midiNotes, full[i].midiNotes, u.numNotes) == 0 &&
+                   strcmp(u.chordName.c_str(), "CM") == 0;
+        }
+        CHECK(same, "packed results unpack to the GingoFingering results");
+        CHECK(pk[0].isMuted(0) && pk[0].fret(1) == 3 && pk[0].fret(2) == 2 && pk[0].fret(3) == 0,
+              "packed CM x320..: muted flag and frets");
+
+        char name[16];
+        GingoPackedFingering b7;
+        CHECK(guitar.fingerings(GingoChord("Bb7"), &b7, 1) == 1, "Bb7 packed fingering");
+        CHECK(strcmp(b7.chordName(name, sizeof(name)), "A#7") == 0, "packed name derived lazily");
+        GingoPackedFingering x320xx;
+        const uint8_t M = GingoPackedFingering::MUTED;
+        const uint8_t bytes[6] = { M, 3, 2, 0, M, M };
+        memcpy(x320xx.frets, bytes, 6);
+        x320xx.numStrings = 6;
+        CHECK(guitar.identify(x320xx, name, sizeof(name)) && strcmp(name, "CM") == 0,
+              "identify accepts packed frets");
+    }
+
+    // Extended-range instruments
+    {
+        GingoFretboard bass = GingoFretboard::bass();
+        CHECK(bass.numStrings() == 4 && bass.openMidi(0) == 28, "bass E1 = MIDI 28");
+        CHECK(GingoFretboard::bass5().openMidi(0) == 23, "5-string bass low B0");
+        CHECK(GingoFretboard::bass6().openMidi(5) == 48, "6-string bass high C3");
+#if GINGODUINO_MAX_STRINGS >= 8
+        GingoFretboard eight = GingoFretboard::eightString();
+        CHECK(eight.numStrings() == 8 && eight.openMidi(0) == 30, "8-string low F#1");
+        GingoPackedFingering e8[2];
+        uint8_t n8 = eight.fingerings(GingoChord("Em"), e8, 2);
+        uint16_t pcs = 0;
+        for (uint8_t s = 0; n8 && s < 8; s++) {
+            if (!e8[0].isMuted(s)) pcs |= (uint16_t)(1u << ((eight.openMidi(s) + e8[0].fret(s)) % 12));
+        }
+        CHECK(n8 == 2 && e8[0].numStrings == 8 && pcs == ((1u << 4) | (1u << 7) | (1u << 11)),
+              "8-string Em fingering covers E G B");
+#endif
+#if GINGODUINO_MAX_STRINGS >= 12
+        const uint8_t twelve[12] = { 40, 52, 45, 57, 50, 62, 55, 67, 59, 59, 64, 64 };
+        GingoFretboard g12("12-string", twelve, 12);
+        GingoFretPos p12[4];
+        CHECK(g12.numStrings() == 12 && g12.positions(GingoNote("E"), p12, 4) == 4,
+              "12-string board keeps all courses");
+        GingoPackedFingering f12;
+        CHECK(g12.fingerings(GingoChord("GM"), &f12, 1) == 1 && f12.numStrings == 12,
+              "12-string GM fingering");
+#endif
+    }
+
+#if GINGODUINO_HAS_FINGERING_CACHE
+    // Fingering cache: hits return the same fingerings as a fresh search
+    {
+        GingoFingeringCache cache;
+        GingoFretboard cached = GingoFretboard::guitar();
+        cached.setCache(&cache);
+        GingoChord cm("CM");
+        GingoFingering ref[3], a[3], b[3];
+        uint8_t nr = guitar.fingerings(cm, ref, 3);
+        uint8_t na = cached.fingerings(cm, a, 3);
+        uint8_t nb = cached.fingerings(cm, b, 3);
+        CHECK(cache.misses() == 1 && cache.hits() == 1, "cache: first miss, then hit");
+        bool same = (na == nr && nb == nr);
+        for (uint8_t i = 0; same && i < nr; i++) {
+            same = memcmp(ref[i].strings, b[i].strings, sizeof(ref[i].strings)) == 0 &&
+                   ref[i].score == b[i].score && ref[i].baseFret == b[i].baseFret &&
+                   ref[i].numNotes == b[i].numNotes &&
+                   memcmp(ref[i].midiNotes, b[i].midiNotes, ref[i].numNotes) == 0 &&
+                   strcmp(ref[i].chordName.c_str(), b[i].chordName.c_str()) == 0;
+        }
+        CHECK(same, "cache hit unpacks identical fingerings");
+
+        GingoFingering big[GINGODUINO_FINGERING_CACHE_DEPTH];
+        cached.fingerings(cm, big, GINGODUINO_FINGERING_CACHE_DEPTH);
+        CHECK(cache.misses() == 2, "cache: larger request re-runs the search");
+
+        GingoFretboard capo3 = cached.capo(3);
+        capo3.fingerings(cm, a, 1);
+        CHECK(cache.misses() == 3, "cache: capo is part of the key");
+        GingoFretboard dropped = cached;
+        dropped.setString(0, 38);
+        dropped.fingerings(cm, a, 1);
+        CHECK(cache.misses() == 4, "cache: tuning is part of the key");
+
+        // LRU: touching CM keeps it while the oldest entry is evicted
+        cache.clear();
+        const uint8_t cap = GingoFingeringCache::CAPACITY;
+        const char* names[] = { "DM", "EM", "FM", "GM", "AM", "BM", "Cm", "Dm", "Em", "Fm", "Gm" };
+        for (uint8_t i = 0; i + 1 < cap; i++) {
+            cached.fingerings(GingoChord(names[i % 11]), a, 1);
+            cached.fingerings(cm, a, 1);
+        }
+        CHECK(cache.size() == cap, "cache full");
+        cached.fingerings(GingoChord(names[(cap - 1) % 11]), a, 1);
+        uint32_t misses = cache.misses();
+        cached.fingerings(cm, a, 1);
+        CHECK(cache.misses() == misses, "cache: recently used entry survives eviction");
+        cached.fingerings(GingoChord(names[0]), a, 1);   // oldest: evicted
+        CHECK(cache.misses() == misses + 1, "cache: least recently used entry evicted");
+    }
+#endif
+
     // Identify from fret positions
     uint8_t frets[6] = { 255, 0, 2, 2, 1, 0 };  // x02210 = Am
     char chordName[16];
     bool identified = guitar.identify(frets, 6, chordName, sizeof(chordName));
-    if (identified) {
-        printf("         x02210 identified as: %s\n", chordName);
+    CHECK(identified && strcmp(chordName, "Am") == 0, "x02210 identified as Am (doubled tones)");
+    {
+        const uint8_t cOverE[6] = { 0, 3, 2, 0, 1, 0 };     // 032010
+        CHECK(guitar.identify(cOverE, 6, chordName, sizeof(chordName)) &&
+              strcmp(chordName, "CM/E") == 0, "032010 identified as CM/E");
+        const uint8_t g7[6] = { 3, 2, 0, 0, 0, 1 };         // 320001
+        CHECK(guitar.identify(g7, 6, chordName, sizeof(chordName)) &&
+              strcmp(chordName, "G7") == 0, "320001 identified as G7");
+        const uint8_t am7[6] = { 255, 0, 2, 0, 1, 0 };      // x02010
+        ChordMatch alts[4];
+        uint8_t na = guitar.identify(am7, 6, alts, 4);
+        CHECK(na >= 2 && strcmp(alts[0].name.c_str(), "Am7") == 0 &&
+              strcmp(alts[1].name.c_str(), "C6/A") == 0, "x02010: Am7, then C6/A");
+        const uint8_t muted[6] = { 255, 255, 255, 255, 255, 255 };
+        CHECK(!guitar.identify(muted, 6, chordName, sizeof(chordName)), "all muted: no chord");
+        GingoFretboard capo2 = guitar.capo(2);
+        CHECK(capo2.identify(frets, 6, chordName, sizeof(chordName)) &&
+              strcmp(chordName, "Bm") == 0, "capo 2 x02210 = Bm");
     }
 
     // Capo
@@ -913,6 +1499,9 @@ void testFieldDeduce() {
         CHECK(n > 0, "deduce notes returns results");
         CHECK(results[0].matched == 4, "C/E/G/A: top match=4");
         CHECK(strcmp(results[0].tonicName, "C") == 0, "C/E/G/A: tonic=C");
+        FieldMatch copy = results[0];
+        GingoField::deduce(items, 2, results, 10);
+        CHECK(strcmp(copy.tonicName, "C") == 0, "FieldMatch owns its tonic name");
     }
 
     // Deduce ordering: higher match count first
@@ -930,9 +1519,9 @@ void testFieldDeduce() {
         const char* items[] = {"CM", "G7"};
         FieldMatch results[5];
         uint8_t n = GingoField::deduce(items, 2, results, 5);
-        CHECK(n > 0, "deduce CM/G7 returns results");
+        CHECK(n > 0 && n <= 5, "deduce CM/G7 returns results");
         // Find the C major result
-        for (uint8_t i = 0; i < n; i++) {
+        for (uint8_t i = 0; i < n && i < 5; i++) {
             if (strcmp(results[i].tonicName, "C") == 0 &&
                 results[i].scaleType == SCALE_MAJOR) {
                 CHECK(results[i].roleCount == 2, "CM/G7 in C major: 2 roles");
@@ -1053,6 +1642,77 @@ void testTree() {
     CHECK(htMin.isValid("V7 / I", "Im") == true, "V7/I→Im valid in HT minor");
 }
 
+static uint16_t holdOnly(uint8_t from, uint8_t to, void* ctx) {
+    (void)ctx;
+    return from == to ? 0 : 100;
+}
+
+void testHarmonize() {
+    printf("\n=== GingoTree::harmonize ===\n");
+
+    GingoTree ht("C", SCALE_MAJOR, 0);
+    GingoSequence melody;
+    const char* notes[] = { "C", "E", "G", "C",  "F", "A", "C", "A",
+                            "G", "B", "D", "F",  "E", "D", "C", "C" };
+    for (uint8_t i = 0; i < 16; i++) {
+        melody.add(GingoEvent::noteEvent(GingoNote(notes[i]), GingoDuration("quarter"), 5));
+    }
+
+    // A chord per bar
+    {
+        HarmonyStep out[8];
+        uint16_t n = ht.harmonize(melody, GingoDuration(1, 1), out, 8);
+        CHECK(n == 4, "harmonize: one step per bar");
+        CHECK(strcmp(out[1].branch, "IV") == 0 && strcmp(out[1].chord, "FM") == 0 &&
+              strcmp(out[2].branch, "V7") == 0 && strcmp(out[2].chord, "G7") == 0 &&
+              strcmp(out[3].branch, "I") == 0 && out[3].branchId == GingoTree::findBranch("I"),
+              "harmonize: IV - V7 - I under the melody");
+        CHECK(out[0].misses == 0 && out[1].misses == 0 && out[2].misses == 0 && out[3].misses == 1,
+              "harmonize: melody notes outside the chords");
+    }
+
+    // A chord per beat follows the tree
+    {
+        HarmonyStep out[16];
+        uint16_t n = ht.harmonize(melody, GingoDuration("quarter"), out, 16);
+        bool follows = n == 16;
+        uint8_t misses = 0;
+        for (uint16_t i = 0; i < n; i++) {
+            misses += out[i].misses;
+            if (i > 0 && out[i].branchId != out[i - 1].branchId &&
+                !ht.isValid(out[i - 1].branch, out[i].branch)) follows = false;
+        }
+        CHECK(follows && misses == 0, "harmonize: per beat, tree moves only, every note in its chord");
+        CHECK(strcmp(out[0].branch, "I") == 0 && strcmp(out[15].branch, "I") == 0,
+              "harmonize: starts and ends on the tonic");
+        CHECK(ht.harmonize(melody, GingoDuration("quarter"), out, 5) == 5, "harmonize: capped by output");
+    }
+
+    // Pitch-class masks and a custom transition cost
+    {
+        const uint16_t masks[] = { 0x091, 0x000, 0x880, 0x091 };   // C E G, rest, G B, C E G
+        HarmonyStep out[4];
+        uint16_t n = ht.harmonize(masks, 4, out, 4);
+        CHECK(n == 4 && out[2].misses == 0 && strcmp(out[3].chord, "CM") == 0,
+              "harmonize: from pitch-class masks");
+        n = ht.harmonize(masks, 4, out, 4, holdOnly, nullptr);
+        CHECK(n == 4 && out[0].branchId == out[1].branchId && out[1].branchId == out[3].branchId,
+              "harmonize: custom cost holds the chord");
+        CHECK(ht.harmonize(masks, 0, out, 4) == 0 && ht.harmonize(GingoSequence(), GingoDuration("quarter"), out, 4) == 0,
+              "harmonize: empty input");
+    }
+
+    // Minor key
+    {
+        GingoTree am("A", SCALE_NATURAL_MINOR, 0);
+        const uint16_t masks[] = { 0x211, 0x210, 0x014, 0x211 };   // A C E, A E, D E, A C E
+        HarmonyStep out[4];
+        uint16_t n = am.harmonize(masks, 4, out, 4);
+        CHECK(n == 4 && strcmp(out[0].branch, "Im") == 0 && strcmp(out[0].chord, "Am") == 0 &&
+              strcmp(out[3].branch, "Im") == 0, "harmonize: minor tonic");
+    }
+}
+
 // =====================================================================
 // Progression
 // =====================================================================
@@ -1250,6 +1910,11 @@ void testChordComparison() {
         CHECK(strcmp(r, "R") == 0, "transformationName R");
         const char* none = GingoChordComparison::transformationName(NEO_NONE);
         CHECK(strcmp(none, "") == 0, "transformationName NONE=\"\"");
+        char buf[4];
+        const char* rp = GingoChordComparison::transformationName(NEO_RP, buf, sizeof(buf));
+        CHECK(rp == buf && strcmp(buf, "RP") == 0, "transformationName RP into buffer");
+        GingoChordComparison::transformationName(NEO_RP, buf, 2);
+        CHECK(strcmp(buf, "R") == 0, "transformationName truncates to buffer");
     }
 
     // Forte interval vector: major triad should be {0,0,1,1,1,0}
@@ -1263,6 +1928,217 @@ void testChordComparison() {
         CHECK(cmp.interval_vector_a[4] == 1, "CM Forte iv[4]=1");
         CHECK(cmp.interval_vector_a[5] == 0, "CM Forte iv[5]=0");
     }
+
+    // Transposition of symmetric sets: smallest T_n
+    {
+        GingoChord caug("Caug"), eaug("Eaug"), cdim("Cdim7"), dbdim("Dbdim7"), gm("GM");
+        CHECK(GingoChordComparison::compute(caug, eaug).transposition == 0, "Caug/Eaug T0 (symmetric)");
+        CHECK(GingoChordComparison::compute(cdim, dbdim).transposition == 1, "Cdim7/Dbdim7 T1");
+        CHECK(GingoChordComparison::compute(gm, GingoChord("CM")).transposition == 5, "GM/CM T5");
+        CHECK(GingoChordComparison::compute(gm, GingoChord("Gm")).transposition == -1, "GM/Gm no T_n");
+        CHECK(GingoChordComparison::compute(GingoChord("CM"), GingoChord("Am")).voice_leading == 2,
+              "CM/Am voice_leading=2");
+        CHECK(GingoChordComparison::compute(GingoChord("G7"), GingoChord("C7M")).voice_leading == 3,
+              "G7/C7M voice_leading=3");
+    }
+
+    // Unknown formulas: empty pitch-class sets, T0 as before (no divide by zero)
+    {
+        GingoChord u1("C9"), u2("D9");
+        CHECK(u1.formulaIndex() == 255 && u2.formulaIndex() == 255, "C9/D9 have no formula");
+        CHECK(GingoChordComparison::compute(u1, u2).transposition == 0, "unknown chords compute T0");
+        CHECK(GingoChordComparison::compute(u1, u2, CMP_F_TRANSPOSITION).transposition == 0,
+              "unknown chords flags compute T0");
+        GingoChord pair[2] = { u1, u2 };
+        const uint8_t tdim[] = { CMP_TRANSPOSITION };
+        int8_t tm[4];
+        CHECK(GingoChordComparison::matrix(pair, 2, tdim, 1, tm) && tm[1] == 0 && tm[2] == 0,
+              "unknown chords matrix T0");
+    }
+
+    // All-pairs matrix agrees with compute() for every pair and dimension
+    {
+        static const char* const NAMES[] = {
+            "CM", "Dm", "Em", "FM", "GM", "Am", "Bdim", "G7", "A7", "D7",
+            "E7", "C7M", "Dm7", "Caug", "Ebdim7", "Fm6"
+        };
+        const uint8_t n = sizeof(NAMES) / sizeof(NAMES[0]);
+        GingoChord chords[n];
+        for (uint8_t i = 0; i < n; i++) chords[i] = GingoChord(NAMES[i]);
+
+        uint8_t dims[CMP_DIM_COUNT];
+        for (uint8_t d = 0; d < CMP_DIM_COUNT; d++) dims[d] = d;
+        static int8_t m[CMP_DIM_COUNT * n * n];
+        CHECK(GingoChordComparison::matrix(chords, n, dims, CMP_DIM_COUNT, m), "matrix of 16 chords");
+
+        uint16_t bad = 0;
+        for (uint8_t i = 0; i < n; i++) {
+            for (uint8_t j = 0; j < n; j++) {
+                GingoChordComparison c = GingoChordComparison::compute(chords[i], chords[j]);
+                int8_t commonIntervals = 0;
+                for (uint16_t mm = c.common_interval_mask; mm; mm &= (uint16_t)(mm - 1)) commonIntervals++;
+                const int8_t expect[CMP_DIM_COUNT] = {
+                    (int8_t)c.common_count, (int8_t)c.root_distance, c.root_direction,
+                    (int8_t)c.same_quality, (int8_t)c.same_size,
+                    commonIntervals,
+                    (int8_t)c.enharmonic, (int8_t)c.subset, (int8_t)c.inversion,
+                    c.transposition, c.voice_leading, (int8_t)c.transformation,
+                    (int8_t)c.same_interval_vector
+                };
+                for (uint8_t d = 0; d < CMP_DIM_COUNT; d++) {
+                    if (m[d * n * n + i * n + j] != expect[d]) bad++;
+                }
+            }
+        }
+        CHECK(bad == 0, "matrix matches compute() on all 13 dimensions");
+
+        // Selected dimensions only, in caller order
+        const uint8_t sel[] = { CMP_VOICE_LEADING, CMP_COMMON_COUNT };
+        int8_t m2[2 * n * n];
+        GingoChordComparison::matrix(chords, n, sel, 2, m2);
+        CHECK(m2[0 * n * n + 0 * n + 5] == 2, "matrix VL CM->Am = 2");
+        CHECK(m2[1 * n * n + 0 * n + 5] == 2, "matrix common CM/Am = 2");
+        CHECK(m2[1 * n * n + 7 * n + 0] == 1, "matrix common G7/CM = 1");
+
+        // Several column tiles, with a ragged last one and unknown chords:
+        // the tile kernels agree with dimension() for every pair
+        {
+            static const char* const TYPES[] = { "M", "m", "7", "m7", "7M", "dim7", "aug", "sus4", "9" };
+            const uint16_t N = 150;
+            static GingoChordProfile ps[N];
+            static int8_t big[CMP_DIM_COUNT * N * N];
+            for (uint16_t i = 0; i < N; i++) {
+                char name[16];
+                data::readChromaticName((uint8_t)((i * 7) % 12), name, sizeof(name));
+                strcat(name, TYPES[i % 9]);
+                ps[i] = GingoChordComparison::profile(GingoChord(name));
+            }
+            GingoChordComparison::matrix(ps, N, dims, CMP_DIM_COUNT, big);
+            uint32_t off = 0;
+            for (uint8_t d = 0; d < CMP_DIM_COUNT; d++)
+                for (uint16_t i = 0; i < N; i++)
+                    for (uint16_t j = 0; j < N; j++)
+                        if (big[((uint32_t)d * N + i) * N + j] !=
+                            GingoChordComparison::dimension(ps[i], ps[j], d)) off++;
+            CHECK(off == 0, "150-profile matrix matches dimension() on all 13 dimensions");
+        }
+
+        GingoChord tooMany[GINGODUINO_MAX_MATRIX_CHORDS + 1];
+        CHECK(!GingoChordComparison::matrix(tooMany, GINGODUINO_MAX_MATRIX_CHORDS + 1, sel, 2, m2),
+              "matrix rejects more than MAX_MATRIX_CHORDS");
+
+        // Profiles: per-chord data for corpus-sized batches
+        GingoChordProfile p = GingoChordComparison::profile(GingoChord("G7"));
+        CHECK(p.pc_mask == 0x08A4 && p.root == 7 && p.size == 4, "G7 profile mask/root/size");
+        CHECK(p.pcs[0] == 2 && p.pcs[3] == 11, "G7 profile pcs ascending");
+        CHECK(GingoChordComparison::dimension(p, p, CMP_ENHARMONIC) == 1, "dimension self enharmonic");
+        CHECK(GingoChordComparison::dimension(p, p, 200) == 0, "dimension unknown = 0");
+    }
+
+    // Selective compute: only the requested groups are filled
+    {
+        GingoChord cm("CM"), am("Am");
+        GingoChordComparison c = GingoChordComparison::compute(cm, am, CMP_F_OVERLAP | CMP_F_ROOT);
+        CHECK(c.common_count == 2 && c.common_pc == 0x011, "flags overlap: CM/Am common");
+        CHECK(c.root_distance == 3 && c.root_direction == -3, "flags root: CM/Am distance 3");
+        CHECK(c.voice_leading == 0 && c.transformation == NEO_NONE, "flags: VL/transform not computed");
+        CHECK(c.interval_vector_a[2] == 0 && !c.same_interval_vector, "flags: interval vectors not computed");
+
+        static const char* const NAMES[] = { "CM", "Am", "Em", "G7", "Bm7(b5)", "Caug", "Ebdim7", "F7M" };
+        const uint8_t n = sizeof(NAMES) / sizeof(NAMES[0]);
+        uint16_t bad = 0;
+        for (uint8_t i = 0; i < n; i++) {
+            for (uint8_t j = 0; j < n; j++) {
+                GingoChord a(NAMES[i]), b(NAMES[j]);
+                GingoChordComparison full = GingoChordComparison::compute(a, b);
+                GingoChordComparison o = GingoChordComparison::compute(a, b, CMP_F_OVERLAP);
+                GingoChordComparison q = GingoChordComparison::compute(a, b, CMP_F_QUALITY);
+                GingoChordComparison s = GingoChordComparison::compute(a, b, CMP_F_SET);
+                GingoChordComparison t = GingoChordComparison::compute(a, b, CMP_F_TRANSPOSITION);
+                GingoChordComparison v = GingoChordComparison::compute(a, b, CMP_F_VOICE_LEADING);
+                GingoChordComparison r = GingoChordComparison::compute(a, b, CMP_F_TRANSFORMATION);
+                GingoChordComparison iv = GingoChordComparison::compute(a, b, CMP_F_INTERVAL_VECTOR);
+                if (o.exclusive_a_pc != full.exclusive_a_pc || o.exclusive_b_pc != full.exclusive_b_pc) bad++;
+                if (q.same_quality != full.same_quality || q.same_size != full.same_size ||
+                    q.common_interval_mask != full.common_interval_mask) bad++;
+                if (s.subset != full.subset || s.inversion != full.inversion ||
+                    s.enharmonic != full.enharmonic) bad++;
+                if (t.transposition != full.transposition) bad++;
+                if (v.voice_leading != full.voice_leading) bad++;
+                if (r.transformation != full.transformation) bad++;
+                if (memcmp(iv.interval_vector_b, full.interval_vector_b, 6) != 0 ||
+                    iv.same_interval_vector != full.same_interval_vector) bad++;
+            }
+        }
+        CHECK(bad == 0, "each flag group matches the full compute()");
+
+        // Profile overload: formula-level quality, so aliases match
+        GingoChordProfile p1 = GingoChordComparison::profile(GingoChord("C7(9)"));
+        GingoChordProfile p2 = GingoChordComparison::profile(GingoChord("D7/9"));
+        GingoChordComparison pc = GingoChordComparison::compute(p1, p2, CMP_F_QUALITY | CMP_F_TRANSPOSITION);
+        CHECK(pc.same_quality, "profile compute: 7(9) and 7/9 same quality");
+        CHECK(pc.transposition == 2, "profile compute: C7(9) -> D7/9 T2");
+        CHECK(!GingoChordComparison::compute(GingoChord("C7(9)"), GingoChord("D7/9")).same_quality,
+              "chord compute keeps type-string quality");
+    }
+
+    // Voicing-to-voicing voice leading (MIDI, with register and doubling)
+    {
+        const uint8_t c[] = { 48, 64, 67, 72 }, g7[] = { 47, 62, 65, 67 };
+        VoiceMove m[GINGODUINO_MAX_VOICES];
+        CHECK(GingoChordComparison::voiceLeading(c, 4, g7, 4, m, 4) == 10, "C -> G7 voicing: 10 semitones");
+        CHECK(m[0].from == 0 && m[0].to == 0 && m[0].motion == -1, "C -> G7: bass 48 -> 47");
+        CHECK(m[3].from == 3 && m[3].to == 3 && m[3].motion == -5, "C -> G7: top 72 -> 67");
+
+        // Unsorted input keeps caller indices
+        const uint8_t a[] = { 67, 60, 64 }, b[] = { 65, 60, 69 };
+        CHECK(GingoChordComparison::voiceLeading(a, 3, b, 3, m, 3) == 3, "CM -> FM/C: 0+1+2");
+        CHECK(m[0].from == 1 && m[0].to == 1 && m[0].motion == 0, "CM -> FM/C: C holds");
+        CHECK(m[2].from == 0 && m[2].to == 2 && m[2].motion == 2, "CM -> FM/C: G -> A");
+
+        // 3 -> 4 doubles a voice, 4 -> 3 merges two
+        const uint8_t triad[] = { 60, 64, 67 }, seventh[] = { 60, 64, 67, 70 };
+        CHECK(GingoChordComparison::voiceLeading(triad, 3, seventh, 4, m, 4) == 3, "C -> C7: G splits to Bb");
+        CHECK(m[3].from == 2 && m[3].to == 3 && m[3].motion == 3, "C -> C7: G doubled onto Bb");
+        CHECK(m[2].from == 2 && m[2].to == 2, "C -> C7: doubled source adjacent, lower target first");
+        CHECK(GingoChordComparison::voiceLeading(seventh, 4, triad, 3, m, 4) == 3, "C7 -> C: Bb merges to G");
+        CHECK(GingoChordComparison::voiceLeading(triad, 3, seventh, 4, 0, 0) == 3, "null output ok");
+
+        CHECK(GingoChordComparison::voiceLeading(triad, 0, seventh, 4, m, 4) == -1, "empty voicing = -1");
+        uint8_t many[GINGODUINO_MAX_VOICES + 1] = { 0 };
+        CHECK(GingoChordComparison::voiceLeading(many, GINGODUINO_MAX_VOICES + 1, triad, 3, m, 4) == -1,
+              "too many voices = -1");
+
+        // Brute force over every surjective pairing of the larger voicing
+        uint32_t seed = 12345;
+        uint16_t bad = 0;
+        for (uint16_t t = 0; t < 300; t++) {
+            uint8_t x[5], y[5];
+            seed = seed * 1103515245u + 12345u; const uint8_t nx = (uint8_t)(1 + (seed >> 16) % 5);
+            seed = seed * 1103515245u + 12345u; const uint8_t ny = (uint8_t)(1 + (seed >> 16) % 5);
+            for (uint8_t i = 0; i < nx; i++) { seed = seed * 1103515245u + 12345u; x[i] = (uint8_t)(40 + (seed >> 16) % 40); }
+            for (uint8_t i = 0; i < ny; i++) { seed = seed * 1103515245u + 12345u; y[i] = (uint8_t)(40 + (seed >> 16) % 40); }
+            const uint8_t* L = nx >= ny ? x : y; const uint8_t* S = nx >= ny ? y : x;
+            const uint8_t p = nx >= ny ? nx : ny, q = nx >= ny ? ny : nx;
+            uint32_t combos = 1;
+            for (uint8_t i = 0; i < p; i++) combos *= q;
+            int16_t best = 32767;
+            for (uint32_t k = 0; k < combos; k++) {
+                uint32_t code = k; uint16_t used = 0; int16_t sum = 0;
+                for (uint8_t i = 0; i < p; i++) {
+                    uint8_t j = (uint8_t)(code % q); code /= q;
+                    used |= (uint16_t)(1u << j);
+                    sum = (int16_t)(sum + (L[i] > S[j] ? L[i] - S[j] : S[j] - L[i]));
+                }
+                if (used == (1u << q) - 1 && sum < best) best = sum;
+            }
+            int16_t got = GingoChordComparison::voiceLeading(x, nx, y, ny, m, GINGODUINO_MAX_VOICES);
+            int16_t moved = 0;
+            for (uint8_t i = 0; i < p; i++) moved = (int16_t)(moved + (m[i].motion < 0 ? -m[i].motion : m[i].motion));
+            if (got != best || moved != got) bad++;
+        }
+        CHECK(bad == 0, "voiceLeading optimal vs brute force (300 random voicings)");
+    }
 }
 
 // =====================================================================
@@ -1574,6 +2450,767 @@ void testMIDI2() {
 
 }
 
+// =====================================================================
+// Profile probes (GINGODUINO_PROFILE=1 builds only)
+// =====================================================================
+
+#if GINGODUINO_PROFILE
+static uint32_t fakeCycles_ = 0;
+static uint32_t fakeCounter_() { return fakeCycles_ += 10; }
+
+void testProfile() {
+    printf("\n=== GingoProfile ===\n");
+
+    GingoProfile::reset();
+    GingoProfile::setCounter(fakeCounter_);
+
+    GingoNote notes[3] = { GingoNote("C"), GingoNote("E"), GingoNote("G") };
+    char name[16];
+    GingoChord::identify(notes, 3, name, sizeof(name));
+    GingoChord::identify(notes, 3, name, sizeof(name));
+    const GingoProbeStats& id = GingoProfile::stats(PROBE_CHORD_IDENTIFY);
+    CHECK(id.count == 2, "profile: identify counted twice");
+    CHECK(id.total >= 20 && id.max >= 10 && id.max <= id.total, "profile: identify cycles accumulated");
+    CHECK(GingoProfile::stats(PROBE_PGM_STR).count > 0, "profile: nested PROGMEM reads counted");
+
+    GingoTree tree("C", SCALE_MAJOR);
+    tree.isValid("IIm", "V7");
+    CHECK(GingoProfile::stats(PROBE_TREE_FIND_BRANCH).count == 2, "profile: isValid looks up two branches");
+    CHECK(GingoProfile::stats(PROBE_TREE_HAS_EDGE).count == 1, "profile: isValid checks one edge");
+
+    GingoMonitor mon;
+    mon.noteOn(0, 60, 100);
+    CHECK(GingoProfile::stats(PROBE_MONITOR_ANALYSE).count == 1, "profile: noteOn runs analyse once");
+
+    CHECK(strcmp(GingoProfile::probeName(PROBE_FIELD_DEDUCE), "field.deduce") == 0, "profile: probe name");
+    CHECK(strcmp(GingoProfile::probeName(200), "") == 0, "profile: unknown probe name");
+    CHECK(GingoProfile::stats(200).count == 0, "profile: unknown probe stats empty");
+
+    // Compact binary dump: header, then one 13-byte record per probe that ran
+    uint8_t buf[GingoProfile::DUMP_MAX];
+    uint16_t len = GingoProfile::dump(buf, sizeof(buf));
+    CHECK(len >= 6 + 13 && (len - 6) % 13 == 0, "profile: dump length");
+    CHECK(buf[0] == 'G' && buf[1] == 'P' && buf[2] == GingoProfile::DUMP_VERSION, "profile: dump magic/version");
+    CHECK(buf[4] == PROBE_COUNT && buf[5] == (len - 6) / 13, "profile: dump counts");
+    CHECK(buf[6] == PROBE_CHORD_IDENTIFY && buf[7] == 2 && buf[8] == 0, "profile: first record = identify, count 2 LE");
+    CHECK(GingoProfile::dump(buf, 8) == 0, "profile: dump rejects short buffer");
+
+    GingoProfile::reset();
+    CHECK(GingoProfile::stats(PROBE_CHORD_IDENTIFY).count == 0, "profile: reset clears");
+    CHECK(GingoProfile::dump(buf, sizeof(buf)) == 6, "profile: empty dump is header only");
+
+    // No counter: calls are still counted
+    GingoProfile::setCounter(nullptr);
+    GingoChord::identify(notes, 3, name, sizeof(name));
+    CHECK(GingoProfile::stats(PROBE_CHORD_IDENTIFY).count == 1 &&
+          GingoProfile::stats(PROBE_CHORD_IDENTIFY).total == 0, "profile: count-only without counter");
+    GingoProfile::reset();
+}
+#endif
+
+// =====================================================================
+// Synth
+// =====================================================================
+
+void testSynth() {
+    printf("\n=== GingoSynth ===\n");
+
+    // A4 sine: count rising zero crossings over one second
+    {
+        GingoSynth synth(8000);
+        GingoEnvelope env = { 0.0f, 0.0f, 1.0f, 0.01f };
+        synth.setEnvelope(env);
+        synth.noteOn(69, 127);
+        CHECK(synth.activeVoices() == 1, "synth: one voice after noteOn");
+        int16_t buf[8000];
+        synth.render(buf, 8000);
+        int crossings = 0;
+        int16_t peak = 0;
+        for (int i = 1; i < 8000; i++) {
+            if (buf[i - 1] < 0 && buf[i] >= 0) crossings++;
+            if (buf[i] > peak) peak = buf[i];
+        }
+        CHECK(crossings >= 439 && crossings <= 441, "synth: A4 sine is 440 Hz");
+        CHECK(peak > 7000 && peak <= 8192, "synth: full-velocity voice at gain 0.25");
+
+        synth.noteOff(69);
+        synth.render(buf, 160);
+        CHECK(synth.activeVoices() == 0, "synth: release reaches idle");
+        synth.render(buf, 16);
+        bool silent = true;
+        for (int i = 0; i < 16; i++) if (buf[i] != 0) silent = false;
+        CHECK(silent, "synth: silence after release");
+    }
+
+    // Velocity 0 is a release; stereo duplicates each frame
+    {
+        GingoSynth synth(8000);
+        synth.noteOn(60, 100);
+        int16_t st[64];
+        synth.render(st, 32, 2);
+        bool same = true;
+        for (int i = 0; i < 32; i++) if (st[2 * i] != st[2 * i + 1]) same = false;
+        CHECK(same, "synth: stereo frames interleaved");
+        synth.noteOn(60, 0);
+        synth.render(st, 32);
+        CHECK(synth.activeVoices() == 1, "synth: velocity 0 releases (still fading)");
+        synth.reset();
+        CHECK(synth.activeVoices() == 0, "synth: reset silences");
+    }
+
+    // Voice stealing: never more than VOICES, retrigger keeps one voice
+    {
+        GingoSynth synth(8000);
+        for (uint8_t i = 0; i < GingoSynth::VOICES + 3; i++) synth.noteOn(48 + i);
+        CHECK(synth.activeVoices() == GingoSynth::VOICES, "synth: steals beyond VOICES");
+        int16_t buf[32];
+        synth.render(buf, 32);
+        synth.allNotesOff();
+        synth.render(buf, 32);
+        synth.noteOn(48);
+        synth.noteOn(48);
+        CHECK(synth.activeVoices() == GingoSynth::VOICES, "synth: retrigger reuses the voice");
+    }
+
+    // Waveforms stay within full scale
+    {
+        GingoSynth synth(8000);
+        synth.setGain(1.0f);
+        bool ok = true;
+        const SynthWaveform waves[] = { WAVE_TRIANGLE, WAVE_SAW, WAVE_SQUARE };
+        for (uint8_t w = 0; w < 3; w++) {
+            synth.setWaveform(waves[w]);
+            synth.reset();
+            synth.noteOn(57, 127);
+            int16_t buf[400];
+            synth.render(buf, 400);
+            int16_t peak = 0;
+            for (int i = 0; i < 400; i++) if (buf[i] > peak) peak = buf[i];
+            if (peak < 20000) ok = false;
+        }
+        CHECK(ok && synth.waveform() == WAVE_SQUARE, "synth: triangle/saw/square render");
+    }
+
+    // Full-gain chord saturates instead of wrapping around
+    {
+        GingoSynth synth(8000);
+        synth.setGain(2.0f);
+        CHECK(synth.gain() == 1.0f, "synth: gain clamped to 1");
+        for (uint8_t v = 0; v < GingoSynth::VOICES; v++) synth.noteOn((uint8_t)(36 + v), 127);
+        int16_t buf[800];
+        synth.render(buf, 800);
+        int maxJump = 0;
+        bool clipped = false;
+        for (int i = 1; i < 800; i++) {
+            int d = buf[i] - buf[i - 1];
+            if (d < 0) d = -d;
+            if (d > maxJump) maxJump = d;
+            if (buf[i] == 32767 || buf[i] == -32768) clipped = true;
+        }
+        CHECK(clipped && maxJump < 16384, "synth: mix saturates");
+    }
+
+    // WAV header
+    {
+        GingoSynth synth(22050);
+        uint8_t h[GingoSynth::WAV_HEADER_SIZE];
+        CHECK(synth.wavHeader(h, 10, 100) == 0, "synth: wavHeader needs 44 bytes");
+        CHECK(synth.wavHeader(h, sizeof(h), 100, 2) == 44, "synth: wavHeader size");
+        CHECK(memcmp(h, "RIFF", 4) == 0 && memcmp(h + 8, "WAVEfmt ", 8) == 0 &&
+              memcmp(h + 36, "data", 4) == 0, "synth: wavHeader chunk ids");
+        uint32_t rate = h[24] | (h[25] << 8) | (h[26] << 16) | ((uint32_t)h[27] << 24);
+        uint32_t data = h[40] | (h[41] << 8) | (h[42] << 16) | ((uint32_t)h[43] << 24);
+        CHECK(rate == 22050 && h[22] == 2 && h[34] == 16 && data == 400,
+              "synth: wavHeader rate, channels, bits, data size");
+    }
+
+    // Sequence player: frame count from the tempo, release tail, done()
+    {
+        GingoSequence seq(GingoTempo(120), GingoTimeSig(4, 4));
+        seq.add(GingoEvent::noteEvent(GingoNote("C"), GingoDuration("quarter"), 4));
+        seq.add(GingoEvent::rest(GingoDuration("quarter")));
+        seq.add(GingoEvent::chordEvent(GingoChord("CM"), GingoDuration("half"), 4));
+        GingoSynth synth(8000);
+        GingoSequencePlayer player(seq, synth);
+        const uint32_t expected = 4000 + 4000 + 8000 + 1600 + GingoSynth::BLOCK;
+        CHECK(player.totalFrames() == expected, "player: totalFrames from tempo + tail");
+
+        int16_t buf[300];
+        uint32_t total = 0;
+        uint8_t maxVoices = 0;
+        uint16_t n;
+        while ((n = player.render(buf, 300)) > 0) {
+            total += n;
+            if (synth.activeVoices() > maxVoices) maxVoices = synth.activeVoices();
+        }
+        CHECK(total == expected && player.position() == expected, "player: renders totalFrames");
+        CHECK(player.done() && synth.activeVoices() == 0, "player: done and silent");
+        CHECK(maxVoices == 3, "player: chord sounds three voices");
+
+        player.rewind();
+        CHECK(!player.done() && player.position() == 0, "player: rewind");
+        CHECK(player.render(buf, 100) == 100 && synth.activeVoices() == 1, "player: first note after rewind");
+    }
+}
+
+// =====================================================================
+// Pitch
+// =====================================================================
+
+struct PitchLog {
+    GingoPitchEvent events[16];
+    uint8_t count;
+};
+
+static void logPitch(const GingoPitchEvent& e, void* ctx) {
+    PitchLog* log = (PitchLog*)ctx;
+    if (log->count < 16) log->events[log->count++] = e;
+}
+
+/// Sine at freq into buf, continuing from phase (cycles).
+static void pitchSine(int16_t* buf, uint16_t n, float freq, uint32_t sr, float& phase, float amp) {
+    for (uint16_t i = 0; i < n; i++) {
+        buf[i] = (int16_t)(amp * 32767.0f * sinf(2.0f * 3.14159265f * phase));
+        phase += freq / sr;
+        if (phase >= 1.0f) phase -= 1.0f;
+    }
+}
+
+void testPitch() {
+    printf("\n=== GingoPitch ===\n");
+    static int16_t buf[256];
+
+    // A4 sine: note-on, cents, latency
+    {
+        static GingoPitch pitch(44100);
+        PitchLog log = {};
+        pitch.onPitch(logPitch, &log);
+        float ph = 0.0f;
+        for (int b = 0; b < 40; b++) {
+            pitchSine(buf, 256, 440.0f, 44100, ph, 0.5f);
+            pitch.process(buf, 256);
+        }
+        CHECK(log.count == 1 && log.events[0].type == PITCH_NOTE_ON &&
+              log.events[0].midiNum == 69, "pitch: A4 note-on");
+        CHECK(pitch.note() == 69 && pitch.voiced(), "pitch: A4 held");
+        CHECK(fabsf(pitch.frequency() - 440.0f) < 0.5f && pitch.cents() >= -1 && pitch.cents() <= 1,
+              "pitch: A4 frequency and cents");
+        CHECK(log.events[0].frame <= GingoPitch::WINDOW + 3 * GingoPitch::HOP,
+              "pitch: note-on within window + 3 hops");
+        CHECK(log.events[0].velocity > 100 && pitch.clarity() > 0.9f, "pitch: velocity and clarity");
+
+        // Silence releases the note
+        memset(buf, 0, sizeof(buf));
+        for (int b = 0; b < 8; b++) pitch.process(buf, 256);
+        CHECK(log.count == 2 && log.events[1].type == PITCH_NOTE_OFF &&
+              log.events[1].midiNum == 69 && pitch.note() == 0xFF, "pitch: silence releases");
+    }
+
+    // Detuned: +25 cents stays on the note and reports the deviation
+    {
+        static GingoPitch pitch(44100);
+        float ph = 0.0f;
+        const float f = 440.0f * powf(2.0f, 25.0f / 1200.0f);
+        for (int b = 0; b < 40; b++) {
+            pitchSine(buf, 256, f, 44100, ph, 0.3f);
+            pitch.process(buf, 256);
+        }
+        CHECK(pitch.note() == 69 && pitch.cents() >= 23 && pitch.cents() <= 27, "pitch: +25 cents on A4");
+    }
+
+    // Note change and monitor forwarding, stereo input
+    {
+        static GingoPitch pitch(48000);
+        GingoMonitor mon;
+        PitchLog log = {};
+        pitch.onPitch(logPitch, &log);
+        pitch.setMonitor(&mon);
+        float ph = 0.0f;
+        static int16_t st[512];
+        for (int b = 0; b < 60; b++) {
+            pitchSine(buf, 256, b < 30 ? 261.63f : 329.63f, 48000, ph, 0.4f);
+            for (int i = 0; i < 256; i++) st[2 * i] = st[2 * i + 1] = buf[i];
+            pitch.process(st, 256, 2);
+            if (b == 29) CHECK(mon.activeNoteCount() == 1, "pitch: monitor holds C4");
+        }
+        CHECK(log.count == 3 && log.events[0].midiNum == 60 &&
+              log.events[1].type == PITCH_NOTE_OFF && log.events[1].midiNum == 60 &&
+              log.events[2].type == PITCH_NOTE_ON && log.events[2].midiNum == 64,
+              "pitch: C4 -> E4 (stereo, stride 2)");
+        CHECK(mon.activeNoteCount() == 1, "pitch: monitor follows the change");
+    }
+
+    // Band-limited saw from the synth: no octave error
+    {
+        static GingoSynth synth(44100);
+        static GingoPitch pitch(44100);
+        synth.setWaveform(WAVE_SAW);
+        synth.noteOn(45, 100);   // A2, 110 Hz
+        for (int b = 0; b < 40; b++) {
+            synth.render(buf, 256);
+            pitch.process(buf, 256);
+        }
+        CHECK(pitch.note() == 45 && fabsf(pitch.frequency() - 110.0f) < 0.5f, "pitch: saw A2");
+    }
+
+    // Quiet input stays under the gate
+    {
+        static GingoPitch pitch(44100);
+        PitchLog log = {};
+        pitch.onPitch(logPitch, &log);
+        float ph = 0.0f;
+        for (int b = 0; b < 40; b++) {
+            pitchSine(buf, 256, 440.0f, 44100, ph, 0.001f);
+            pitch.process(buf, 256);
+        }
+        CHECK(log.count == 0 && !pitch.voiced(), "pitch: -60 dBFS under the gate");
+        pitch.setGate(-70.0f);
+        for (int b = 0; b < 40; b++) {
+            pitchSine(buf, 256, 440.0f, 44100, ph, 0.001f);
+            pitch.process(buf, 256);
+        }
+        CHECK(log.count == 1 && log.events[0].midiNum == 69, "pitch: lower gate detects it");
+    }
+
+    // Range limits
+    {
+        static GingoPitch pitch(48000);
+        pitch.setRange(10.0f, 20000.0f);
+        CHECK(pitch.minFrequency() >= 48000.0f / GingoPitch::MAX_LAG - 0.01f, "pitch: range clamped to MAX_LAG");
+        CHECK(pitch.maxFrequency() <= 24000.0f, "pitch: shortest lag 2");
+    }
+}
+
+// ---------------------------------------------------------------------------
+// GingoChroma
+// ---------------------------------------------------------------------------
+
+struct ChromaLog {
+    char    chords[8][16];
+    uint8_t chordCount;
+    char    field[4];
+    uint8_t fieldCount;
+};
+
+// Copy up to size - 1 characters and always terminate.
+static void copyLogName(char* dst, size_t size, const char* src) {
+    size_t i = 0;
+    for (; src[i] && i + 1 < size; i++) dst[i] = src[i];
+    dst[i] = '\0';
+}
+
+static void logChromaChord(const GingoChord& c, void* ctx) {
+    ChromaLog* log = (ChromaLog*)ctx;
+    if (log->chordCount < 8) {
+        copyLogName(log->chords[log->chordCount], sizeof(log->chords[0]), c.name());
+    }
+    log->chordCount++;
+}
+
+static void logChromaField(const GingoField& f, void* ctx) {
+    ChromaLog* log = (ChromaLog*)ctx;
+    copyLogName(log->field, sizeof(log->field), f.tonic().name());
+    log->fieldCount++;
+}
+
+// Render a chord from the synth into the analyser for ms milliseconds.
+static void chromaPlay(GingoSynth& synth, GingoChroma& chroma, const uint8_t* notes,
+                       uint8_t count, uint16_t ms, uint8_t stride = 1) {
+    static int16_t buf[2 * 256];
+    synth.allNotesOff();
+    for (uint8_t i = 0; i < count; i++) synth.noteOn(notes[i], 100);
+    const uint32_t frames = (uint32_t)synth.sampleRate() * ms / 1000;
+    for (uint32_t f = 0; f < frames; f += 256) {
+        synth.render(buf, 256, stride);
+        chroma.process(buf, 256, stride);
+    }
+}
+
+void testChroma() {
+    printf("\n=== GingoChroma ===\n");
+
+    // Matching on a given chroma: same pitch classes, bass decides
+    {
+        float am7[12] = {};
+        am7[9] = 1.0f; am7[0] = 0.8f; am7[4] = 0.9f; am7[7] = 0.7f;   // A C E G
+        ChromaChordMatch m[3];
+        CHECK(GingoChroma::matchChords(am7, 9, m, 3) == 3 && strcmp(m[0].name.c_str(), "Am7") == 0,
+              "chroma: Am7 with bass A");
+        CHECK(GingoChroma::matchChords(am7, 0, m, 3) == 3 && strcmp(m[0].name.c_str(), "C6") == 0 &&
+              m[0].root == 0 && m[0].score > 0.9f, "chroma: same set with bass C reads C6");
+        CHECK(m[0].score >= m[1].score && m[1].score >= m[2].score, "chroma: matches sorted");
+
+        float flat[12];
+        for (uint8_t i = 0; i < 12; i++) flat[i] = 0.5f;
+        CHECK(GingoChroma::matchChords(flat, 255, m, 3) == 0, "chroma: flat vector has no chord");
+    }
+
+    // Key profiles
+    {
+        const uint8_t cMajor[] = { 0, 2, 4, 5, 7, 9, 11 };
+        const uint8_t aHarmonic[] = { 9, 11, 0, 2, 4, 5, 8 };
+        float c[12] = {}, a[12] = {};
+        for (uint8_t i = 0; i < 7; i++) {
+            c[cMajor[i]] = 1.0f;
+            a[aHarmonic[i]] = 1.0f;
+        }
+        c[0] = c[7] = 2.0f;    // tonic and dominant weigh more
+        a[9] = a[4] = 2.0f;
+        ChromaKeyMatch k[24];
+        CHECK(GingoChroma::matchKeys(c, k, 24) == 24 && k[0].tonic == 0 &&
+              k[0].scaleType == SCALE_MAJOR && strcmp(k[0].tonicName, "C") == 0, "chroma: C major key");
+        CHECK(GingoChroma::matchKeys(a, k, 1) == 1 && k[0].tonic == 9 &&
+              k[0].scaleType == SCALE_NATURAL_MINOR, "chroma: A minor key");
+    }
+
+    static GingoSynth synth(48000);
+    static GingoChroma chroma(48000);
+
+    // Synthesized chords through the analyser, monitor callback types
+    {
+        ChromaLog log = {};
+        GingoMonitor::ChordCallback cb = logChromaChord;   // same type as the monitor's
+        chroma.onChordDetected(cb, &log);
+        chroma.onFieldChanged(logChromaField, &log);
+        uint32_t hops = 0;
+        chroma.onChroma([&hops](const float*) { hops++; });
+        synth.setWaveform(WAVE_SAW);
+
+        const uint8_t g7[] = { 43, 55, 59, 62, 65 };
+        chromaPlay(synth, chroma, g7, 5, 400);
+        CHECK(log.chordCount == 1 && strcmp(log.chords[0], "G7") == 0 && chroma.hasChord() &&
+              strcmp(chroma.currentChord().name(), "G7") == 0, "chroma: saw G7 detected");
+        CHECK(chroma.bass() == 7 && chroma.chordScore() > 0.6f, "chroma: bass G, score");
+        CHECK(hops == chroma.hops() && hops == 400 * 48 / GingoChroma::HOP, "chroma: chroma callback per hop");
+
+        float peak = 0.0f;
+        for (uint8_t i = 0; i < 12; i++) if (chroma.chroma()[i] > peak) peak = chroma.chroma()[i];
+        CHECK(fabsf(peak - 1.0f) < 1e-6f && chroma.chroma()[1] < 0.2f, "chroma: normalized vector");
+
+        // Silence clears the chord without a callback
+        synth.allNotesOff();
+        chromaPlay(synth, chroma, g7, 0, 800);   // release tail, then silence
+        CHECK(!chroma.hasChord() && log.chordCount == 1 && chroma.chroma()[7] == 0.0f,
+              "chroma: silence clears the chord");
+    }
+
+    // Key from a progression, left channel of interleaved stereo
+    {
+        ChromaLog log = {};
+        chroma.reset();
+        chroma.onChordDetected(logChromaChord, &log);
+        chroma.onFieldChanged(logChromaField, &log);
+        chroma.onChroma(nullptr);
+        chroma.onChroma(std::function<void(const float*)>());
+        synth.setWaveform(WAVE_TRIANGLE);
+        const uint8_t c[] = { 48, 60, 64, 67 }, f[] = { 53, 57, 60, 65 },
+                      g7[] = { 43, 59, 62, 65 }, am[] = { 45, 57, 60, 64 };
+        for (uint8_t r = 0; r < 3; r++) {
+            chromaPlay(synth, chroma, c, 4, 500, 2);
+            chromaPlay(synth, chroma, am, 4, 500, 2);
+            chromaPlay(synth, chroma, f, 4, 500, 2);
+            chromaPlay(synth, chroma, g7, 4, 500, 2);
+        }
+        chromaPlay(synth, chroma, c, 4, 500, 2);
+        CHECK(log.chordCount == 13 && strcmp(log.chords[0], "CM") == 0 && strcmp(log.chords[1], "Am") == 0 &&
+              strcmp(log.chords[2], "FM") == 0 && strcmp(log.chords[3], "G7") == 0,
+              "chroma: C Am F G7 in order");
+        CHECK(chroma.hasField() && chroma.currentField().tonic().semitone() == 0 &&
+              chroma.currentField().scale().parent() == SCALE_MAJOR && strcmp(log.field, "C") == 0,
+              "chroma: key of C major");
+    }
+
+    // Gate and range
+    {
+        chroma.setGate(0.0f);
+        const uint8_t c[] = { 60, 64, 67 };
+        chromaPlay(synth, chroma, c, 3, 300);
+        CHECK(!chroma.hasChord() && chroma.bass() == 0xFF, "chroma: gate at 0 dBFS mutes");
+        chroma.setGate(-50.0f);
+        chroma.setRange(5.0f, 96000.0f);
+        CHECK(chroma.minFrequency() == 20.0f && chroma.maxFrequency() == 24000.0f, "chroma: range clamped");
+        chroma.setRange(100.0f, 4000.0f);
+    }
+}
+
+void testTuning() {
+    printf("\n=== GingoTuning ===\n");
+
+    // Default: 12-TET at 440
+    {
+        static GingoTuning t;
+        CHECK(fabsf(t.frequency(69) - 440.0f) < 0.001f && fabsf(t.frequency(60) - 261.6256f) < 0.01f,
+              "tuning: default is 12-TET A4 = 440");
+        CHECK(t.pitch725(60) == (60UL << 25) && t.pitch725(69) == (69UL << 25), "tuning: 12-TET pitch 7.25");
+        CHECK(t.degrees() == 12 && strcmp(t.description(), "12-TET") == 0 && t.mapped(0),
+              "tuning: default degrees and name");
+        CHECK(t.frequency(128) == 0.0f && fabsf(t.cents(64)) < 0.01f, "tuning: out of range, 0 cents");
+        t.setEqual(415.0f);
+        CHECK(fabsf(t.frequency(69) - 415.0f) < 0.001f && fabsf(t.cents(69) + 101.270f) < 0.05f,
+              "tuning: 12-TET at A4 = 415");
+    }
+
+    // Presets keep the tonic at 12-TET
+    {
+        static GingoTuning t(TUNING_JUST);
+        CHECK(fabsf(t.frequency(60) - 261.6256f) < 0.01f, "tuning: just tonic at 12-TET");
+        CHECK(fabsf(1200.0f * log2f(t.frequency(64) / t.frequency(60)) - 386.314f) < 0.01f &&
+              fabsf(t.frequency(67) / t.frequency(60) - 1.5f) < 0.0001f, "tuning: just 5/4 and 3/2");
+        CHECK(fabsf(t.frequency(72) / t.frequency(60) - 2.0f) < 0.0001f &&
+              fabsf(t.frequency(52) / t.frequency(48) - 1.25f) < 0.0001f, "tuning: just repeats each octave");
+        CHECK(labs((long)t.pitch725(64) - (long)(63.86314 * 33554432.0)) < 64, "tuning: just E pitch 7.25");
+
+        t.setPreset(TUNING_MEANTONE, 2);   // on D
+        CHECK(fabsf(t.cents(62)) < 0.01f && fabsf(t.cents(66) + 13.686f) < 0.01f &&
+              strcmp(t.description(), "1/4-comma meantone") == 0, "tuning: meantone on D");
+        t.setPreset(TUNING_MAQAM_RAST, 0);
+        CHECK(fabsf(t.cents(64) + 50.0f) < 0.01f && fabsf(t.cents(71) + 50.0f) < 0.01f &&
+              fabsf(t.cents(67)) < 0.01f, "tuning: Rast quarter-tone third and seventh");
+    }
+
+    // Scala: ratios, cents and comments; kbm with an unmapped key
+    {
+        static GingoTuning t;
+        const char* scl =
+            "! pentatonic.scl\r\n"
+            "!\r\n"
+            "Just pentatonic\r\n"
+            " 5\r\n"
+            "!\r\n"
+            " 9/8\r\n"
+            " 5/4\r\n"
+            " 701.955 cents\r\n"
+            " 5/3\r\n"
+            " 2\r\n";
+        CHECK(t.loadScala(scl) && t.degrees() == 5 && strcmp(t.description(), "Just pentatonic") == 0,
+              "tuning: .scl parsed");
+        CHECK(fabsf(t.frequency(60) - 261.6256f) < 0.01f &&
+              fabsf(t.frequency(63) / t.frequency(60) - 1.5f) < 0.0001f &&
+              fabsf(t.frequency(65) / t.frequency(60) - 2.0f) < 0.0001f &&
+              fabsf(t.frequency(59) / t.frequency(60) - 5.0f / 6.0f) < 0.0001f,
+              "tuning: .scl linear mapping on middle C");
+
+        const char* kbm =
+            "! 7 keys per octave on the white keys, A4 = 440\n"
+            "12\n0\n127\n60\n69\n440.0\n5\n"
+            "! mapping\n"
+            "0\nx\n1\nx\n2\n2\nx\n3\nx\n4\nx\n4\n";
+        CHECK(t.loadScala(scl, kbm), "tuning: .kbm parsed");
+        CHECK(fabsf(t.frequency(69) - 440.0f) < 0.001f && !t.mapped(61) && t.frequency(61) == 0.0f &&
+              t.pitch725(61) == (61UL << 25), "tuning: reference key and unmapped key");
+        CHECK(fabsf(t.frequency(67) / t.frequency(60) - 1.5f) < 0.0001f &&
+              fabsf(t.frequency(72) / t.frequency(60) - 2.0f) < 0.0001f, "tuning: .kbm degrees and period");
+
+        // Malformed text leaves the table alone
+        const float before = t.frequency(64);
+        CHECK(!t.loadScala("bad\n3\n9/8\nfoo\n2\n") && !t.loadScala("short\n3\n9/8\n") &&
+              !t.loadScala(scl, "12\n0\n127\n60\n61\n440\n0\n0\nx\n") &&
+              !t.loadScala("zero\n1\n0/1\n") && !t.loadScala(nullptr),
+              "tuning: malformed files rejected");
+        CHECK(t.frequency(64) == before && t.degrees() == 5, "tuning: table unchanged after a failure");
+    }
+
+    // Consumers: note and event queries, synth, MIDI 2.0
+    {
+        static GingoTuning t(TUNING_JUST);
+        CHECK(GingoNote("E").frequency(4, t) == t.frequency(64) && GingoNote("C").frequency(-2, t) == 0.0f,
+              "tuning: GingoNote::frequency(tuning)");
+        CHECK(GingoEvent::fromMIDI(67).frequency(t) == t.frequency(67) &&
+              GingoEvent::rest(GingoDuration("quarter")).frequency(t) == 0.0f,
+              "tuning: GingoEvent::frequency(tuning)");
+
+        GingoSynth synth(8000);
+        GingoEnvelope env = { 0.0f, 0.0f, 1.0f, 0.01f };
+        synth.setEnvelope(env);
+        static GingoTuning low;
+        low.setEqual(400.0f);
+        synth.setTuning(&low);
+        synth.noteOn(69, 127);
+        static int16_t buf[8000];
+        synth.render(buf, 8000);
+        int crossings = 0;
+        for (int i = 1; i < 8000; i++) if (buf[i - 1] < 0 && buf[i] >= 0) crossings++;
+        CHECK(synth.tuning() == &low && crossings >= 399 && crossings <= 401, "tuning: synth plays the table");
+        synth.setTuning(nullptr);   // retunes the sounding voice
+        synth.render(buf, 8000);
+        crossings = 0;
+        for (int i = 1; i < 8000; i++) if (buf[i - 1] < 0 && buf[i] >= 0) crossings++;
+        CHECK(crossings >= 439 && crossings <= 441, "tuning: synth retunes held notes");
+        synth.reset();
+
+        static GingoTuning pent;
+        pent.loadScala("p\n2\n3/2\n2\n", "12\n0\n127\n60\n60\n261.6256\n2\n0\nx\n");
+        synth.setTuning(&pent);
+        synth.noteOn(61, 100);
+        CHECK(synth.activeVoices() == 0, "tuning: synth ignores unmapped keys");
+
+        GingoUMP ump = GingoMIDI2::perNotePitch(t, 64, 1, 2);
+        CHECK(ump.wordCount == 2 && ump.words[0] == 0x41024003UL && ump.words[1] == t.pitch725(64),
+              "tuning: MIDI 2.0 per-note pitch");
+    }
+}
+
+// =====================================================================
+// GingoArpeggiator
+// =====================================================================
+
+struct ArpLog {
+    const GingoArpeggiator* arp;
+    uint8_t  note[64];
+    uint8_t  vel[64];
+    uint32_t at[64];
+    uint8_t  count;
+};
+
+static void arpRecord(uint8_t note, uint8_t vel, void* ctx) {
+    ArpLog* log = (ArpLog*)ctx;
+    if (log->count >= 64) return;
+    log->note[log->count] = note;
+    log->vel[log->count] = vel;
+    log->at[log->count] = log->arp->ticks();
+    log->count++;
+}
+
+void testArpeggiator() {
+    printf("\n=== GingoArpeggiator ===\n");
+
+    const uint8_t cmaj[] = { 67, 60, 64, 60 };
+
+    // Up: timing, gate and wrap-around
+    {
+        GingoArpeggiator arp;
+        ArpLog log = { &arp, {}, {}, {}, 0 };
+        arp.onNote(arpRecord, &log);
+        CHECK(arp.rate() == GingoArpeggiator::PPQN / 4 && arp.steps() == 0, "arp: defaults");
+        arp.setRate(GingoDuration("eighth"));
+        CHECK(arp.rate() == GingoArpeggiator::PPQN / 2, "arp: rate from a duration");
+        arp.setRate(24);
+        arp.setNotes(cmaj, 4);
+        CHECK(arp.steps() == 3 && arp.step(0) == 60 && arp.step(1) == 64 && arp.step(2) == 67 &&
+              arp.step(3) == 0xFF, "arp: notes sorted and deduplicated");
+        arp.tick(96);
+        CHECK(log.count == 8 && log.note[0] == 60 && log.vel[0] == 100 && log.at[0] == 0 &&
+              log.note[1] == 60 && log.vel[1] == 0 && log.at[1] == 12 &&
+              log.note[2] == 64 && log.at[2] == 24 && log.note[6] == 60 && log.at[6] == 72,
+              "arp: up, gate 0.5, wraps around");
+        CHECK(arp.ticks() == 96 && arp.playing() == 0xFF, "arp: clock position");
+    }
+
+    // Down and up-down over two octaves
+    {
+        GingoArpeggiator arp;
+        arp.setOctaves(2);
+        arp.setNotes(cmaj, 3);
+        CHECK(arp.steps() == 6 && arp.step(5) == 79, "arp: two octaves");
+        arp.setPattern(ARP_DOWN);
+        CHECK(arp.steps() == 6 && arp.step(0) == 79 && arp.step(5) == 60, "arp: down");
+        arp.setPattern(ARP_UP_DOWN);
+        CHECK(arp.steps() == 10 && arp.step(5) == 79 && arp.step(6) == 76 && arp.step(9) == 64,
+              "arp: up-down without repeated ends");
+    }
+
+    // Seeded random: reproducible, no immediate repeats
+    {
+        GingoArpeggiator arp;
+        ArpLog a = { &arp, {}, {}, {}, 0 };
+        arp.onNote(arpRecord, &a);
+        arp.setPattern(ARP_RANDOM);
+        arp.setSeed(1234);
+        arp.setRate(4);
+        arp.setNotes(cmaj, 3);
+        arp.tick(64);
+        uint8_t first[16];
+        bool repeats = false;
+        for (uint8_t i = 0; i < 16; i++) {
+            first[i] = a.note[2 * i];
+            if (i > 0 && first[i] == first[i - 1]) repeats = true;
+        }
+        arp.reset();
+        a.count = 0;
+        arp.tick(64);
+        bool same = a.count == 32;
+        for (uint8_t i = 0; i < 16 && same; i++) same = a.note[2 * i] == first[i];
+        CHECK(!repeats && same, "arp: seeded random repeats after reset");
+    }
+
+    // Chord tones and scale fill
+    {
+        GingoArpeggiator arp;
+        const uint8_t notes[] = { 60, 62, 64, 65, 67 };
+        arp.setNotes(notes, 5);
+        arp.setPattern(ARP_CHORD_TONES);
+        CHECK(arp.steps() == 5, "arp: chord tones without a chord plays everything");
+        arp.setChord(GingoChord("C"));
+        CHECK(arp.steps() == 3 && arp.step(0) == 60 && arp.step(1) == 64 && arp.step(2) == 67,
+              "arp: chord tones only");
+
+        const uint8_t ends[] = { 60, 67 };
+        arp.setNotes(ends, 2);
+        arp.setPattern(ARP_SCALE_FILL);
+        arp.setField(GingoField("C", SCALE_MAJOR));
+        CHECK(arp.steps() == 5 && arp.step(1) == 62 && arp.step(2) == 64 && arp.step(3) == 65,
+              "arp: scale fill C to G");
+        arp.setField(GingoField("C", SCALE_HARMONIC_MINOR));
+        CHECK(arp.steps() == 5 && arp.step(2) == 63, "arp: scale fill follows the field");
+    }
+
+    // Following a monitor: chord source, no restart on an unchanged set
+    {
+        GingoMonitor mon;
+        mon.noteOn(0, 48, 100);
+        mon.noteOn(0, 64, 100);
+        mon.noteOn(0, 67, 100);
+        GingoArpeggiator arp;
+        ArpLog log = { &arp, {}, {}, {}, 0 };
+        arp.onNote(arpRecord, &log);
+        arp.setSource(ARP_SOURCE_CHORD);
+        arp.setRate(24);
+        arp.follow(mon);
+        CHECK(mon.hasChord() && arp.steps() == 3 && arp.step(0) == 48 && arp.step(1) == 52 &&
+              arp.step(2) == 55, "arp: chord source from the monitor");
+        arp.tick(30);
+        arp.follow(mon);
+        arp.tick(24);
+        CHECK(log.count == 5 && log.note[2] == 52 && log.at[2] == 24 && log.note[4] == 55 && log.at[4] == 48,
+              "arp: unchanged follow keeps the pattern running");
+        mon.reset();
+        arp.follow(mon);
+        CHECK(arp.steps() == 0 && arp.playing() == 0xFF && log.count == 6 && log.vel[5] == 0,
+              "arp: releasing every note ends the step");
+    }
+
+    // Swing and legato
+    {
+        GingoArpeggiator arp;
+        ArpLog log = { &arp, {}, {}, {}, 0 };
+        arp.onNote(arpRecord, &log);
+        arp.setRate(24);
+        arp.setSwing(0.66f);
+        arp.setNotes(cmaj, 3);
+        arp.tick(96);
+        CHECK(log.at[0] == 0 && log.at[2] == 32 && log.at[4] == 48 && log.at[6] == 80,
+              "arp: swing 0.66");
+
+        arp.setSwing(0.5f);
+        arp.setGate(1.0f);
+        arp.reset();
+        log.count = 0;
+        arp.tick(25);
+        CHECK(log.count == 3 && log.vel[1] == 0 && log.at[1] == 24 && log.vel[2] == 100 && log.at[2] == 24,
+              "arp: legato note-off before the next note-on");
+    }
+
+    // Elapsed time at a tempo
+    {
+        GingoArpeggiator arp;
+        arp.setTempo(120.0f);
+        arp.advance(125000);   // one sixteenth at 120 BPM
+        CHECK(arp.ticks() == GingoArpeggiator::PPQN / 4, "arp: advance by microseconds");
+        for (int i = 0; i < 1000; i++) arp.advance(125);
+        CHECK(arp.ticks() == GingoArpeggiator::PPQN / 2, "arp: advance keeps the remainder");
+    }
+}
+
 // =====================================================================
 // Main
 // =====================================================================
@@ -1591,6 +3228,7 @@ int main() {
     testScaleExtended();
     testField();
     testFieldExtended();
+    testFormalNotes();
     testDuration();
     testDurationExtended();
     testTempo();
@@ -1601,12 +3239,21 @@ int main() {
     testFretboard();
     testFieldDeduce();
     testTree();
+    testHarmonize();
     testProgression();
     testNoteContext();
     testChordComparison();
     testMonitor();
     testMIDI1();
     testMIDI2();
+    testSynth();
+    testPitch();
+    testChroma();
+    testTuning();
+    testArpeggiator();
+#if GINGODUINO_PROFILE
+    testProfile();
+#endif
 
     printf("\n======================\n");
     printf("Tests: %d  Passed: %d  Failed: %d\n", tests, tests - failures, failures);
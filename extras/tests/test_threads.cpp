@@ -0,0 +1,374 @@
+// Thread stress test - runs every module from several threads at once and
+// checks each thread gets the single-threaded answers. Meant to be built
+// with ThreadSanitizer, which reports any shared mutable state.
+//
+// Build and run (from repo root):
+//   g++ -std=c++11 -O1 -g -fsanitize=thread -pthread -DGINGODUINO_TIER=3 -I.
+//       -o extras/tests/test_threads extras/tests/test_threads.cpp
+//   ./extras/tests/test_threads [THREADS] [ROUNDS]
+//
+// Shared objects (fretboard, field, tree, progression, sequence) are only
+// queried through const methods. GingoMonitor and GingoFingeringCache are
+// stateful and are used one per thread, as the README asks.
+
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <thread>
+#include <vector>
+#include "src/Gingoduino.h"
+#include "src/gingoduino_progmem.h"
+
+// Pull in all .cpp files for a single-file build (the CMake targets
+// define GINGODUINO_LINKED and link the gingoduino library instead)
+#ifndef GINGODUINO_LINKED
+#include "src/GingoNote.cpp"
+#include "src/GingoInterval.cpp"
+#include "src/GingoChord.cpp"
+#include "src/GingoScale.cpp"
+#include "src/GingoField.cpp"
+#include "src/GingoDuration.cpp"
+#include "src/GingoTempo.cpp"
+#include "src/GingoTimeSig.cpp"
+#include "src/GingoEvent.cpp"
+#include "src/GingoSequence.cpp"
+#include "src/GingoFretboard.cpp"
+#include "src/GingoTree.cpp"
+#include "src/GingoProgression.cpp"
+#include "src/GingoMonitor.cpp"
+#include "src/GingoChordComparison.cpp"
+#include "src/GingoMIDI1.cpp"
+#include "src/GingoProfile.cpp"
+#include "src/GingoTuning.cpp"
+#include "src/GingoSynth.cpp"
+#include "src/GingoPitch.cpp"
+#include "src/GingoChroma.cpp"
+#include "src/GingoArpeggiator.cpp"
+#endif
+
+using namespace gingoduino;
+
+// =====================================================================
+// Digest: FNV-1a over everything a workload produced
+// =====================================================================
+
+struct Digest {
+    uint32_t h = 2166136261UL;
+
+    void bytes(const void* p, size_t n) {
+        const uint8_t* b = (const uint8_t*)p;
+        for (size_t i = 0; i < n; i++) {
+            h ^= b[i];
+            h *= 16777619UL;
+        }
+    }
+    void str(const char* s) { bytes(s, strlen(s) + 1); }
+    void u(uint32_t v) { bytes(&v, sizeof(v)); }
+    void f(float v) { u((uint32_t)(v * 1000.0f)); }
+};
+
+// =====================================================================
+// Shared state, read-only once the threads start
+// =====================================================================
+
+static const char* const CHORDS[] = {
+    "CM", "Am", "G7", "F7M", "Bm7(b5)", "E7(9)", "Dm7", "Ebdim7", "Dsus4", "Abaug"
+};
+static const uint8_t NUM_CHORDS = sizeof(CHORDS) / sizeof(CHORDS[0]);
+
+struct Shared {
+    GingoFretboard   guitar;
+    GingoField       field;
+    GingoTree        tree;
+    GingoProgression progression;
+    GingoSequence    sequence;
+
+    Shared()
+        : guitar(GingoFretboard::guitar()),
+          field("C", SCALE_MAJOR),
+          tree("C", SCALE_MAJOR),
+          progression("C", SCALE_MAJOR) {
+        for (uint8_t i = 0; i < 16; i++) {
+            sequence.add(GingoEvent::fromMIDI((uint8_t)(48 + (i * 5) % 24)));
+        }
+    }
+};
+
+static Shared* shared = nullptr;
+
+/// Playable content only: frets past numStrings are not written.
+static void fingering(Digest& d, const GingoPackedFingering& f) {
+    d.bytes(f.frets, f.numStrings);
+    d.u(f.capoFret);
+    d.u(f.score);
+}
+
+// =====================================================================
+// Workloads: one per module, each returns a digest of its results
+// =====================================================================
+
+static uint32_t runNotes() {
+    Digest d;
+    char buf[32];
+    for (uint8_t s = 0; s < 12; s++) {
+        data::readChromaticName(s, buf, sizeof(buf));
+        GingoNote n(buf);
+        d.str(n.name());
+        d.str(n.natural());
+        d.u(n.midiNumber(4));
+        d.f(n.frequency(4));
+        d.str(n.transpose(7).name());
+        GingoInterval iv(GingoNote("C"), n);
+        d.str(iv.label(buf, sizeof(buf)));
+        d.str(iv.fullName(buf, sizeof(buf)));
+        d.str(iv.consonance(buf, sizeof(buf)));
+        d.u(GingoInterval::labelToSemitones(iv.label(buf, sizeof(buf))));
+    }
+    return d.h;
+}
+
+static uint32_t runChords() {
+    Digest d;
+    char buf[32];
+    for (uint8_t c = 0; c < NUM_CHORDS; c++) {
+        GingoChord chord(CHORDS[c]);
+        d.str(chord.name());
+        GingoNote notes[GINGODUINO_MAX_CHORD_NOTES];
+        uint8_t n = chord.notes(notes, GINGODUINO_MAX_CHORD_NOTES);
+        uint16_t mask = 0;
+        for (uint8_t k = 0; k < n; k++) mask |= (uint16_t)(1u << notes[k].semitone());
+        d.u(GingoChord::identify(notes, n, buf, sizeof(buf)));
+        d.str(buf);
+        ChordMatch m[4];
+        uint8_t found = GingoChord::identifyMask(mask, 255, m, 4);
+        for (uint8_t k = 0; k < found; k++) {
+            d.str(m[k].name.c_str());
+            d.u(m[k].rank);
+        }
+        d.str(chord.transpose(3).name());
+    }
+    return d.h;
+}
+
+static uint32_t runScalesAndFields() {
+    Digest d;
+    char buf[32];
+    GingoScale scale("D", SCALE_MAJOR);
+    GingoNote notes[GINGODUINO_MAX_SCALE_NOTES];
+    uint8_t n = scale.notes(notes, GINGODUINO_MAX_SCALE_NOTES);
+    for (uint8_t k = 0; k < n; k++) d.str(notes[k].name());
+    d.str(scale.modeName(buf, sizeof(buf)));
+    d.u((uint32_t)scale.signature());
+    d.u(scale.mask());
+
+    const GingoField& field = shared->field;
+    for (uint8_t deg = 1; deg <= 7; deg++) {
+        d.str(field.chord(deg).name());
+        d.str(field.seventh(deg).name());
+        d.str(field.role(deg, buf, sizeof(buf)));
+    }
+
+    static const char* const ITEMS[] = { "Dm", "G7", "CM", "Am" };
+    FieldMatch fm[4];
+    uint8_t found = GingoField::deduce(ITEMS, 4, fm, 4);
+    for (uint8_t k = 0; k < found; k++) {
+        d.str(fm[k].tonicName);
+        d.u(fm[k].scaleType);
+        d.u(fm[k].matched);
+    }
+    return d.h;
+}
+
+static uint32_t runFretboard(GingoFretboard& local) {
+    Digest d;
+    char buf[32];
+    for (uint8_t c = 0; c < NUM_CHORDS; c++) {
+        GingoChord chord(CHORDS[c]);
+        // Shared board, no cache: const and stateless
+        GingoPackedFingering packed[4];
+        uint8_t n = shared->guitar.fingerings(chord, packed, 4);
+        for (uint8_t k = 0; k < n; k++) fingering(d, packed[k]);
+        // Per-thread board with its own cache
+        GingoPackedFingering cached[4];
+        uint8_t m = local.fingerings(chord, cached, 4);
+        for (uint8_t k = 0; k < m; k++) fingering(d, cached[k]);
+    }
+    static const uint8_t SHAPE[6] = { 255, 3, 2, 0, 1, 0 };
+    d.u(shared->guitar.identify(SHAPE, 6, buf, sizeof(buf)));
+    d.str(buf);
+    return d.h;
+}
+
+static uint32_t runComparison() {
+    Digest d;
+    char buf[8];
+    for (uint8_t i = 0; i < NUM_CHORDS; i++) {
+        for (uint8_t j = 0; j < NUM_CHORDS; j++) {
+            GingoChordComparison cmp = GingoChordComparison::compute(GingoChord(CHORDS[i]),
+                                                                     GingoChord(CHORDS[j]));
+            d.u(cmp.common_count);
+            d.u((uint32_t)cmp.voice_leading);
+            d.str(GingoChordComparison::transformationName(cmp.transformation, buf, sizeof(buf)));
+        }
+    }
+    return d.h;
+}
+
+static uint32_t runProgressions() {
+    Digest d;
+    char buf[32];
+    static const char* const SEQ[] = { "IIm", "V7", "I" };
+    const GingoTree& tree = shared->tree;
+    d.u(tree.isValidSequence(SEQ, 3));
+    d.u(tree.countValidTransitions(SEQ, 3));
+    d.u(tree.resolve("V7", buf, sizeof(buf)));
+    d.str(buf);
+    d.str(tree.traditionName(buf, sizeof(buf)));
+    const char* next[16];
+    uint8_t n = tree.neighbors("IIm", next, 16);
+    for (uint8_t k = 0; k < n; k++) d.str(next[k]);
+
+    const GingoProgression& prog = shared->progression;
+    ProgressionMatch pm[4];
+    n = prog.deduce(SEQ, 3, pm, 4);
+    for (uint8_t k = 0; k < n; k++) {
+        d.str(pm[k].schema);
+        d.u(pm[k].scoreNum);
+    }
+    ProgressionRoute routes[8];
+    n = prog.predict(SEQ, 2, routes, 8);
+    for (uint8_t k = 0; k < n; k++) {
+        d.str(routes[k].next);
+        d.u(routes[k].confidenceNum);
+    }
+    return d.h;
+}
+
+static uint32_t runTime() {
+    Digest d;
+    char buf[32];
+    GingoTempo tempo("Allegro");
+    d.f(tempo.bpm());
+    d.str(tempo.marking(buf, sizeof(buf)));
+    GingoDuration q("quarter", 1);
+    d.str(q.name(buf, sizeof(buf)));
+    d.f(q.beats());
+    d.f(tempo.seconds(q));
+    GingoTimeSig ts(6, 8);
+    d.str(ts.classification(buf, sizeof(buf)));
+    d.str(ts.commonName(buf, sizeof(buf)));
+    d.str(ts.toString(buf, sizeof(buf)));
+    d.u(ts.isCompound());
+    return d.h;
+}
+
+static uint32_t runMidi() {
+    Digest d;
+    const GingoSequence& seq = shared->sequence;
+    uint8_t bytes[256];
+    d.u(GingoMIDI1::fromSequence(seq, bytes, sizeof(bytes)));
+    d.bytes(bytes, 16);
+    d.u(seq.at(200).type());   // out of range: the shared fallback event
+    for (uint8_t c = 0; c < NUM_CHORDS; c++) {
+        GingoUMP ump = GingoMIDI2::chordName(GingoChord(CHORDS[c]));
+        d.bytes(ump.words, sizeof(ump.words));
+    }
+    GingoUMP key = GingoMIDI2::keySignature(GingoScale("Eb", SCALE_MAJOR));
+    d.bytes(key.words, sizeof(key.words));
+    return d.h;
+}
+
+static uint32_t runMonitor(GingoMonitor& mon) {
+    Digest d;
+    static const uint8_t PLAYED[][3] = {
+        { 60, 64, 67 }, { 57, 60, 64 }, { 55, 59, 62 }, { 53, 57, 60 }
+    };
+    mon.reset();
+    for (uint8_t i = 0; i < 4; i++) {
+        for (uint8_t k = 0; k < 3; k++) mon.noteOn(0, PLAYED[i][k], 100);
+        d.u(mon.hasChord());
+        if (mon.hasChord()) d.str(mon.currentChord().name());
+        for (uint8_t k = 0; k < 3; k++) mon.noteOff(0, PLAYED[i][k]);
+    }
+    d.u(mon.hasField());
+    if (mon.hasField()) d.str(mon.currentField().tonic().name());
+    return d.h;
+}
+
+// =====================================================================
+// Driver
+// =====================================================================
+
+static const uint8_t NUM_WORKLOADS = 9;
+static const char* const WORKLOAD_NAMES[NUM_WORKLOADS] = {
+    "notes", "chords", "scales+fields", "fretboard", "comparison",
+    "progressions", "time", "midi", "monitor"
+};
+
+/// Per-thread stateful objects.
+struct Locals {
+    GingoFingeringCache cache;
+    GingoFretboard      guitar;
+    GingoMonitor        monitor;
+
+    Locals() : guitar(GingoFretboard::guitar()) { guitar.setCache(&cache); }
+};
+
+static void runAll(Locals& locals, uint32_t* out) {
+    out[0] = runNotes();
+    out[1] = runChords();
+    out[2] = runScalesAndFields();
+    out[3] = runFretboard(locals.guitar);
+    out[4] = runComparison();
+    out[5] = runProgressions();
+    out[6] = runTime();
+    out[7] = runMidi();
+    out[8] = runMonitor(locals.monitor);
+}
+
+int main(int argc, char** argv) {
+    const int threads = argc > 1 ? atoi(argv[1]) : 4;
+    const int rounds = argc > 2 ? atoi(argv[2]) : 20;
+    if (threads < 1 || rounds < 1) {
+        fprintf(stderr, "usage: %s [THREADS] [ROUNDS]\n", argv[0]);
+        return 2;
+    }
+
+    printf("Gingoduino Thread Stress Test (%d threads, %d rounds)\n", threads, rounds);
+
+    Shared state;
+    shared = &state;
+
+    uint32_t expected[NUM_WORKLOADS];
+    {
+        Locals locals;
+        runAll(locals, expected);
+    }
+
+    std::atomic<int> mismatches(0);
+    std::vector<std::thread> pool;
+    for (int t = 0; t < threads; t++) {
+        pool.emplace_back([&]() {
+            Locals locals;
+            uint32_t got[NUM_WORKLOADS];
+            for (int r = 0; r < rounds; r++) {
+                runAll(locals, got);
+                for (uint8_t w = 0; w < NUM_WORKLOADS; w++) {
+                    if (got[w] != expected[w]) mismatches++;
+                }
+            }
+        });
+    }
+    for (size_t t = 0; t < pool.size(); t++) pool[t].join();
+
+    for (uint8_t w = 0; w < NUM_WORKLOADS; w++) {
+        printf("  %-14s %08lx\n", WORKLOAD_NAMES[w], (unsigned long)expected[w]);
+    }
+    if (mismatches.load() != 0) {
+        printf("FAIL: %d result(s) differ from the single-threaded run\n", mismatches.load());
+        return 1;
+    }
+    printf("OK: every thread matched the single-threaded run\n");
+    return 0;
+}
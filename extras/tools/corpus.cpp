@@ -0,0 +1,992 @@
+// Corpus analyzer - chords, key and progression schemas for a collection
+// of Standard MIDI Files, spread over all cores.
+//
+// Each file is memory-mapped and parsed; notes from all tracks are merged
+// by tick, with the sustain pedal applied, and the sounding pitch-class
+// set after each tick is named with GingoChord::identifyMask() (memoized
+// per worker by mask and bass). The key comes from GingoField::deduce() over the
+// chords (pitch classes for files without chords), ties broken by note
+// weight. Chords are mapped to progression branches in that key, checked
+// against the harmonic tree and matched against the progression schemas.
+// One result per file is streamed as a JSON line or a CSV row as soon as
+// the file is done; throughput goes to stderr.
+//
+// Build and run (from repo root):
+//   g++ -std=c++11 -O2 -pthread -DGINGODUINO_TIER=3 -I. -o extras/tools/corpus extras/tools/corpus.cpp
+//   ./extras/tools/corpus -j 8 midi/ > results.jsonl
+//   find midi -name '*.mid' | ./extras/tools/corpus --csv - > results.csv
+//
+// Arguments are files or directories (searched recursively for .mid,
+// .midi, .smf and .kar); "-" reads paths from stdin, one per line.
+// Options:
+//   -j N        worker threads (default: hardware threads)
+//   --csv       CSV instead of JSON lines
+//   --drums     include channel 10 (skipped by default)
+//   -o FILE     write results to FILE instead of stdout
+//
+// Workers own their chord memo and buffers; files are dealt out in blocks
+// and idle workers steal from the other end of a busy worker's queue.
+//
+// Exit: 0 ok, 1 some files could not be analysed, 2 usage or IO error.
+
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <cstdarg>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#ifdef _WIN32
+#define GINGODUINO_CORPUS_MMAP 0
+#else
+#define GINGODUINO_CORPUS_MMAP 1
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "src/Gingoduino.h"
+#include "src/gingoduino_progmem.h"
+
+// Pull in all .cpp files for a single-file build (the CMake targets
+// define GINGODUINO_LINKED and link the gingoduino library instead)
+#ifndef GINGODUINO_LINKED
+#include "src/GingoNote.cpp"
+#include "src/GingoInterval.cpp"
+#include "src/GingoChord.cpp"
+#include "src/GingoScale.cpp"
+#include "src/GingoField.cpp"
+#include "src/GingoDuration.cpp"
+#include "src/GingoTempo.cpp"
+#include "src/GingoTimeSig.cpp"
+#include "src/GingoEvent.cpp"
+#include "src/GingoSequence.cpp"
+#include "src/GingoFretboard.cpp"
+#include "src/GingoTree.cpp"
+#include "src/GingoProgression.cpp"
+#include "src/GingoMonitor.cpp"
+#include "src/GingoChordComparison.cpp"
+#include "src/GingoMIDI1.cpp"
+#include "src/GingoProfile.cpp"
+#include "src/GingoTuning.cpp"
+#include "src/GingoSynth.cpp"
+#include "src/GingoPitch.cpp"
+#include "src/GingoChroma.cpp"
+#include "src/GingoArpeggiator.cpp"
+#endif
+
+using namespace gingoduino;
+
+// ---------------------------------------------------------------------------
+// File mapping
+// ---------------------------------------------------------------------------
+
+/// Read-only view of a whole file: mmap where available, a heap copy
+/// otherwise.
+class MappedFile {
+public:
+    MappedFile() : data_(nullptr), size_(0) {}
+    ~MappedFile() { close(); }
+
+    bool open(const char* path) {
+        close();
+#if GINGODUINO_CORPUS_MMAP
+        int fd = ::open(path, O_RDONLY);
+        if (fd < 0) return false;
+        struct stat st;
+        if (fstat(fd, &st) != 0 || !S_ISREG(st.st_mode)) {
+            ::close(fd);
+            return false;
+        }
+        size_ = (size_t)st.st_size;
+        if (size_ > 0) {
+            void* p = mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (p == MAP_FAILED) {
+                ::close(fd);
+                size_ = 0;
+                return false;
+            }
+            madvise(p, size_, MADV_SEQUENTIAL);
+            data_ = (const uint8_t*)p;
+        }
+        ::close(fd);
+        return true;
+#else
+        FILE* f = fopen(path, "rb");
+        if (!f) return false;
+        uint8_t chunk[65536];
+        size_t n;
+        while ((n = fread(chunk, 1, sizeof(chunk), f)) > 0) copy_.insert(copy_.end(), chunk, chunk + n);
+        fclose(f);
+        data_ = copy_.data();
+        size_ = copy_.size();
+        return true;
+#endif
+    }
+
+    void close() {
+#if GINGODUINO_CORPUS_MMAP
+        if (data_ && size_ > 0) munmap((void*)data_, size_);
+#else
+        copy_.clear();
+#endif
+        data_ = nullptr;
+        size_ = 0;
+    }
+
+    const uint8_t* data() const { return data_; }
+    size_t size() const { return size_; }
+
+private:
+    MappedFile(const MappedFile&);
+    MappedFile& operator=(const MappedFile&);
+
+    const uint8_t* data_;
+    size_t         size_;
+#if !GINGODUINO_CORPUS_MMAP
+    std::vector<uint8_t> copy_;
+#endif
+};
+
+// ---------------------------------------------------------------------------
+// Standard MIDI File parser
+// ---------------------------------------------------------------------------
+
+/// Note and pedal events kept from a file; everything else is counted
+/// and skipped.
+struct NoteEvent {
+    uint32_t tick;
+    uint8_t  kind;      // KIND_* (also the order within a tick)
+    uint8_t  channel;
+    uint8_t  note;
+    uint8_t  velocity;
+};
+
+enum : uint8_t {
+    KIND_OFF = 0,        // note off, or note on with velocity 0
+    KIND_PEDAL_UP = 1,
+    KIND_PEDAL_DOWN = 2,
+    KIND_ON = 3,
+};
+
+struct SmfInfo {
+    uint16_t format;
+    uint16_t tracks;
+    uint16_t division;   // ticks per quarter (SMPTE files: raw field)
+    uint32_t events;     // every event in every track
+    const char* error;   // nullptr when the file parsed
+};
+
+static uint32_t be32(const uint8_t* p) {
+    return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | p[3];
+}
+
+static uint16_t be16(const uint8_t* p) {
+    return (uint16_t)((p[0] << 8) | p[1]);
+}
+
+/// Variable-length quantity at p (advanced). Returns false past end.
+static bool readVlq(const uint8_t*& p, const uint8_t* end, uint32_t& v) {
+    v = 0;
+    for (uint8_t i = 0; i < 4; i++) {
+        if (p >= end) return false;
+        uint8_t b = *p++;
+        v = (v << 7) | (b & 0x7F);
+        if (!(b & 0x80)) return true;
+    }
+    return false;
+}
+
+static bool parseTrack(const uint8_t* p, const uint8_t* end, bool drums,
+                       std::vector<NoteEvent>& out, SmfInfo& info) {
+    uint32_t tick = 0;
+    uint8_t status = 0;
+    while (p < end) {
+        uint32_t delta;
+        if (!readVlq(p, end, delta)) return false;
+        tick += delta;
+        if (p >= end) return false;
+        info.events++;
+
+        uint8_t b = *p;
+        if (b == 0xFF) {                        // meta
+            if (end - p < 2) return false;
+            uint8_t type = p[1];
+            p += 2;
+            uint32_t len;
+            if (!readVlq(p, end, len) || len > (uint32_t)(end - p)) return false;
+            p += len;
+            if (type == 0x2F) return true;      // end of track
+            continue;
+        }
+        if (b == 0xF0 || b == 0xF7) {           // sysex
+            p++;
+            uint32_t len;
+            if (!readVlq(p, end, len) || len > (uint32_t)(end - p)) return false;
+            p += len;
+            continue;
+        }
+        if (b & 0x80) {
+            if (b > 0xEF) return false;          // system common: not valid in a file
+            status = b;
+            p++;
+        } else if (status == 0) {
+            return false;                        // running status without a status
+        }
+
+        const uint8_t type = status & 0xF0;
+        const uint8_t channel = status & 0x0F;
+        const uint8_t dataLen = (type == 0xC0 || type == 0xD0) ? 1 : 2;
+        if (end - p < dataLen) return false;
+        const uint8_t d0 = p[0] & 0x7F;
+        const uint8_t d1 = dataLen > 1 ? (uint8_t)(p[1] & 0x7F) : 0;
+        p += dataLen;
+
+        if (channel == 9 && !drums && type != 0xB0) continue;
+        NoteEvent e = { tick, KIND_ON, channel, d0, d1 };
+        if (type == 0x90 && d1 > 0) {
+            out.push_back(e);
+        } else if (type == 0x80 || type == 0x90) {
+            e.kind = KIND_OFF;
+            out.push_back(e);
+        } else if (type == 0xB0 && d0 == 64) {
+            e.kind = d1 >= 64 ? KIND_PEDAL_DOWN : KIND_PEDAL_UP;
+            out.push_back(e);
+        }
+    }
+    return true;    // missing end-of-track meta is tolerated
+}
+
+/// Parse a whole file into note events sorted by tick (offs first within
+/// a tick, so repeated chords are not merged into one).
+static void parseSmf(const uint8_t* data, size_t size, bool drums,
+                     std::vector<NoteEvent>& out, SmfInfo& info) {
+    memset(&info, 0, sizeof(info));
+    out.clear();
+
+    // RIFF-wrapped files (.rmi) carry the SMF in a "data" chunk
+    if (size >= 20 && memcmp(data, "RIFF", 4) == 0 && memcmp(data + 8, "RMID", 4) == 0) {
+        size_t off = 12;
+        while (off + 8 <= size) {
+            uint32_t len = (uint32_t)data[off + 4] | ((uint32_t)data[off + 5] << 8) |
+                           ((uint32_t)data[off + 6] << 16) | ((uint32_t)data[off + 7] << 24);
+            if (memcmp(data + off, "data", 4) == 0) {
+                size = std::min(size - off - 8, (size_t)len);
+                data += off + 8;
+                break;
+            }
+            off += 8 + len + (len & 1);
+        }
+    }
+
+    if (size < 14 || memcmp(data, "MThd", 4) != 0 || be32(data + 4) < 6) {
+        info.error = "not a MIDI file";
+        return;
+    }
+    info.format = be16(data + 8);
+    info.tracks = be16(data + 10);
+    info.division = be16(data + 12);
+
+    size_t off = 8 + be32(data + 4);
+    uint16_t found = 0;
+    while (off + 8 <= size && found < info.tracks) {
+        uint32_t len = be32(data + off + 4);
+        const uint8_t* body = data + off + 8;
+        const uint8_t* end = (len > size - off - 8) ? data + size : body + len;
+        if (memcmp(data + off, "MTrk", 4) == 0) {
+            if (!parseTrack(body, end, drums, out, info)) {
+                info.error = "corrupt track";
+                return;
+            }
+            found++;
+        }
+        off = (size_t)(end - data);
+    }
+    if (found == 0) {
+        info.error = "no tracks";
+        return;
+    }
+    info.tracks = found;
+
+    std::stable_sort(out.begin(), out.end(), [](const NoteEvent& a, const NoteEvent& b) {
+        return a.tick != b.tick ? a.tick < b.tick : a.kind < b.kind;
+    });
+}
+
+// ---------------------------------------------------------------------------
+// Analysis
+// ---------------------------------------------------------------------------
+
+/// An identified chord, interned per worker.
+struct Chord {
+    NameStr  name;    // root-position name (inversions folded)
+    uint8_t  root;    // root pitch class
+    uint16_t mask;    // pitch-class mask
+};
+
+/// A chord held for a stretch of ticks.
+struct ChordSpan {
+    const Chord* chord;
+    uint32_t     ticks;
+};
+
+struct SchemaCount {
+    char     name[24];
+    uint8_t  traditionId;
+    uint32_t count;
+};
+
+struct FileResult {
+    SmfInfo  smf;
+    uint32_t notes;
+    uint32_t chordChanges;        // spans after merging repeats
+    uint16_t distinctChords;
+    char     keyTonic[3];
+    int8_t   keyType;             // ScaleType, -1 = unknown
+    uint8_t  keyMatched;
+    uint8_t  keyTotal;
+    std::vector<const char*> branches;   // PROGMEM branch names, in order
+    uint32_t treeValid;
+    uint32_t treeTotal;
+    std::vector<SchemaCount> schemas;
+    double   us;
+};
+
+static uint16_t maskOf(const GingoChord& c) {
+    GingoNote notes[GINGODUINO_MAX_CHORD_NOTES];
+    uint8_t n = c.notes(notes, GINGODUINO_MAX_CHORD_NOTES);
+    uint16_t mask = 0;
+    for (uint8_t i = 0; i < n; i++) mask |= (uint16_t)(1u << notes[i].semitone());
+    return mask;
+}
+
+/// Per-thread analysis state, reused from file to file.
+class Analyzer {
+public:
+    explicit Analyzer(bool drums) : drums_(drums), memo_(4096 * 12) {}
+
+    void run(const char* path, FileResult& r) {
+        auto t0 = std::chrono::steady_clock::now();
+        r = FileResult();
+        r.keyType = -1;
+        if (!file_.open(path)) {
+            r.smf.error = "cannot open";
+        } else {
+            parseSmf(file_.data(), file_.size(), drums_, events_, r.smf);
+            file_.close();
+            if (!r.smf.error) analyse(r);
+        }
+        r.us = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - t0).count();
+    }
+
+private:
+    void analyse(FileResult& r) {
+        trackChords(r);
+        estimateKey(r);
+        if (r.keyType >= 0) mapProgression(r);
+    }
+
+    /// Apply the events tick by tick and identify the sounding pitch-class
+    /// set after each tick; also weigh pitch classes by sounding ticks.
+    void trackChords(FileResult& r) {
+        spans_.clear();
+        memset(pcWeight_, 0, sizeof(pcWeight_));
+        memset(onTick_, 0xFF, sizeof(onTick_));
+        memset(held_, 0, sizeof(held_));
+        memset(pedal_, 0, sizeof(pedal_));
+        memset(sustained_, 0, sizeof(sustained_));
+
+        size_t i = 0;
+        while (i < events_.size()) {
+            const uint32_t tick = events_[i].tick;
+            for (; i < events_.size() && events_[i].tick == tick; i++) {
+                const NoteEvent& e = events_[i];
+                uint32_t& start = onTick_[e.channel][e.note];
+                switch (e.kind) {
+                    case KIND_ON:
+                        if (start == 0xFFFFFFFFUL) {
+                            start = tick;
+                            // Struck again under the pedal: already counted
+                            if (!sustained_[e.channel][e.note]) held_[e.note]++;
+                        }
+                        sustained_[e.channel][e.note] = false;
+                        r.notes++;
+                        break;
+                    case KIND_OFF:
+                        if (start == 0xFFFFFFFFUL) break;
+                        pcWeight_[e.note % 12] += tick - start;
+                        start = 0xFFFFFFFFUL;
+                        if (pedal_[e.channel]) sustained_[e.channel][e.note] = true;
+                        else                   held_[e.note]--;
+                        break;
+                    case KIND_PEDAL_DOWN:
+                        pedal_[e.channel] = true;
+                        break;
+                    case KIND_PEDAL_UP:
+                        pedal_[e.channel] = false;
+                        for (uint8_t n = 0; n < 128; n++) {
+                            if (!sustained_[e.channel][n]) continue;
+                            sustained_[e.channel][n] = false;
+                            held_[n]--;
+                        }
+                        break;
+                }
+            }
+            const uint32_t next = i < events_.size() ? events_[i].tick : tick;
+
+            uint16_t mask = 0;
+            uint8_t bass = 255;
+            for (uint8_t n = 0; n < 128; n++) {
+                if (!held_[n]) continue;
+                if (bass == 255) bass = n % 12;
+                mask |= (uint16_t)(1u << (n % 12));
+            }
+            const Chord* c = identify(mask, bass);
+            if (!c) continue;
+            if (!spans_.empty() && spans_.back().chord == c) {
+                spans_.back().ticks += next - tick;
+                continue;
+            }
+            ChordSpan span = { c, next - tick };
+            spans_.push_back(span);
+        }
+
+        // Passing chords shorter than a sixteenth are dropped, then repeats merged
+        const uint32_t minTicks = (r.smf.division & 0x8000) ? 1 : std::max<uint32_t>(1, r.smf.division / 4);
+        size_t w = 0;
+        for (size_t k = 0; k < spans_.size(); k++) {
+            if (spans_[k].ticks < minTicks) continue;
+            if (w > 0 && spans_[w - 1].chord == spans_[k].chord) {
+                spans_[w - 1].ticks += spans_[k].ticks;
+            } else {
+                spans_[w++] = spans_[k];
+            }
+        }
+        spans_.resize(w);
+        r.chordChanges = (uint32_t)w;
+    }
+
+    /// Chord for a pitch-class set, from GingoChord::identifyMask() and
+    /// memoized per set and bass. Inversions are folded into their root
+    /// chord. nullptr for fewer than three pitch classes or no match.
+    const Chord* identify(uint16_t mask, uint8_t bass) {
+        uint8_t pcs = 0;
+        for (uint16_t m = mask; m; m &= (uint16_t)(m - 1)) pcs++;
+        if (pcs < 3) return nullptr;
+
+        Memo& memo = memo_[(size_t)mask * 12 + bass];
+        if (memo.state == MEMO_EMPTY) {
+            ChordMatch m;
+            memo.state = MEMO_NONE;
+            if (GingoChord::identifyMask(mask, bass, &m, 1) == 1) {
+                char name[sizeof(m.name.data)];
+                strcpy(name, m.name.c_str());
+                char* slash = strchr(name, '/');
+                if (slash) *slash = '\0';
+                memo.chord = chordFor(name);
+                memo.state = MEMO_FOUND;
+            }
+        }
+        return memo.state == MEMO_FOUND ? memo.chord : nullptr;
+    }
+
+    /// Interned chord record, one per name.
+    const Chord* chordFor(const char* name) {
+        for (size_t k = 0; k < chords_.size(); k++) {
+            if (strcmp(chords_[k].name.c_str(), name) == 0) return &chords_[k];
+        }
+        GingoChord c(name);
+        Chord rec;
+        rec.name = name;
+        rec.root = c.root().semitone();
+        rec.mask = maskOf(c);
+        chords_.push_back(rec);
+        return &chords_.back();
+    }
+
+    /// Key from GingoField::deduce() over the longest-held chords, or over
+    /// the heaviest pitch classes when there are fewer than two chords.
+    /// Only major and natural minor are kept (the progression contexts);
+    /// ties go to the tonic with the most sounding ticks.
+    void estimateKey(FileResult& r) {
+        struct Weighted { const char* name; uint64_t w; };
+        std::vector<Weighted> items;
+        for (size_t k = 0; k < spans_.size(); k++) {
+            bool seen = false;
+            for (size_t j = 0; j < items.size(); j++) {
+                if (items[j].name == spans_[k].chord->name.c_str()) {
+                    items[j].w += spans_[k].ticks;
+                    seen = true;
+                    break;
+                }
+            }
+            if (!seen) items.push_back({ spans_[k].chord->name.c_str(), spans_[k].ticks });
+        }
+        r.distinctChords = (uint16_t)items.size();
+
+        char pcNames[12][4];
+        if (items.size() < 2) {
+            items.clear();
+            for (uint8_t pc = 0; pc < 12; pc++) {
+                if (pcWeight_[pc] == 0) continue;
+                data::readChromaticName(pc, pcNames[pc], sizeof(pcNames[pc]));
+                items.push_back({ pcNames[pc], pcWeight_[pc] });
+            }
+        }
+        if (items.empty()) return;
+
+        std::stable_sort(items.begin(), items.end(),
+                         [](const Weighted& a, const Weighted& b) { return a.w > b.w; });
+        const uint8_t n = (uint8_t)std::min<size_t>(items.size(), 8);
+        const char* names[8];
+        for (uint8_t k = 0; k < n; k++) names[k] = items[k].name;
+
+        FieldMatch fm[24];
+        uint8_t found = GingoField::deduce(names, n, fm, 24);
+        int best = -1;
+        for (uint8_t k = 0; k < found; k++) {
+            if (fm[k].scaleType != SCALE_MAJOR && fm[k].scaleType != SCALE_NATURAL_MINOR) continue;
+            if (best >= 0 && fm[k].matched < fm[best].matched) break;
+            if (best < 0 || tonicWeight(fm[k]) > tonicWeight(fm[best])) best = k;
+        }
+        if (best < 0) return;
+        memcpy(r.keyTonic, fm[best].tonicName, sizeof(r.keyTonic));
+        r.keyType = (int8_t)fm[best].scaleType;
+        r.keyMatched = fm[best].matched;
+        r.keyTotal = fm[best].total;
+    }
+
+    uint64_t tonicWeight(const FieldMatch& m) const {
+        return pcWeight_[GingoNote(m.tonicName).semitone()];
+    }
+
+    /// Branch names in the key for each chord span, harmonic tree check and
+    /// schema occurrences. Chords outside the key split the sequence.
+    void mapProgression(FileResult& r) {
+        const ScaleType type = (ScaleType)r.keyType;
+        const uint8_t ctx = type == SCALE_MAJOR ? 0 : 1;
+
+        // Branches used in this context: 1 = harmonic tree, 2 = jazz only.
+        // A chord that several branches resolve to takes the lowest rank.
+        uint8_t rank[PROG_BRANCH_COUNT] = {};
+        for (uint8_t trad = 0; trad < PROG_TRADITION_COUNT; trad++) {
+            const data::ProgEdgeTable* et = &data::PROG_EDGE_TABLES[trad][ctx];
+            const data::ProgEdge* edges = (const data::ProgEdge*)pgm_read_ptr(&et->edges);
+            const uint8_t count = pgm_read_byte(&et->count);
+            for (uint8_t e = 0; e < count; e++) {
+                const uint8_t o = pgm_read_byte(&edges[e].origin);
+                const uint8_t t = pgm_read_byte(&edges[e].target);
+                if (o < PROG_BRANCH_COUNT && !rank[o]) rank[o] = (uint8_t)(trad + 1);
+                if (t < PROG_BRANCH_COUNT && !rank[t]) rank[t] = (uint8_t)(trad + 1);
+            }
+        }
+
+        // Branch table for this key: root and pitch-class mask of each branch
+        GingoTree tree(r.keyTonic, type, 0);
+        uint8_t  branchRoot[PROG_BRANCH_COUNT];
+        uint16_t branchMask[PROG_BRANCH_COUNT];
+        for (uint8_t b = 0; b < PROG_BRANCH_COUNT; b++) {
+            char branch[24], chord[24];
+            branchMask[b] = 0;
+            if (!rank[b]) continue;
+            data::readPgmStr(branch, (const char*)pgm_read_ptr(&data::PROG_BRANCH_NAMES[b]), sizeof(branch));
+            if (!tree.resolve(branch, chord, sizeof(chord))) continue;
+            GingoChord c(chord);
+            branchRoot[b] = c.root().semitone();
+            branchMask[b] = maskOf(c);
+        }
+
+        ids_.clear();
+        for (size_t k = 0; k < spans_.size(); k++) {
+            uint8_t id = 0xFF;
+            for (uint8_t b = 0; b < PROG_BRANCH_COUNT; b++) {
+                if (branchMask[b] == spans_[k].chord->mask && branchRoot[b] == spans_[k].chord->root &&
+                    (id == 0xFF || rank[b] < rank[id])) {
+                    id = b;
+                }
+            }
+            ids_.push_back(id);
+            if (id != 0xFF) {
+                r.branches.push_back((const char*)pgm_read_ptr(&data::PROG_BRANCH_NAMES[id]));
+            }
+        }
+
+        // Harmonic tree: valid transitions between consecutive mapped chords
+        for (size_t k = 1; k < ids_.size(); k++) {
+            if (ids_[k - 1] == 0xFF || ids_[k] == 0xFF) continue;
+            const char* pair[2] = {
+                (const char*)pgm_read_ptr(&data::PROG_BRANCH_NAMES[ids_[k - 1]]),
+                (const char*)pgm_read_ptr(&data::PROG_BRANCH_NAMES[ids_[k]])
+            };
+            r.treeTotal++;
+            if (tree.isValid(pair[0], pair[1])) r.treeValid++;
+        }
+
+        // Schemas of both traditions, exact occurrences in the key's context
+        for (uint8_t trad = 0; trad < PROG_TRADITION_COUNT; trad++) {
+            const data::ProgSchemaTable* st = &data::PROG_SCHEMA_TABLES[trad];
+            const data::ProgSchema* schemas = (const data::ProgSchema*)pgm_read_ptr(&st->schemas);
+            const uint8_t count = pgm_read_byte(&st->count);
+            for (uint8_t s = 0; s < count; s++) {
+                const data::ProgSchema& sc = schemas[s];
+                if (pgm_read_byte(&sc.ctx) != ctx) continue;
+                const uint8_t len = pgm_read_byte(&sc.count);
+                uint32_t hits = 0;
+                for (size_t k = 0; k + len <= ids_.size(); k++) {
+                    uint8_t j = 0;
+                    while (j < len && ids_[k + j] == pgm_read_byte(&sc.branches[j])) j++;
+                    if (j == len) hits++;
+                }
+                if (hits == 0) continue;
+                SchemaCount c;
+                data::readPgmStr(c.name, sc.name, sizeof(c.name));
+                c.traditionId = trad;
+                c.count = hits;
+                r.schemas.push_back(c);
+            }
+        }
+        std::stable_sort(r.schemas.begin(), r.schemas.end(),
+                         [](const SchemaCount& a, const SchemaCount& b) { return a.count > b.count; });
+    }
+
+    enum : uint8_t { MEMO_EMPTY = 0, MEMO_NONE = 1, MEMO_FOUND = 2 };
+    struct Memo {
+        uint8_t      state = MEMO_EMPTY;
+        const Chord* chord = nullptr;
+    };
+
+    bool                   drums_;
+    MappedFile             file_;
+    std::vector<NoteEvent> events_;
+    std::vector<ChordSpan> spans_;
+    std::vector<uint8_t>   ids_;
+    std::vector<Memo>      memo_;     // [mask * 12 + bass]
+    std::deque<Chord>      chords_;   // stable addresses for the memo
+    uint64_t               pcWeight_[12];
+    uint32_t               onTick_[16][128];
+    uint16_t               held_[128];        // sounding count per note
+    bool                   pedal_[16];
+    bool                   sustained_[16][128];
+};
+
+// ---------------------------------------------------------------------------
+// Output
+// ---------------------------------------------------------------------------
+
+static void appendf(std::string& s, const char* fmt, ...) {
+    char buf[256];
+    va_list ap;
+    va_start(ap, fmt);
+    int n = vsnprintf(buf, sizeof(buf), fmt, ap);
+    va_end(ap);
+    if (n > 0) s.append(buf, std::min<size_t>((size_t)n, sizeof(buf) - 1));
+}
+
+static void appendJsonStr(std::string& s, const char* v) {
+    s += '"';
+    for (; *v; v++) {
+        const unsigned char c = (unsigned char)*v;
+        if (c == '"' || c == '\\') {
+            s += '\\';
+            s += (char)c;
+        } else if (c < 0x20) {
+            appendf(s, "\\u%04x", c);
+        } else {
+            s += (char)c;
+        }
+    }
+    s += '"';
+}
+
+static void appendCsvStr(std::string& s, const char* v) {
+    s += '"';
+    for (; *v; v++) {
+        if (*v == '"') s += '"';
+        s += *v;
+    }
+    s += '"';
+}
+
+static const char* keyName(const FileResult& r, char* buf, uint8_t maxLen) {
+    if (r.keyType < 0) {
+        buf[0] = '\0';
+        return buf;
+    }
+    char type[24];
+    data::readPgmStr(type, (const char*)pgm_read_ptr(&data::SCALE_TYPE_NAMES[r.keyType]), sizeof(type));
+    snprintf(buf, maxLen, "%s %s", r.keyTonic, type);
+    return buf;
+}
+
+/// Branches listed in a JSON result (the full sequence can be thousands).
+static const size_t JSON_BRANCHES = 64;
+
+static void formatJson(const char* path, const FileResult& r, std::string& s) {
+    char key[32];
+    s += "{\"file\":";
+    appendJsonStr(s, path);
+    if (r.smf.error) {
+        s += ",\"error\":";
+        appendJsonStr(s, r.smf.error);
+        s += "}\n";
+        return;
+    }
+    appendf(s, ",\"format\":%u,\"tracks\":%u,\"division\":%u,\"events\":%lu,\"notes\":%lu",
+            r.smf.format, r.smf.tracks, r.smf.division,
+            (unsigned long)r.smf.events, (unsigned long)r.notes);
+    appendf(s, ",\"chord_changes\":%lu,\"distinct_chords\":%u",
+            (unsigned long)r.chordChanges, r.distinctChords);
+    s += ",\"key\":";
+    if (r.keyType >= 0) {
+        appendJsonStr(s, keyName(r, key, sizeof(key)));
+        appendf(s, ",\"key_matched\":%u,\"key_items\":%u", r.keyMatched, r.keyTotal);
+    } else {
+        s += "null";
+    }
+    s += ",\"branches\":[";
+    for (size_t k = 0; k < r.branches.size() && k < JSON_BRANCHES; k++) {
+        if (k) s += ',';
+        appendJsonStr(s, r.branches[k]);
+    }
+    appendf(s, "],\"mapped\":%lu,\"tree_valid\":%lu,\"tree_total\":%lu,\"schemas\":[",
+            (unsigned long)r.branches.size(), (unsigned long)r.treeValid, (unsigned long)r.treeTotal);
+    for (size_t k = 0; k < r.schemas.size(); k++) {
+        if (k) s += ',';
+        s += "{\"name\":";
+        appendJsonStr(s, r.schemas[k].name);
+        appendf(s, ",\"tradition\":\"%s\",\"count\":%lu}",
+                r.schemas[k].traditionId == 0 ? "harmonic_tree" : "jazz",
+                (unsigned long)r.schemas[k].count);
+    }
+    appendf(s, "],\"us\":%.0f}\n", r.us);
+}
+
+static const char* const CSV_HEADER =
+    "file,error,format,tracks,events,notes,chord_changes,distinct_chords,key,"
+    "key_matched,key_items,mapped,tree_valid,tree_total,top_schema,top_schema_count,us\n";
+
+static void formatCsv(const char* path, const FileResult& r, std::string& s) {
+    char key[32];
+    appendCsvStr(s, path);
+    s += ',';
+    if (r.smf.error) {
+        appendCsvStr(s, r.smf.error);
+        s += ",,,,,,,,,,,,,,,\n";
+        return;
+    }
+    appendf(s, ",%u,%u,%lu,%lu,%lu,%u,", r.smf.format, r.smf.tracks,
+            (unsigned long)r.smf.events, (unsigned long)r.notes,
+            (unsigned long)r.chordChanges, r.distinctChords);
+    appendCsvStr(s, keyName(r, key, sizeof(key)));
+    appendf(s, ",%u,%u,%lu,%lu,%lu,", r.keyMatched, r.keyTotal, (unsigned long)r.branches.size(),
+            (unsigned long)r.treeValid, (unsigned long)r.treeTotal);
+    appendCsvStr(s, r.schemas.empty() ? "" : r.schemas[0].name);
+    appendf(s, ",%lu,%.0f\n", r.schemas.empty() ? 0UL : (unsigned long)r.schemas[0].count, r.us);
+}
+
+// ---------------------------------------------------------------------------
+// Work-stealing pool
+// ---------------------------------------------------------------------------
+
+/// File indexes owned by one worker. The owner pops from the back,
+/// thieves take from the front, so they rarely touch the same end.
+struct WorkQueue {
+    std::mutex       lock;
+    std::deque<size_t> items;
+
+    bool pop(size_t& out) {
+        std::lock_guard<std::mutex> g(lock);
+        if (items.empty()) return false;
+        out = items.back();
+        items.pop_back();
+        return true;
+    }
+
+    bool steal(size_t& out) {
+        std::lock_guard<std::mutex> g(lock);
+        if (items.empty()) return false;
+        out = items.front();
+        items.pop_front();
+        return true;
+    }
+};
+
+struct WorkerStats {
+    uint32_t files = 0;
+    uint32_t failed = 0;
+    uint32_t steals = 0;
+    uint64_t events = 0;
+};
+
+struct Corpus {
+    std::vector<std::string> paths;
+    std::vector<WorkQueue>   queues;
+    std::vector<WorkerStats> stats;
+    FILE*      out;
+    std::mutex outLock;
+    bool       csv;
+    bool       drums;
+
+    explicit Corpus(size_t workers) : queues(workers), stats(workers), out(stdout), csv(false), drums(false) {}
+
+    void work(size_t self) {
+        Analyzer analyzer(drums);
+        FileResult r;
+        std::string line;
+        WorkerStats& st = stats[self];
+        const size_t n = queues.size();
+        for (;;) {
+            size_t idx;
+            if (!queues[self].pop(idx)) {
+                bool got = false;
+                for (size_t k = 1; k < n && !got; k++) got = queues[(self + k) % n].steal(idx);
+                if (!got) return;    // nothing is added after start: every queue is drained
+                st.steals++;
+            }
+            const char* path = paths[idx].c_str();
+            analyzer.run(path, r);
+            st.files++;
+            st.events += r.smf.events;
+            if (r.smf.error) st.failed++;
+
+            line.clear();
+            if (csv) formatCsv(path, r, line);
+            else     formatJson(path, r, line);
+            std::lock_guard<std::mutex> g(outLock);
+            fwrite(line.data(), 1, line.size(), out);
+        }
+    }
+};
+
+// ---------------------------------------------------------------------------
+// Inputs
+// ---------------------------------------------------------------------------
+
+static bool isMidiName(const char* name) {
+    const char* dot = strrchr(name, '.');
+    if (!dot) return false;
+    static const char* const EXT[] = { ".mid", ".midi", ".smf", ".kar", ".rmi" };
+    for (size_t i = 0; i < sizeof(EXT) / sizeof(EXT[0]); i++) {
+        const char* a = dot;
+        const char* b = EXT[i];
+        while (*a && *b && tolower((unsigned char)*a) == *b) { a++; b++; }
+        if (!*a && !*b) return true;
+    }
+    return false;
+}
+
+static void addPath(const std::string& path, std::vector<std::string>& out) {
+#if GINGODUINO_CORPUS_MMAP
+    DIR* dir = opendir(path.c_str());
+    if (dir) {
+        std::vector<std::string> found;
+        while (struct dirent* de = readdir(dir)) {
+            if (de->d_name[0] == '.') continue;
+            std::string child = path + "/" + de->d_name;
+            struct stat st;
+            if (stat(child.c_str(), &st) != 0) continue;
+            if (S_ISDIR(st.st_mode)) addPath(child, found);
+            else if (S_ISREG(st.st_mode) && isMidiName(de->d_name)) found.push_back(child);
+        }
+        closedir(dir);
+        std::sort(found.begin(), found.end());
+        out.insert(out.end(), found.begin(), found.end());
+        return;
+    }
+#endif
+    out.push_back(path);
+}
+
+static void usage(const char* argv0) {
+    fprintf(stderr, "usage: %s [-j N] [--csv] [--drums] [-o FILE] PATH|- ...\n", argv0);
+}
+
+// ---------------------------------------------------------------------------
+// Main
+// ---------------------------------------------------------------------------
+
+int main(int argc, char** argv) {
+    unsigned workers = std::thread::hardware_concurrency();
+    if (workers == 0) workers = 1;
+    bool csv = false, drums = false;
+    const char* outPath = nullptr;
+    std::vector<std::string> inputs;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-j") == 0 && i + 1 < argc) {
+            workers = (unsigned)atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--csv") == 0) {
+            csv = true;
+        } else if (strcmp(argv[i], "--drums") == 0) {
+            drums = true;
+        } else if (strcmp(argv[i], "-o") == 0 && i + 1 < argc) {
+            outPath = argv[++i];
+        } else if (argv[i][0] == '-' && argv[i][1] != '\0') {
+            usage(argv[0]);
+            return 2;
+        } else if (strcmp(argv[i], "-") == 0) {
+            char line[4096];
+            while (fgets(line, sizeof(line), stdin)) {
+                line[strcspn(line, "\r\n")] = '\0';
+                if (line[0]) inputs.push_back(line);
+            }
+        } else {
+            addPath(argv[i], inputs);
+        }
+    }
+    if (inputs.empty() || workers == 0) {
+        usage(argv[0]);
+        return 2;
+    }
+    if (workers > inputs.size()) workers = (unsigned)inputs.size();
+
+    Corpus corpus(workers);
+    corpus.paths.swap(inputs);
+    corpus.csv = csv;
+    corpus.drums = drums;
+    if (outPath) {
+        corpus.out = fopen(outPath, "w");
+        if (!corpus.out) {
+            fprintf(stderr, "cannot write %s\n", outPath);
+            return 2;
+        }
+    }
+    if (csv) fputs(CSV_HEADER, corpus.out);
+
+    // Contiguous blocks keep a directory's files together on one worker
+    const size_t total = corpus.paths.size();
+    for (size_t w = 0; w < workers; w++) {
+        const size_t begin = total * w / workers, end = total * (w + 1) / workers;
+        for (size_t k = begin; k < end; k++) corpus.queues[w].items.push_back(end - 1 - (k - begin));
+    }
+
+    auto t0 = std::chrono::steady_clock::now();
+    std::vector<std::thread> pool;
+    for (size_t w = 0; w < workers; w++) pool.emplace_back(&Corpus::work, &corpus, w);
+    for (size_t w = 0; w < pool.size(); w++) pool[w].join();
+    const double secs = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+
+    if (outPath) fclose(corpus.out);
+    else         fflush(stdout);
+
+    WorkerStats sum;
+    for (size_t w = 0; w < workers; w++) {
+        sum.files  += corpus.stats[w].files;
+        sum.failed += corpus.stats[w].failed;
+        sum.steals += corpus.stats[w].steals;
+        sum.events += corpus.stats[w].events;
+    }
+    fprintf(stderr, "%lu files (%lu failed), %llu events in %.3f s on %u threads: "
+            "%.0f files/s, %.0f events/s, %lu steals\n",
+            (unsigned long)sum.files, (unsigned long)sum.failed, (unsigned long long)sum.events,
+            secs, workers, sum.files / secs, sum.events / secs, (unsigned long)sum.steals);
+    return sum.failed ? 1 : 0;
+}
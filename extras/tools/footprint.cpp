@@ -0,0 +1,709 @@
+// Footprint report - RAM, flash and stack per tier.
+//
+// Compile once per tier. The program reports:
+//   - sizeof every public type at that tier;
+//   - flash per table and static RAM, read from the ELF symbol tables of
+//     the library's object files (tables defined `static` in a header are
+//     counted once per object that keeps a copy);
+//   - worst-case stack per public function, from the call graphs GCC
+//     writes with -fcallgraph-info=su (one .ci next to each object).
+//
+// CMake builds the objects (-Os, call-graph info) and runs this for Tiers
+// 1-3 (`cmake --build build --target gingoduino_footprint`). By hand:
+//
+//   g++ -std=c++11 -Os -DGINGODUINO_TIER=2 -Isrc -fcallgraph-info=su -c src/GingoField.cpp -o GingoField.cpp.o
+//   ...one object per src/*.cpp...
+//   g++ -std=c++11 -O2 -DGINGODUINO_TIER=2 -I. -o footprint extras/tools/footprint.cpp
+//   ./footprint --json tier2.json --budget extras/tools/footprint_budget.txt *.o
+//
+// Object figures come from whatever toolchain built the objects, so
+// cross-compiled objects (xtensa, arm, avr) give target numbers; sizeof
+// figures are those of the compiler that built this program. Worst-case
+// stack adds the frame of each function to its deepest callee. Calls
+// through pointers and recursion cannot be bounded and are flagged.
+//
+// Exit: 0 ok, 1 over budget, 2 usage or IO error.
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cxxabi.h>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "src/Gingoduino.h"
+
+using namespace gingoduino;
+
+// ---------------------------------------------------------------------------
+// Report
+// ---------------------------------------------------------------------------
+
+struct TableInfo {
+    unsigned long size;    // bytes per copy
+    unsigned      copies;  // objects holding a private copy (>= 1)
+};
+
+struct StackInfo {
+    unsigned long frame;   // own frame
+    unsigned long worst;   // frame + deepest callee chain
+    bool dynamic;          // alloca / VLA in the chain
+    bool indirect;         // call through a pointer in the chain
+    bool recursive;        // cycle in the chain
+};
+
+static std::map<std::string, unsigned long> types;
+static std::map<std::string, TableInfo>     tables;
+static std::map<std::string, unsigned long> ramStatics;
+static std::map<std::string, StackInfo>     stacks;
+static unsigned long codeBytes = 0;
+static bool          haveStack = false;
+
+#define TYPE(T) types[#T] = sizeof(T)
+
+static void collectTypes() {
+    TYPE(GingoNote);
+    TYPE(GingoInterval);
+    TYPE(GingoChord);
+    TYPE(ChordMatch);
+#if GINGODUINO_HAS_SCALE
+    TYPE(GingoScale);
+#endif
+#if GINGODUINO_HAS_FIELD
+    TYPE(GingoField);
+    TYPE(FieldMatch);
+    TYPE(GingoNoteContext);
+#endif
+#if GINGODUINO_HAS_DURATION
+    TYPE(GingoDuration);
+#endif
+#if GINGODUINO_HAS_TEMPO
+    TYPE(GingoTempo);
+#endif
+#if GINGODUINO_HAS_TIMESIG
+    TYPE(GingoTimeSig);
+#endif
+#if GINGODUINO_HAS_FRETBOARD
+    TYPE(GingoFretboard);
+    TYPE(GingoFretPos);
+    TYPE(GingoStringState);
+    TYPE(GingoFingering);
+    TYPE(GingoPackedFingering);
+#endif
+#if GINGODUINO_HAS_FINGERING_CACHE
+    TYPE(GingoFingeringCache);
+#endif
+#if GINGODUINO_HAS_MONITOR
+    TYPE(GingoMonitor);
+#endif
+#if GINGODUINO_HAS_EVENT
+    TYPE(GingoEvent);
+#endif
+#if GINGODUINO_HAS_SEQUENCE
+    TYPE(GingoSequence);
+#endif
+#if GINGODUINO_HAS_TREE
+    TYPE(GingoTree);
+#endif
+#if GINGODUINO_HAS_PROGRESSION
+    TYPE(GingoProgression);
+    TYPE(ProgressionMatch);
+    TYPE(ProgressionRoute);
+#endif
+#if GINGODUINO_HAS_COMPARISON
+    TYPE(GingoChordComparison);
+    TYPE(GingoChordProfile);
+    TYPE(VoiceMove);
+#endif
+#if GINGODUINO_HAS_MIDI2
+    TYPE(GingoUMP);
+    TYPE(GingoMIDI2);
+#endif
+#if GINGODUINO_HAS_ARP
+    TYPE(GingoArpeggiator);
+#endif
+#if GINGODUINO_HAS_TUNING
+    TYPE(GingoTuning);
+#endif
+#if GINGODUINO_HAS_SYNTH
+    TYPE(GingoSynth);
+    TYPE(GingoSequencePlayer);
+#endif
+#if GINGODUINO_HAS_PITCH
+    TYPE(GingoPitch);
+#endif
+#if GINGODUINO_HAS_CHROMA
+    TYPE(GingoChroma);
+#endif
+#if GINGODUINO_PROFILE
+    TYPE(GingoProbeStats);
+#endif
+}
+
+// ---------------------------------------------------------------------------
+// Small helpers
+// ---------------------------------------------------------------------------
+
+static bool readFile(const char* path, std::vector<unsigned char>& out) {
+    FILE* f = fopen(path, "rb");
+    if (!f) return false;
+    unsigned char buf[65536];
+    size_t n;
+    out.clear();
+    while ((n = fread(buf, 1, sizeof(buf), f)) > 0) out.insert(out.end(), buf, buf + n);
+    fclose(f);
+    return true;
+}
+
+static std::string demangle(const char* mangled) {
+    int status = 0;
+    char* d = abi::__cxa_demangle(mangled, nullptr, nullptr, &status);
+    std::string s = (status == 0 && d) ? d : mangled;
+    free(d);
+    return s;
+}
+
+// "static uint8_t gingoduino::GingoField::deduce(const char* ...) const"
+// -> "GingoField::deduce". Parameter lists inside the name (local statics,
+// lambdas) collapse to "()".
+static std::string shortName(const std::string& sig) {
+    // Collapse parameter lists outside template arguments
+    std::string s;
+    int paren = 0, angle = 0;
+    for (size_t i = 0; i < sig.size(); i++) {
+        char c = sig[i];
+        if (paren == 0 && c == '<') angle++;
+        if (paren == 0 && c == '>') angle--;
+        if (angle == 0 && c == '(') {
+            if (paren++ == 0) s += "()";
+            continue;
+        }
+        if (angle == 0 && c == ')') { paren--; continue; }
+        if (paren == 0) s += c;
+    }
+    // "f() const::X" -> "f()::X", "f() [clone .isra.0]" -> "f()"
+    size_t q;
+    while ((q = s.find("() const")) != std::string::npos) s.erase(q + 2, 6);
+    if ((q = s.find(" [clone")) != std::string::npos) s.erase(q);
+    // Drop the function's own "()" and any qualifiers after it
+    size_t p = s.rfind("()");
+    if (p != std::string::npos && s.find("::", p) == std::string::npos) {
+        if (p >= 8 && s.compare(p - 8, 8, "operator") == 0) p += 2;
+        s.erase(p);
+    }
+    // Drop the return type: text up to the last space outside <>
+    angle = 0;
+    size_t start = 0;
+    for (size_t i = 0; i < s.size(); i++) {
+        if (s[i] == '<') angle++;
+        else if (s[i] == '>') angle--;
+        else if (s[i] == ' ' && angle == 0) start = i + 1;
+    }
+    s.erase(0, start);
+    static const char PREFIX[] = "gingoduino::";
+    if (s.compare(0, sizeof(PREFIX) - 1, PREFIX) == 0) s.erase(0, sizeof(PREFIX) - 1);
+    return s;
+}
+
+// ---------------------------------------------------------------------------
+// ELF symbol tables (32/64-bit little-endian relocatable objects)
+// ---------------------------------------------------------------------------
+
+static unsigned long rd(const std::vector<unsigned char>& b, size_t off, unsigned bytes) {
+    unsigned long v = 0;
+    if (off + bytes > b.size()) return 0;
+    for (unsigned i = 0; i < bytes; i++) v |= (unsigned long)b[off + i] << (8 * i);
+    return v;
+}
+
+struct Section {
+    std::string   name;
+    unsigned long type, flags, offset, size, link, entsize;
+};
+
+static bool scanObject(const char* path) {
+    std::vector<unsigned char> b;
+    if (!readFile(path, b)) {
+        fprintf(stderr, "%s: cannot open\n", path);
+        return false;
+    }
+    if (b.size() < 52 || memcmp(&b[0], "\x7f" "ELF", 4) != 0 || b[5] != 1) {
+        fprintf(stderr, "%s: not a little-endian ELF object\n", path);
+        return false;
+    }
+    const bool is64 = (b[4] == 2);
+    const unsigned long shoff = is64 ? rd(b, 0x28, 8) : rd(b, 0x20, 4);
+    const unsigned long shentsize = rd(b, is64 ? 0x3A : 0x2E, 2);
+    const unsigned long shnum = rd(b, is64 ? 0x3C : 0x30, 2);
+    const unsigned long shstrndx = rd(b, is64 ? 0x3E : 0x32, 2);
+
+    std::vector<Section> sec(shnum);
+    for (unsigned long i = 0; i < shnum; i++) {
+        const size_t h = shoff + i * shentsize;
+        Section& s = sec[i];
+        s.type    = rd(b, h + 4, 4);
+        s.flags   = is64 ? rd(b, h + 8, 8)  : rd(b, h + 8, 4);
+        s.offset  = is64 ? rd(b, h + 24, 8) : rd(b, h + 16, 4);
+        s.size    = is64 ? rd(b, h + 32, 8) : rd(b, h + 20, 4);
+        s.link    = is64 ? rd(b, h + 40, 4) : rd(b, h + 24, 4);
+        s.entsize = is64 ? rd(b, h + 56, 8) : rd(b, h + 36, 4);
+        s.name    = std::to_string(rd(b, h, 4));
+    }
+    if (shstrndx < shnum) {
+        for (unsigned long i = 0; i < shnum; i++) {
+            const size_t at = sec[shstrndx].offset + strtoul(sec[i].name.c_str(), nullptr, 10);
+            sec[i].name = (at < b.size()) ? (const char*)&b[at] : "";
+        }
+    }
+
+    const unsigned long SHF_WRITE = 1, SHF_ALLOC = 2, SHF_EXECINSTR = 4;
+    for (unsigned long i = 0; i < shnum; i++) {
+        if ((sec[i].flags & SHF_ALLOC) && (sec[i].flags & SHF_EXECINSTR)) codeBytes += sec[i].size;
+    }
+
+    std::map<std::string, bool> seenHere;   // same-named locals in one object
+    for (unsigned long i = 0; i < shnum; i++) {
+        if (sec[i].type != 2 /* SHT_SYMTAB */ || !sec[i].entsize) continue;
+        const Section& strtab = sec[sec[i].link];
+        for (unsigned long off = 0; off + sec[i].entsize <= sec[i].size; off += sec[i].entsize) {
+            const size_t e = sec[i].offset + off;
+            const unsigned long nameOff = rd(b, e, 4);
+            const unsigned info  = (unsigned)(is64 ? rd(b, e + 4, 1)  : rd(b, e + 12, 1));
+            const unsigned shndx = (unsigned)(is64 ? rd(b, e + 6, 2)  : rd(b, e + 14, 2));
+            const unsigned long size = is64 ? rd(b, e + 16, 8) : rd(b, e + 8, 4);
+            if ((info & 0xF) != 1 /* STT_OBJECT */ || shndx == 0 || shndx >= shnum || !size) continue;
+            const size_t at = strtab.offset + nameOff;
+            if (at >= b.size()) continue;
+            const std::string name = demangle((const char*)&b[at]);
+            if (name.compare(0, 12, "gingoduino::") != 0) continue;
+            const std::string key = shortName(name);
+
+            const Section& home = sec[shndx];
+            const bool relro = home.name.compare(0, 12, ".data.rel.ro") == 0;
+            if ((home.flags & SHF_WRITE) && !relro) {
+                ramStatics[key] = size;
+                continue;
+            }
+            // Local copies add up; weak/unique ones are merged by the linker
+            const bool local = (info >> 4) == 0;
+            std::map<std::string, TableInfo>::iterator it = tables.find(key);
+            if (it == tables.end()) {
+                TableInfo t = { size, 1 };
+                tables[key] = t;
+            } else if (seenHere.count(key)) {
+                it->second.size += size;
+            } else if (local) {
+                it->second.copies++;
+            }
+            seenHere[key] = true;
+        }
+    }
+    return true;
+}
+
+// Numbered strings behind a pointer table (IFN_EN_0, IFN_EN_1, ...) are
+// reported as one group, "data::IFN_EN_*".
+static void foldStringGroups() {
+    std::map<std::string, TableInfo> folded;
+    for (std::map<std::string, TableInfo>::const_iterator it = tables.begin(); it != tables.end(); ++it) {
+        const std::string& k = it->first;
+        size_t d = k.size();
+        while (d > 0 && k[d - 1] >= '0' && k[d - 1] <= '9') d--;
+        if (d == k.size() || d == 0 || k[d - 1] != '_') {
+            folded[k] = it->second;
+            continue;
+        }
+        TableInfo& g = folded[k.substr(0, d) + "*"];
+        g.size += it->second.size * it->second.copies;
+        g.copies = 1;
+    }
+    tables.swap(folded);
+}
+
+// ---------------------------------------------------------------------------
+// Call graphs (-fcallgraph-info=su)
+// ---------------------------------------------------------------------------
+
+struct Node {
+    std::string              name;     // demangled signature
+    unsigned long            frame;
+    bool                     defined;
+    bool                     dynamic;
+    std::vector<std::string> callees;  // titles, resolved later
+    int                      state;    // 0 new, 1 visiting, 2 done
+    StackInfo                result;
+};
+
+static std::map<std::string, Node>        nodes;
+static std::map<std::string, std::string> byMangled;   // mangled -> defining title
+
+static std::string quoted(const std::string& line, const char* key) {
+    size_t p = line.find(key);
+    if (p == std::string::npos) return "";
+    p += strlen(key);
+    size_t q = line.find('"', p);
+    return (q == std::string::npos) ? "" : line.substr(p, q - p);
+}
+
+static std::string mangledOf(const std::string& title) {
+    size_t c = title.rfind(':');
+    return (c == std::string::npos) ? title : title.substr(c + 1);
+}
+
+static bool readCallGraph(const char* path) {
+    FILE* f = fopen(path, "r");
+    if (!f) return false;
+    char buf[8192];
+    while (fgets(buf, sizeof(buf), f)) {
+        std::string line(buf);
+        if (line.compare(0, 6, "node: ") == 0) {
+            const std::string title = quoted(line, "title: \"");
+            const std::string label = quoted(line, "label: \"");
+            Node& n = nodes[title];
+            // The title's symbol demangles more reliably than the label
+            n.name = demangle(mangledOf(title).c_str());
+            if (n.name == mangledOf(title)) n.name = label.substr(0, label.find("\\n"));
+            size_t bytes = label.find(" bytes (");
+            if (bytes != std::string::npos) {
+                size_t start = label.rfind("\\n", bytes);
+                n.frame = strtoul(label.c_str() + start + 2, nullptr, 10);
+                n.defined = true;
+                n.dynamic = label.compare(bytes + 8, 7, "dynamic") == 0;
+                byMangled[mangledOf(title)] = title;
+            }
+        } else if (line.compare(0, 6, "edge: ") == 0) {
+            nodes[quoted(line, "sourcename: \"")].callees.push_back(quoted(line, "targetname: \""));
+        }
+    }
+    fclose(f);
+    haveStack = true;
+    return true;
+}
+
+// Defined node for a callee title, following complete/base constructor
+// and destructor aliases. nullptr for library or unknown functions.
+static Node* resolve(const std::string& title) {
+    std::map<std::string, Node>::iterator it = nodes.find(title);
+    if (it != nodes.end() && it->second.defined) return &it->second;
+    std::string m = mangledOf(title);
+    for (int pass = 0; pass < 2; pass++) {
+        std::map<std::string, std::string>::iterator d = byMangled.find(m);
+        if (d != byMangled.end()) return &nodes[d->second];
+        const char* from[] = { "C1E", "D1E", "D0E" };
+        bool changed = false;
+        for (unsigned k = 0; k < 3 && !changed; k++) {
+            size_t p = m.find(from[k]);
+            if (p != std::string::npos) { m[p + 1] = '2'; changed = true; }
+        }
+        if (!changed) break;
+    }
+    return nullptr;
+}
+
+static const StackInfo& worstStack(Node& n) {
+    if (n.state == 2) return n.result;
+    StackInfo r = { n.frame, n.frame, n.dynamic, false, false };
+    n.state = 1;
+    unsigned long deepest = 0;
+    for (size_t i = 0; i < n.callees.size(); i++) {
+        if (n.callees[i] == "__indirect_call") { r.indirect = true; continue; }
+        Node* c = resolve(n.callees[i]);
+        if (!c || c == &n) {
+            if (c) r.recursive = true;
+            continue;
+        }
+        if (c->state == 1) { r.recursive = true; continue; }
+        const StackInfo& s = worstStack(*c);
+        if (s.worst > deepest) deepest = s.worst;
+        r.dynamic   |= s.dynamic;
+        r.indirect  |= s.indirect;
+        r.recursive |= s.recursive;
+    }
+    r.worst = n.frame + deepest;
+    n.state = 2;
+    n.result = r;
+    return n.result;
+}
+
+static bool isPublic(const std::string& sig, const std::string& key) {
+    if (sig.find("gingoduino::") == std::string::npos) return false;
+    if (key.compare(0, 6, "data::") == 0) return false;
+    if (key.find("<lambda") != std::string::npos) return false;
+    if (key.find("(anonymous") != std::string::npos) return false;
+    if (key.find("()::") != std::string::npos) return false;   // local classes
+    return key.empty() || key[key.size() - 1] != '_';
+}
+
+static void analyseStacks() {
+    for (std::map<std::string, Node>::iterator it = nodes.begin(); it != nodes.end(); ++it) {
+        Node& n = it->second;
+        if (!n.defined) continue;
+        const std::string key = shortName(n.name);
+        if (!isPublic(n.name, key)) continue;
+        const StackInfo& s = worstStack(n);
+        std::map<std::string, StackInfo>::iterator e = stacks.find(key);
+        if (e == stacks.end() || s.worst > e->second.worst) stacks[key] = s;
+    }
+}
+
+// ---------------------------------------------------------------------------
+// Output
+// ---------------------------------------------------------------------------
+
+static unsigned long tableTotal() {
+    unsigned long t = 0;
+    for (std::map<std::string, TableInfo>::const_iterator it = tables.begin(); it != tables.end(); ++it) {
+        t += it->second.size * it->second.copies;
+    }
+    return t;
+}
+
+static unsigned long ramTotal() {
+    unsigned long t = 0;
+    for (std::map<std::string, unsigned long>::const_iterator it = ramStatics.begin(); it != ramStatics.end(); ++it) {
+        t += it->second;
+    }
+    return t;
+}
+
+static std::string flags(const StackInfo& s) {
+    std::string f;
+    if (s.dynamic)   f += f.empty() ? "dynamic" : ",dynamic";
+    if (s.indirect)  f += f.empty() ? "indirect" : ",indirect";
+    if (s.recursive) f += f.empty() ? "recursive" : ",recursive";
+    return f;
+}
+
+static void printReport() {
+    printf("=== Footprint, Tier %d (pointer %u bytes) ===\n\n", GINGODUINO_TIER, (unsigned)sizeof(void*));
+
+    printf("Types (sizeof)\n");
+    for (std::map<std::string, unsigned long>::const_iterator it = types.begin(); it != types.end(); ++it) {
+        printf("  %-28s %8lu\n", it->first.c_str(), it->second);
+    }
+
+    // Largest tables first
+    std::vector<std::pair<unsigned long, std::string> > order;
+    for (std::map<std::string, TableInfo>::const_iterator it = tables.begin(); it != tables.end(); ++it) {
+        order.push_back(std::make_pair(it->second.size * it->second.copies, it->first));
+    }
+    std::sort(order.rbegin(), order.rend());
+    printf("\nFlash tables (bytes x copies)\n");
+    for (size_t i = 0; i < order.size(); i++) {
+        const TableInfo& t = tables[order[i].second];
+        printf("  %-44s %8lu", order[i].second.c_str(), order[i].first);
+        if (t.copies > 1) printf("   (%lu x %u)", t.size, t.copies);
+        printf("\n");
+    }
+    printf("  %-44s %8lu\n", "total", tableTotal());
+    printf("\nCode in objects (before link)  %lu\n", codeBytes);
+
+    printf("\nStatic RAM\n");
+    for (std::map<std::string, unsigned long>::const_iterator it = ramStatics.begin(); it != ramStatics.end(); ++it) {
+        printf("  %-44s %8lu\n", it->first.c_str(), it->second);
+    }
+    printf("  %-44s %8lu\n", "total", ramTotal());
+
+    if (!haveStack) {
+        printf("\nStack: no call graphs (.ci) next to the objects\n");
+        return;
+    }
+    std::vector<std::pair<unsigned long, std::string> > deep;
+    for (std::map<std::string, StackInfo>::const_iterator it = stacks.begin(); it != stacks.end(); ++it) {
+        deep.push_back(std::make_pair(it->second.worst, it->first));
+    }
+    std::sort(deep.rbegin(), deep.rend());
+    printf("\nWorst-case stack, deepest 25 of %u public functions (frame / worst)\n",
+           (unsigned)deep.size());
+    for (size_t i = 0; i < deep.size() && i < 25; i++) {
+        const StackInfo& s = stacks[deep[i].second];
+        printf("  %-44s %6lu %7lu  %s\n", deep[i].second.c_str(), s.frame, s.worst, flags(s).c_str());
+    }
+}
+
+static void jsonStr(FILE* f, const std::string& s) {
+    fputc('"', f);
+    for (size_t i = 0; i < s.size(); i++) {
+        if (s[i] == '"' || s[i] == '\\') fputc('\\', f);
+        fputc(s[i], f);
+    }
+    fputc('"', f);
+}
+
+static bool writeJson(const char* path) {
+    FILE* f = fopen(path, "w");
+    if (!f) return false;
+    fprintf(f, "{\n  \"tier\": %d,\n  \"pointer_size\": %u,\n", GINGODUINO_TIER, (unsigned)sizeof(void*));
+
+    fprintf(f, "  \"types\": {");
+    const char* sep = "\n";
+    for (std::map<std::string, unsigned long>::const_iterator it = types.begin(); it != types.end(); ++it) {
+        fprintf(f, "%s    ", sep);
+        jsonStr(f, it->first);
+        fprintf(f, ": %lu", it->second);
+        sep = ",\n";
+    }
+    fprintf(f, "\n  },\n  \"tables\": {");
+    sep = "\n";
+    for (std::map<std::string, TableInfo>::const_iterator it = tables.begin(); it != tables.end(); ++it) {
+        fprintf(f, "%s    ", sep);
+        jsonStr(f, it->first);
+        fprintf(f, ": {\"size\": %lu, \"copies\": %u}", it->second.size, it->second.copies);
+        sep = ",\n";
+    }
+    fprintf(f, "\n  },\n  \"ram\": {");
+    sep = "\n";
+    for (std::map<std::string, unsigned long>::const_iterator it = ramStatics.begin(); it != ramStatics.end(); ++it) {
+        fprintf(f, "%s    ", sep);
+        jsonStr(f, it->first);
+        fprintf(f, ": %lu", it->second);
+        sep = ",\n";
+    }
+    fprintf(f, "\n  },\n  \"totals\": {\"tables\": %lu, \"ram\": %lu, \"code\": %lu},\n",
+            tableTotal(), ramTotal(), codeBytes);
+    fprintf(f, "  \"stack\": {");
+    sep = "\n";
+    for (std::map<std::string, StackInfo>::const_iterator it = stacks.begin(); it != stacks.end(); ++it) {
+        fprintf(f, "%s    ", sep);
+        jsonStr(f, it->first);
+        fprintf(f, ": {\"frame\": %lu, \"worst\": %lu, \"flags\": ", it->second.frame, it->second.worst);
+        jsonStr(f, flags(it->second));
+        fprintf(f, "}");
+        sep = ",\n";
+    }
+    fprintf(f, "\n  }\n}\n");
+    fclose(f);
+    return true;
+}
+
+// ---------------------------------------------------------------------------
+// Budgets
+//
+// One limit per line: TIER KIND NAME MAX, '#' starts a comment.
+//   TIER  1, 2, 3 or * (any tier)
+//   KIND  type | table | ram | stack | total
+//   NAME  as reported ("GingoField::deduce", "data::CHORD_FORMULAS");
+//         for total: tables, ram or code
+// A name missing from the report fails for an explicit tier and is
+// skipped for *. Stack limits are skipped when no call graphs were read.
+// ---------------------------------------------------------------------------
+
+static int checkBudget(const char* path) {
+    FILE* f = fopen(path, "r");
+    if (!f) {
+        fprintf(stderr, "%s: cannot open\n", path);
+        return -1;
+    }
+    printf("\n=== Budget %s ===\n", path);
+    int over = 0, checked = 0;
+    char line[512];
+    unsigned lineNo = 0;
+    while (fgets(line, sizeof(line), f)) {
+        lineNo++;
+        char* hash = strchr(line, '#');
+        if (hash) *hash = '\0';
+        char tier[8], kind[16], name[256];
+        unsigned long limit;
+        int n = sscanf(line, "%7s %15s %255s %lu", tier, kind, name, &limit);
+        if (n <= 0) continue;
+        if (n != 4) {
+            fprintf(stderr, "%s:%u: expected TIER KIND NAME MAX\n", path, lineNo);
+            fclose(f);
+            return -1;
+        }
+        const bool any = strcmp(tier, "*") == 0;
+        if (!any && atoi(tier) != GINGODUINO_TIER) continue;
+
+        bool found = true;
+        unsigned long value = 0;
+        const std::string key(name);
+        if (strcmp(kind, "type") == 0) {
+            found = types.count(key) != 0;
+            if (found) value = types[key];
+        } else if (strcmp(kind, "table") == 0) {
+            found = tables.count(key) != 0;
+            if (found) value = tables[key].size * tables[key].copies;
+        } else if (strcmp(kind, "ram") == 0) {
+            found = ramStatics.count(key) != 0;
+            if (found) value = ramStatics[key];
+        } else if (strcmp(kind, "stack") == 0) {
+            if (!haveStack) continue;
+            found = stacks.count(key) != 0;
+            if (found) value = stacks[key].worst;
+        } else if (strcmp(kind, "total") == 0) {
+            if (key == "tables")    value = tableTotal();
+            else if (key == "ram")  value = ramTotal();
+            else if (key == "code") value = codeBytes;
+            else found = false;
+        } else {
+            fprintf(stderr, "%s:%u: unknown kind '%s'\n", path, lineNo, kind);
+            fclose(f);
+            return -1;
+        }
+
+        if (!found) {
+            if (any) continue;
+            printf("  %-6s %-40s %8s / %6lu  MISSING\n", kind, name, "-", limit);
+            over++;
+            continue;
+        }
+        checked++;
+        const bool bad = value > limit;
+        printf("  %-6s %-40s %8lu / %6lu%s\n", kind, name, value, limit, bad ? "  OVER" : "");
+        if (bad) over++;
+    }
+    fclose(f);
+    printf("%d limit(s) checked, %d over\n", checked, over);
+    return over;
+}
+
+// ---------------------------------------------------------------------------
+// Main
+// ---------------------------------------------------------------------------
+
+int main(int argc, char** argv) {
+    const char* jsonPath = nullptr;
+    const char* budgetPath = nullptr;
+    std::vector<const char*> objects;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--json") == 0 && i + 1 < argc) {
+            jsonPath = argv[++i];
+        } else if (strcmp(argv[i], "--budget") == 0 && i + 1 < argc) {
+            budgetPath = argv[++i];
+        } else if (argv[i][0] == '-') {
+            fprintf(stderr, "usage: %s [--json FILE] [--budget FILE] OBJECT...\n", argv[0]);
+            return 2;
+        } else {
+            // CMake passes $<TARGET_OBJECTS> as one ;-separated argument
+            for (char* tok = strtok(argv[i], ";"); tok; tok = strtok(nullptr, ";")) {
+                objects.push_back(tok);
+            }
+        }
+    }
+
+    collectTypes();
+    for (size_t i = 0; i < objects.size(); i++) {
+        if (!scanObject(objects[i])) return 2;
+        // GCC names the call graph after the object: foo.cpp.o -> foo.cpp.ci
+        std::string ci(objects[i]);
+        size_t dot = ci.rfind('.');
+        if (dot != std::string::npos && ci.find('/', dot) == std::string::npos) ci.erase(dot);
+        readCallGraph((ci + ".ci").c_str());
+    }
+    foldStringGroups();
+    analyseStacks();
+
+    printReport();
+    if (jsonPath && !writeJson(jsonPath)) {
+        fprintf(stderr, "%s: cannot write\n", jsonPath);
+        return 2;
+    }
+    if (budgetPath) {
+        int over = checkBudget(budgetPath);
+        if (over < 0) return 2;
+        if (over > 0) return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,140 @@
+// Shape library generator - writes src/gingoduino_shapes.h.
+// Runs the fingering search once per (tuning, chord type, root) on the
+// host and emits the best position-0 shape (frets 0-4) as packed bytes.
+//
+// Build and run (from repo root):
+//   g++ -std=c++11 -O2 -DGINGODUINO_TIER=3 -I. -o extras/tools/gen_shapes extras/tools/gen_shapes.cpp
+//   ./extras/tools/gen_shapes > src/gingoduino_shapes.h
+
+// Search directly: the generated tables must not answer their own queries
+#define GINGODUINO_HAS_SHAPE_LIBRARY 0
+
+#include <cstdio>
+#include <cstring>
+#include "src/Gingoduino.h"
+
+// Pull in all .cpp files for a single-file build
+#include "src/GingoNote.cpp"
+#include "src/GingoInterval.cpp"
+#include "src/GingoChord.cpp"
+#include "src/GingoScale.cpp"
+#include "src/GingoField.cpp"
+#include "src/GingoDuration.cpp"
+#include "src/GingoTempo.cpp"
+#include "src/GingoTimeSig.cpp"
+#include "src/GingoEvent.cpp"
+#include "src/GingoSequence.cpp"
+#include "src/GingoFretboard.cpp"
+#include "src/GingoTree.cpp"
+#include "src/GingoProgression.cpp"
+#include "src/GingoMonitor.cpp"
+#include "src/GingoChordComparison.cpp"
+#include "src/GingoMIDI1.cpp"
+#include "src/GingoProfile.cpp"
+#include "src/GingoTuning.cpp"
+#include "src/GingoSynth.cpp"
+#include "src/GingoPitch.cpp"
+#include "src/GingoChroma.cpp"
+#include "src/GingoArpeggiator.cpp"
+
+using namespace gingoduino;
+
+// Chord types in the library, in table order
+static const char* const TYPES[] = {
+    "M", "m", "7", "m7", "7M", "6", "m6", "dim7", "m7(b5)", "aug", "sus2", "sus4"
+};
+static const uint8_t NUM_TYPES = sizeof(TYPES) / sizeof(TYPES[0]);
+
+struct Instrument {
+    const char*    table;    // generated array name
+    const char*    tuning;   // PROGMEM tuning array in gingoduino_progmem.h
+    GingoFretboard board;
+};
+
+int main() {
+    Instrument instruments[] = {
+        { "SHAPES_VIOLAO",     "TUNING_VIOLAO",     GingoFretboard::guitar() },
+        { "SHAPES_DROP_D",     "TUNING_DROP_D",     GingoFretboard::dropD() },
+        { "SHAPES_OPEN_G",     "TUNING_OPEN_G",     GingoFretboard::openG() },
+        { "SHAPES_DADGAD",     "TUNING_DADGAD",     GingoFretboard::dadgad() },
+        { "SHAPES_UKULELE",    "TUNING_UKULELE",    GingoFretboard::ukulele() },
+        { "SHAPES_CAVAQUINHO", "TUNING_CAVAQUINHO", GingoFretboard::cavaquinho() },
+        { "SHAPES_BANDOLIM",   "TUNING_BANDOLIM",   GingoFretboard::mandolin() },
+    };
+    const uint8_t numInstruments = sizeof(instruments) / sizeof(instruments[0]);
+
+    printf("// Gingoduino - Music Theory Library for Embedded Systems\n");
+    printf("// Precomputed position-0 chord shapes per tuning.\n");
+    printf("// Generated by extras/tools/gen_shapes.cpp - do not edit.\n");
+    printf("//\n");
+    printf("// SPDX-License-Identifier: MIT\n\n");
+    printf("#ifndef GINGODUINO_SHAPES_H\n#define GINGODUINO_SHAPES_H\n\n");
+    printf("#include \"gingoduino_progmem.h\"\n\n");
+    printf("#if GINGODUINO_HAS_SHAPE_LIBRARY\n\n");
+    printf("namespace gingoduino {\nnamespace data {\n\n");
+
+    printf("// Chord formulas covered, in table order.\n");
+    printf("static const uint8_t SHAPE_FORMULA_COUNT = %d;\n", NUM_TYPES);
+    printf("static const uint8_t SHAPE_FORMULAS[%d] PROGMEM = {", NUM_TYPES);
+    for (uint8_t t = 0; t < NUM_TYPES; t++) {
+        char name[16] = "C";
+        strcat(name, TYPES[t]);
+        printf("%s%d", t ? ", " : " ", GingoChord(name).formulaIndex());
+    }
+    printf(" };  //");
+    for (uint8_t t = 0; t < NUM_TYPES; t++) printf(" %s", TYPES[t]);
+    printf("\n\n");
+
+    printf("// Each table: [formula][root pitch class][numStrings frets + score].\n");
+    printf("// Fret bytes use the GingoPackedFingering convention (0x80 = muted);\n");
+    printf("// 0xFF in the first byte marks a chord with no shape in frets 0-4.\n");
+    printf("// One shape per chord, the best in frets 0-4. GingoFretboard::shapes()\n");
+    printf("// moves the shapes rooted on the two lowest strings up the neck as\n");
+    printf("// E-form and A-form barres.\n\n");
+
+    for (uint8_t i = 0; i < numInstruments; i++) {
+        const GingoFretboard& fb = instruments[i].board;
+        uint8_t ns = fb.numStrings();
+        printf("static const uint8_t %s[%d] PROGMEM = {\n",
+               instruments[i].table, NUM_TYPES * 12 * (ns + 1));
+        for (uint8_t t = 0; t < NUM_TYPES; t++) {
+            printf("    // %s\n", TYPES[t]);
+            for (uint8_t root = 0; root < 12; root++) {
+                char name[16];
+                data::readChromaticName(root, name, sizeof(name));
+                strcat(name, TYPES[t]);
+                GingoFingering fg;
+                printf("    ");
+                if (!fb.fingering(GingoChord(name), 0, fg)) {
+                    printf("0xFF,");
+                    for (uint8_t s = 1; s <= ns; s++) printf(" 0x00,");
+                } else {
+                    for (uint8_t s = 0; s < ns; s++) {
+                        uint8_t b = (fg.strings[s].action == STRING_MUTED) ? 0x80 : fg.strings[s].fret;
+                        printf("0x%02X, ", b);
+                    }
+                    printf("%3d,", fg.score > 254 ? 254 : fg.score);
+                }
+                printf("  // %s\n", name);
+            }
+        }
+        printf("};\n\n");
+    }
+
+    printf("struct ShapeTable {\n");
+    printf("    const uint8_t* tuning;      // open strings (PROGMEM)\n");
+    printf("    const uint8_t* shapes;      // packed shapes (PROGMEM)\n");
+    printf("    uint8_t        numStrings;\n");
+    printf("};\n\n");
+    printf("static const ShapeTable SHAPE_TABLES[] PROGMEM = {\n");
+    for (uint8_t i = 0; i < numInstruments; i++) {
+        printf("    { %s, %s, %d },\n", instruments[i].tuning, instruments[i].table,
+               instruments[i].board.numStrings());
+    }
+    printf("};\n\n");
+    printf("static const uint8_t SHAPE_TABLE_COUNT = sizeof(SHAPE_TABLES) / sizeof(SHAPE_TABLES[0]);\n\n");
+    printf("} // namespace data\n} // namespace gingoduino\n\n");
+    printf("#endif // GINGODUINO_HAS_SHAPE_LIBRARY\n");
+    printf("#endif // GINGODUINO_SHAPES_H\n");
+    return 0;
+}
@@ -0,0 +1,135 @@
+// Profile dump reader - decodes GingoProfile::dump() output and compares
+// two builds probe by probe.
+//
+// Build and run (from repo root):
+//   g++ -std=c++11 -O2 -DGINGODUINO_TIER=3 -I. -o extras/tools/profile_diff extras/tools/profile_diff.cpp
+//   ./extras/tools/profile_diff before.bin             # print one dump
+//   ./extras/tools/profile_diff before.bin after.bin   # compare two dumps
+//
+// Mean cycles per call are compared; a missing probe shows as "-".
+
+// Probe names come from the library table
+#define GINGODUINO_PROFILE 1
+
+#include <cstdio>
+#include <cstring>
+#include "src/GingoProfile.h"
+#include "src/GingoProfile.cpp"
+
+using namespace gingoduino;
+
+struct Dump {
+    uint8_t         version;
+    uint8_t         tier;
+    GingoProbeStats probes[256];
+    bool            present[256];
+};
+
+static uint32_t getU32(const uint8_t* p) {
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) |
+           ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static bool readDump(const char* path, Dump& d) {
+    FILE* f = fopen(path, "rb");
+    if (!f) {
+        fprintf(stderr, "%s: cannot open\n", path);
+        return false;
+    }
+    uint8_t buf[6 + 13 * 256];
+    size_t len = fread(buf, 1, sizeof(buf), f);
+    fclose(f);
+
+    memset(&d, 0, sizeof(d));
+    if (len < 6 || buf[0] != 'G' || buf[1] != 'P') {
+        fprintf(stderr, "%s: not a GingoProfile dump\n", path);
+        return false;
+    }
+    if (buf[2] != GingoProfile::DUMP_VERSION) {
+        fprintf(stderr, "%s: dump version %u, expected %u\n",
+                path, buf[2], GingoProfile::DUMP_VERSION);
+        return false;
+    }
+    d.version = buf[2];
+    d.tier    = buf[3];
+    const uint8_t records = buf[5];
+    if (len < 6 + 13u * records) {
+        fprintf(stderr, "%s: truncated (%u records)\n", path, records);
+        return false;
+    }
+    const uint8_t* p = buf + 6;
+    for (uint8_t i = 0; i < records; i++, p += 13) {
+        GingoProbeStats& s = d.probes[p[0]];
+        s.count = getU32(p + 1);
+        s.total = getU32(p + 5);
+        s.max   = getU32(p + 9);
+        d.present[p[0]] = true;
+    }
+    return true;
+}
+
+static const char* nameOf(unsigned id, char* tmp) {
+    const char* n = GingoProfile::probeName((uint8_t)id);
+    if (*n) return n;
+    snprintf(tmp, 16, "probe#%u", id);
+    return tmp;
+}
+
+static double mean(const GingoProbeStats& s) {
+    return s.count ? (double)s.total / s.count : 0.0;
+}
+
+static void printOne(const Dump& d) {
+    char tmp[16];
+    printf("tier %u\n", d.tier);
+    printf("%-22s %10s %12s %10s %10s\n", "probe", "calls", "total", "mean", "max");
+    for (unsigned i = 0; i < 256; i++) {
+        if (!d.present[i]) continue;
+        const GingoProbeStats& s = d.probes[i];
+        printf("%-22s %10lu %12lu %10.1f %10lu\n", nameOf(i, tmp),
+               (unsigned long)s.count, (unsigned long)s.total, mean(s),
+               (unsigned long)s.max);
+    }
+}
+
+static void printDiff(const Dump& a, const Dump& b) {
+    char tmp[16];
+    if (a.tier != b.tier) {
+        printf("note: tiers differ (%u vs %u)\n", a.tier, b.tier);
+    }
+    printf("%-22s %10s %10s %10s %8s\n", "probe", "calls", "mean A", "mean B", "delta");
+    for (unsigned i = 0; i < 256; i++) {
+        if (!a.present[i] && !b.present[i]) continue;
+        const GingoProbeStats& sa = a.probes[i];
+        const GingoProbeStats& sb = b.probes[i];
+        char ca[16], cb[16], dl[16];
+        if (a.present[i]) snprintf(ca, sizeof(ca), "%.1f", mean(sa));
+        else              strcpy(ca, "-");
+        if (b.present[i]) snprintf(cb, sizeof(cb), "%.1f", mean(sb));
+        else              strcpy(cb, "-");
+        if (a.present[i] && b.present[i] && mean(sa) > 0) {
+            snprintf(dl, sizeof(dl), "%+.1f%%", (mean(sb) / mean(sa) - 1.0) * 100.0);
+        } else {
+            strcpy(dl, "-");
+        }
+        printf("%-22s %10lu %10s %10s %8s\n", nameOf(i, tmp),
+               (unsigned long)(b.present[i] ? sb.count : sa.count), ca, cb, dl);
+    }
+}
+
+static Dump dumpA, dumpB;
+
+int main(int argc, char** argv) {
+    if (argc < 2 || argc > 3) {
+        fprintf(stderr, "usage: %s DUMP [DUMP_AFTER]\n", argv[0]);
+        return 2;
+    }
+    if (!readDump(argv[1], dumpA)) return 2;
+    if (argc == 2) {
+        printOne(dumpA);
+        return 0;
+    }
+    if (!readDump(argv[2], dumpB)) return 2;
+    printDiff(dumpA, dumpB);
+    return 0;
+}
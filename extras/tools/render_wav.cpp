@@ -0,0 +1,208 @@
+// WAV renderer - plays a GingoSequence through GingoSynth into a 16-bit
+// PCM WAV file, as fast as the host allows.
+//
+// Build and run (from repo root):
+//   g++ -std=c++11 -O2 -DGINGODUINO_TIER=3 -I. -o extras/tools/render_wav extras/tools/render_wav.cpp
+//   ./extras/tools/render_wav out.wav                      # ii-V-I demo
+//   ./extras/tools/render_wav -t 96 -w saw out.wav Am7 D7/half G7M/whole r @B4/quarter
+//
+// Events after the file name, one per argument, with an optional
+// "/duration" (default quarter):
+//   Dm7         chord at the chord octave (-o, default 4)
+//   @E5         single note, octave as the last digit
+//   r           rest
+// Options:
+//   -r RATE     sample rate (default 44100)
+//   -t BPM      tempo (default 120)
+//   -w WAVE     sine, triangle, saw or square (default triangle)
+//   -c N        channels, 1 or 2 (default 2)
+//   -o OCT      chord octave (default 4)
+//
+// The realtime factor (audio seconds per second of rendering) goes to
+// stderr. Exit: 0 ok, 1 bad event, 2 usage or IO error.
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include "src/Gingoduino.h"
+
+// Pull in all .cpp files for a single-file build (the CMake targets
+// define GINGODUINO_LINKED and link the gingoduino library instead)
+#ifndef GINGODUINO_LINKED
+#include "src/GingoNote.cpp"
+#include "src/GingoInterval.cpp"
+#include "src/GingoChord.cpp"
+#include "src/GingoScale.cpp"
+#include "src/GingoField.cpp"
+#include "src/GingoDuration.cpp"
+#include "src/GingoTempo.cpp"
+#include "src/GingoTimeSig.cpp"
+#include "src/GingoEvent.cpp"
+#include "src/GingoSequence.cpp"
+#include "src/GingoFretboard.cpp"
+#include "src/GingoTree.cpp"
+#include "src/GingoProgression.cpp"
+#include "src/GingoMonitor.cpp"
+#include "src/GingoChordComparison.cpp"
+#include "src/GingoMIDI1.cpp"
+#include "src/GingoProfile.cpp"
+#include "src/GingoTuning.cpp"
+#include "src/GingoSynth.cpp"
+#include "src/GingoPitch.cpp"
+#include "src/GingoChroma.cpp"
+#include "src/GingoArpeggiator.cpp"
+#endif
+
+using namespace gingoduino;
+
+static const char* const DEMO[] = { "Dm7/whole", "G7/whole", "C7M/whole", "C7M/whole" };
+
+static void usage(const char* argv0) {
+    fprintf(stderr,
+            "usage: %s [-r RATE] [-t BPM] [-w WAVE] [-c N] [-o OCT] out.wav [EVENT...]\n"
+            "  EVENT: CHORD[/dur] | @NOTE<octave>[/dur] | r[/dur]\n", argv0);
+}
+
+static bool parseWave(const char* s, SynthWaveform& wave) {
+    static const char* const NAMES[] = { "sine", "triangle", "saw", "square" };
+    for (uint8_t i = 0; i < 4; i++) {
+        if (strcmp(s, NAMES[i]) == 0) {
+            wave = (SynthWaveform)i;
+            return true;
+        }
+    }
+    return false;
+}
+
+// One event argument; false (with a message) if it does not parse.
+static bool parseEvent(const char* arg, uint8_t chordOctave, GingoEvent& out) {
+    char spec[32];
+    strncpy(spec, arg, sizeof(spec) - 1);
+    spec[sizeof(spec) - 1] = '\0';
+
+    GingoDuration dur("quarter");
+    char* slash = strchr(spec, '/');
+    if (slash) {
+        *slash = '\0';
+        dur = GingoDuration(slash + 1);
+        char name[16];
+        if (strcmp(dur.name(name, sizeof(name)), slash + 1) != 0) {
+            fprintf(stderr, "%s: unknown duration \"%s\"\n", arg, slash + 1);
+            return false;
+        }
+    }
+
+    if (strcmp(spec, "r") == 0) {
+        out = GingoEvent::rest(dur);
+        return true;
+    }
+    if (spec[0] == '@') {
+        const size_t len = strlen(spec);
+        if (len < 3 || spec[len - 1] < '0' || spec[len - 1] > '9') {
+            fprintf(stderr, "%s: note needs an octave, e.g. @E5\n", arg);
+            return false;
+        }
+        if (spec[1] < 'A' || spec[1] > 'G') {
+            fprintf(stderr, "%s: unknown note \"%s\"\n", arg, spec + 1);
+            return false;
+        }
+        const uint8_t octave = (uint8_t)(spec[len - 1] - '0');
+        spec[len - 1] = '\0';
+        out = GingoEvent::noteEvent(GingoNote(spec + 1), dur, octave);
+        return true;
+    }
+    GingoChord chord(spec);
+    if (spec[0] < 'A' || spec[0] > 'G' || chord.size() == 0) {
+        fprintf(stderr, "%s: unknown chord \"%s\"\n", arg, spec);
+        return false;
+    }
+    out = GingoEvent::chordEvent(chord, dur, chordOctave);
+    return true;
+}
+
+int main(int argc, char** argv) {
+    uint32_t rate = 44100;
+    float bpm = 120.0f;
+    SynthWaveform wave = WAVE_TRIANGLE;
+    uint8_t channels = 2;
+    uint8_t octave = 4;
+    int i = 1;
+
+    for (; i < argc && argv[i][0] == '-' && argv[i][1] != '\0'; i++) {
+        const char* opt = argv[i];
+        if (i + 1 >= argc) {
+            usage(argv[0]);
+            return 2;
+        }
+        const char* val = argv[++i];
+        if (strcmp(opt, "-r") == 0)       rate = (uint32_t)atol(val);
+        else if (strcmp(opt, "-t") == 0)  bpm = (float)atof(val);
+        else if (strcmp(opt, "-c") == 0)  channels = (uint8_t)atoi(val);
+        else if (strcmp(opt, "-o") == 0)  octave = (uint8_t)atoi(val);
+        else if (strcmp(opt, "-w") != 0 || !parseWave(val, wave)) {
+            usage(argv[0]);
+            return 2;
+        }
+    }
+    if (i >= argc || rate == 0 || bpm <= 0.0f || channels < 1 || channels > 2 || octave > 8) {
+        usage(argv[0]);
+        return 2;
+    }
+    const char* outPath = argv[i++];
+
+    GingoSequence seq(GingoTempo(bpm), GingoTimeSig(4, 4));
+    const int first = i;
+    const int count = (i < argc) ? argc - i : (int)(sizeof(DEMO) / sizeof(DEMO[0]));
+    for (int k = 0; k < count; k++) {
+        const char* arg = (first < argc) ? argv[first + k] : DEMO[k];
+        GingoEvent e;
+        if (!parseEvent(arg, octave, e)) return 1;
+        if (!seq.add(e)) {
+            fprintf(stderr, "%s: sequence full (%d events max)\n", arg, GINGODUINO_MAX_EVENTS);
+            return 1;
+        }
+    }
+
+    FILE* f = fopen(outPath, "wb");
+    if (!f) {
+        fprintf(stderr, "%s: cannot open\n", outPath);
+        return 2;
+    }
+
+    static GingoSynth synth(rate);
+    synth.setWaveform(wave);
+    GingoSequencePlayer player(seq, synth);
+    const uint32_t frames = player.totalFrames();
+
+    uint8_t header[GingoSynth::WAV_HEADER_SIZE];
+    synth.wavHeader(header, sizeof(header), frames, channels);
+    bool ok = fwrite(header, 1, sizeof(header), f) == sizeof(header);
+
+    // WAV samples are little-endian whatever the host
+    static int16_t block[2 * 1024];
+    uint8_t bytes[sizeof(block)];
+    const auto t0 = std::chrono::steady_clock::now();
+    uint16_t n;
+    while (ok && (n = player.render(block, 1024, channels)) > 0) {
+        const uint32_t samples = (uint32_t)n * channels;
+        for (uint32_t s = 0; s < samples; s++) {
+            bytes[2 * s]     = (uint8_t)block[s];
+            bytes[2 * s + 1] = (uint8_t)((uint16_t)block[s] >> 8);
+        }
+        ok = fwrite(bytes, 2, samples, f) == samples;
+    }
+    const double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+    if (fclose(f) != 0) ok = false;
+    if (!ok) {
+        fprintf(stderr, "%s: write failed\n", outPath);
+        return 2;
+    }
+
+    const double seconds = (double)frames / rate;
+    fprintf(stderr, "%s: %u events, %u frames, %.2f s of audio in %.3f s (%.0fx realtime)\n",
+            outPath, seq.size(), frames, seconds, elapsed,
+            elapsed > 0.0 ? seconds / elapsed : 0.0);
+    return 0;
+}
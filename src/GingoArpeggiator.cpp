@@ -0,0 +1,354 @@
+// Gingoduino - Music Theory Library for Embedded Systems
+// Implementation of GingoArpeggiator.
+//
+// SPDX-License-Identifier: MIT
+
+#include "GingoArpeggiator.h"
+
+#if GINGODUINO_HAS_ARP
+
+#include "gingoduino_progmem.h"
+
+#include <string.h>
+
+namespace gingoduino {
+
+// ---------------------------------------------------------------------------
+// Helpers
+// ---------------------------------------------------------------------------
+
+static const uint64_t ARP_US_PER_MINUTE = 60000000ULL;
+
+/// xorshift32; never returns 0 for a non-zero state.
+static uint32_t arpRandom(uint32_t& state) {
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    return state;
+}
+
+/// Insert note into an ascending list without duplicates.
+static void insertSorted(uint8_t* list, uint8_t& count, uint8_t max, uint8_t note) {
+    uint8_t i = count;
+    while (i > 0 && list[i - 1] > note) i--;
+    if (i > 0 && list[i - 1] == note) return;
+    if (count >= max) return;
+    for (uint8_t k = count; k > i; k--) list[k] = list[k - 1];
+    list[i] = note;
+    count++;
+}
+
+// ---------------------------------------------------------------------------
+// Construction and settings
+// ---------------------------------------------------------------------------
+
+GingoArpeggiator::GingoArpeggiator()
+    : heldCount_(0), chordRoot_(NONE), chordFormula_(0), chordMask_(0), scaleMask_(0),
+      length_(0), pos_(0), sounding_(NONE), last_(NONE), pattern_(ARP_UP),
+      source_(ARP_SOURCE_HELD), octaves_(1), velocity_(100), rate_(PPQN / 4 ? PPQN / 4 : 1),
+      gate_(0.5f), swing_(0.5f), bpm_(120.0f), seed_(0x9E3779B9UL), rng_(0x9E3779B9UL),
+      running_(false), now_(0), nextOn_(0), offAt_(0), stepCount_(0), clockAcc_(0),
+      noteCb_(nullptr), noteCtx_(nullptr)
+{}
+
+void GingoArpeggiator::setPattern(ArpPattern pattern) {
+    if ((uint8_t)pattern > ARP_SCALE_FILL || pattern == pattern_) return;
+    pattern_ = pattern;
+    rebuild_();
+}
+
+void GingoArpeggiator::setSource(ArpSource source) {
+    if ((uint8_t)source > ARP_SOURCE_CHORD || source == source_) return;
+    source_ = source;
+    rebuild_();
+}
+
+void GingoArpeggiator::setOctaves(uint8_t octaves) {
+    if (octaves < 1) octaves = 1;
+    if (octaves > 8) octaves = 8;
+    if (octaves == octaves_) return;
+    octaves_ = octaves;
+    rebuild_();
+}
+
+void GingoArpeggiator::setSeed(uint32_t seed) {
+    seed_ = seed ? seed : 0x9E3779B9UL;
+    rng_ = seed_;
+}
+
+void GingoArpeggiator::setVelocity(uint8_t velocity) {
+    if (velocity < 1) velocity = 1;
+    if (velocity > 127) velocity = 127;
+    velocity_ = velocity;
+}
+
+void GingoArpeggiator::setRate(const GingoDuration& duration) {
+    // Whole note = 4 * PPQN ticks
+    const int32_t den = duration.denominator();
+    if (den <= 0 || duration.numerator() <= 0) return;
+    setRate((uint16_t)(((int32_t)duration.numerator() * 4 * PPQN + den / 2) / den));
+}
+
+void GingoArpeggiator::setRate(uint16_t ticks) {
+    rate_ = ticks ? ticks : 1;
+}
+
+void GingoArpeggiator::setGate(float gate) {
+    if (gate < 0.05f) gate = 0.05f;
+    if (gate > 1.0f) gate = 1.0f;
+    gate_ = gate;
+}
+
+void GingoArpeggiator::setSwing(float swing) {
+    if (swing < 0.5f) swing = 0.5f;
+    if (swing > 0.75f) swing = 0.75f;
+    swing_ = swing;
+}
+
+void GingoArpeggiator::setTempo(float bpm) {
+    if (bpm > 0.0f) bpm_ = bpm;
+}
+
+// ---------------------------------------------------------------------------
+// Input
+// ---------------------------------------------------------------------------
+
+bool GingoArpeggiator::storeNotes_(const uint8_t* notes, uint8_t count) {
+    uint8_t sorted[MAX_HELD];
+    uint8_t n = 0;
+    for (uint8_t i = 0; notes && i < count; i++) {
+        if (notes[i] <= 127) insertSorted(sorted, n, MAX_HELD, notes[i]);
+    }
+    if (n == heldCount_ && memcmp(sorted, held_, n) == 0) return false;
+    memcpy(held_, sorted, n);
+    heldCount_ = n;
+    return true;
+}
+
+bool GingoArpeggiator::storeChord_(const GingoChord* chord) {
+    uint8_t root = NONE, formula = 0;
+    uint16_t mask = 0;
+    if (chord && chord->formulaIndex() < data::CHORD_FORMULA_COUNT) {
+        root = chord->root().semitone();
+        formula = chord->formulaIndex();
+        const uint16_t rel = pgm_read_word(&data::CHORD_FORMULA_MASKS[formula]);
+        mask = (uint16_t)(((rel << root) | (rel >> (12 - root))) & 0x0FFF);
+    }
+    if (root == chordRoot_ && formula == chordFormula_) return false;
+    chordRoot_ = root;
+    chordFormula_ = formula;
+    chordMask_ = mask;
+    return true;
+}
+
+bool GingoArpeggiator::storeField_(const GingoField* field) {
+    uint16_t mask = 0;
+    if (field) {
+        const uint16_t rel = field->scale().mask();
+        const uint8_t tonic = field->tonic().semitone();
+        mask = (uint16_t)(((rel << tonic) | (rel >> (12 - tonic))) & 0x0FFF);
+    }
+    if (mask == scaleMask_) return false;
+    scaleMask_ = mask;
+    return true;
+}
+
+void GingoArpeggiator::setNotes(const uint8_t* notes, uint8_t count) {
+    if (storeNotes_(notes, count)) rebuild_();
+}
+
+void GingoArpeggiator::setChord(const GingoChord& chord) {
+    if (storeChord_(&chord)) rebuild_();
+}
+
+void GingoArpeggiator::clearChord() {
+    if (storeChord_(nullptr)) rebuild_();
+}
+
+void GingoArpeggiator::setField(const GingoField& field) {
+    if (storeField_(&field)) rebuild_();
+}
+
+void GingoArpeggiator::clearField() {
+    if (storeField_(nullptr)) rebuild_();
+}
+
+void GingoArpeggiator::follow(const GingoMonitor& monitor) {
+    uint8_t notes[MAX_HELD];
+    const uint8_t n = monitor.heldNotes(notes, MAX_HELD);
+    bool changed = storeNotes_(notes, n);
+    changed |= storeChord_(monitor.hasChord() ? &monitor.currentChord() : nullptr);
+    changed |= storeField_(monitor.hasField() ? &monitor.currentField() : nullptr);
+    if (changed) rebuild_();
+}
+
+// ---------------------------------------------------------------------------
+// Pattern
+// ---------------------------------------------------------------------------
+
+// Sort the input into the base notes, spread them over the octaves and
+// lay out the pattern order. Runs only when the input or the pattern
+// settings change.
+void GingoArpeggiator::rebuild_() {
+    uint8_t base[MAX_HELD + 12];
+    uint8_t count = 0;
+
+    if (source_ == ARP_SOURCE_CHORD && chordRoot_ != NONE) {
+        // Formula order from the root at or below the lowest held note
+        int16_t root = 60 + chordRoot_;
+        if (heldCount_) {
+            root = held_[0] - (held_[0] % 12 + 12 - chordRoot_) % 12;
+            if (root < 0) root += 12;
+        }
+        uint8_t intervals[7];
+        uint8_t n;
+        data::readChordFormula(chordFormula_, intervals, &n);
+        for (uint8_t i = 0; i < n; i++) {
+            if (root + intervals[i] <= 127) insertSorted(base, count, sizeof(base), (uint8_t)(root + intervals[i]));
+        }
+    } else {
+        for (uint8_t i = 0; i < heldCount_; i++) {
+            const uint8_t note = held_[i];
+            if (pattern_ == ARP_CHORD_TONES && chordMask_ && !(chordMask_ & (1u << (note % 12)))) continue;
+            base[count++] = note;
+        }
+        if (pattern_ == ARP_SCALE_FILL && scaleMask_ && count > 1) {
+            // Scale notes strictly between the lowest and highest note
+            const uint8_t low = base[0], high = base[count - 1];
+            for (uint8_t note = (uint8_t)(low + 1); note < high; note++) {
+                if (scaleMask_ & (1u << (note % 12))) insertSorted(base, count, sizeof(base), note);
+            }
+        }
+    }
+
+    // Up over the octaves, every note above the previous one
+    uint8_t len = 0;
+    for (uint8_t o = 0; o < octaves_; o++) {
+        for (uint8_t i = 0; i < count && len < MAX_STEPS; i++) {
+            const uint16_t note = (uint16_t)(base[i] + 12 * o);
+            if (note > 127) break;
+            if (len == 0 || note > notes_[len - 1]) notes_[len++] = (uint8_t)note;
+        }
+    }
+
+    if (pattern_ == ARP_DOWN) {
+        for (uint8_t i = 0; i < len / 2; i++) {
+            const uint8_t t = notes_[i];
+            notes_[i] = notes_[len - 1 - i];
+            notes_[len - 1 - i] = t;
+        }
+    } else if (pattern_ == ARP_UP_DOWN) {
+        // Back down without the two ends
+        const uint8_t top = len;
+        for (uint8_t i = top > 2 ? top - 2 : 0; i > 0 && len < MAX_STEPS; i--) notes_[len++] = notes_[i];
+    }
+
+    const bool wasEmpty = length_ == 0;
+    length_ = len;
+    if (len == 0) {
+        if (sounding_ != NONE) emit_(sounding_, 0);
+        sounding_ = NONE;
+        running_ = false;
+        pos_ = 0;
+        last_ = NONE;
+        return;
+    }
+    if (pos_ >= len) pos_ = (uint8_t)(pos_ % len);
+    if (wasEmpty || !running_) {
+        // First note after silence: start now, on a fresh swing pair
+        running_ = true;
+        pos_ = 0;
+        stepCount_ = 0;
+        nextOn_ = now_;
+    }
+}
+
+// ---------------------------------------------------------------------------
+// Clock
+// ---------------------------------------------------------------------------
+
+void GingoArpeggiator::emit_(uint8_t note, uint8_t velocity) {
+    if (noteCb_) noteCb_(note, velocity, noteCtx_);
+#if GINGODUINO_TIER >= 3
+    if (noteFn_) noteFn_(note, velocity);
+#endif
+}
+
+uint8_t GingoArpeggiator::next_() {
+    if (pattern_ != ARP_RANDOM) {
+        const uint8_t note = notes_[pos_];
+        pos_ = (uint8_t)((pos_ + 1) % length_);
+        return note;
+    }
+    uint8_t i = (uint8_t)(arpRandom(rng_) % length_);
+    if (length_ > 1 && notes_[i] == last_) i = (uint8_t)((i + 1) % length_);
+    last_ = notes_[i];
+    return last_;
+}
+
+void GingoArpeggiator::noteOn_() {
+    // Swing: the first step of each pair takes swing x two steps
+    const uint32_t pair = 2u * rate_;
+    const uint32_t first = (uint32_t)(swing_ * (float)pair + 0.5f);
+    const uint32_t len = (stepCount_ & 1) ? pair - first : first;
+    stepCount_++;
+
+    sounding_ = next_();
+    emit_(sounding_, velocity_);
+    uint32_t gateTicks = (uint32_t)(gate_ * (float)len + 0.5f);
+    if (gateTicks < 1) gateTicks = 1;
+    if (gateTicks > len) gateTicks = len;
+    offAt_ = nextOn_ + gateTicks;
+    nextOn_ += len;
+}
+
+void GingoArpeggiator::tick(uint16_t ticks) {
+    const uint32_t end = now_ + ticks;
+    for (;;) {
+        // Note-off first when both edges fall on the same tick
+        if (sounding_ != NONE && offAt_ < end && (!running_ || offAt_ <= nextOn_)) {
+            now_ = offAt_;
+            emit_(sounding_, 0);
+            sounding_ = NONE;
+            continue;
+        }
+        if (running_ && nextOn_ < end) {
+            now_ = nextOn_;
+            noteOn_();
+            continue;
+        }
+        break;
+    }
+    now_ = end;
+}
+
+void GingoArpeggiator::advance(uint32_t micros) {
+    const uint64_t bpmMilli = (uint64_t)(bpm_ * 1000.0f + 0.5f);
+    clockAcc_ += (uint64_t)micros * bpmMilli * PPQN;
+    const uint64_t unit = ARP_US_PER_MINUTE * 1000ULL;
+    uint64_t ticks = clockAcc_ / unit;
+    clockAcc_ -= ticks * unit;
+    while (ticks > 0) {
+        const uint16_t n = ticks > 0xFFFF ? 0xFFFF : (uint16_t)ticks;
+        tick(n);
+        ticks -= n;
+    }
+}
+
+void GingoArpeggiator::reset() {
+    if (sounding_ != NONE) emit_(sounding_, 0);
+    sounding_ = NONE;
+    now_ = 0;
+    nextOn_ = 0;
+    offAt_ = 0;
+    stepCount_ = 0;
+    clockAcc_ = 0;
+    pos_ = 0;
+    last_ = NONE;
+    rng_ = seed_;
+    running_ = length_ > 0;
+}
+
+} // namespace gingoduino
+
+#endif // GINGODUINO_HAS_ARP
@@ -0,0 +1,240 @@
+// Gingoduino - Music Theory Library for Embedded Systems
+// GingoArpeggiator: tick-clocked arpeggiator fed by GingoMonitor.
+//
+// Turns the held notes (or the chord the monitor detected, spread over
+// octaves) into a stream of note-on / note-off edges on a tick clock.
+// The pattern is rebuilt only when the notes, chord or field change; the
+// clock itself only compares tick counts.
+//
+//   GingoArpeggiator arp;
+//   arp.setPattern(ARP_UP_DOWN);
+//   arp.setRate(GingoDuration("sixteenth"));
+//   arp.onNote([](uint8_t note, uint8_t vel, void*) { midiOut(note, vel); });
+//   arp.follow(monitor);                 // after feeding the monitor
+//   arp.advance(micros() - last);        // or arp.tick() per clock pulse
+//
+// SPDX-License-Identifier: MIT
+
+#ifndef GINGO_ARPEGGIATOR_H
+#define GINGO_ARPEGGIATOR_H
+
+#include "gingoduino_config.h"
+
+#if GINGODUINO_HAS_ARP
+
+#include "gingoduino_types.h"
+#include "GingoChord.h"
+#include "GingoField.h"
+#include "GingoDuration.h"
+#include "GingoMonitor.h"
+
+#if GINGODUINO_TIER >= 3
+  #include <functional>
+#endif
+
+namespace gingoduino {
+
+/// Order in which the arpeggiator walks its notes.
+enum ArpPattern : uint8_t {
+    ARP_UP          = 0,   ///< lowest to highest
+    ARP_DOWN        = 1,   ///< highest to lowest
+    ARP_UP_DOWN     = 2,   ///< up, then down without repeating the ends
+    ARP_RANDOM      = 3,   ///< seeded random order, no immediate repeats
+    ARP_CHORD_TONES = 4,   ///< up, only the tones of the current chord
+    ARP_SCALE_FILL  = 5    ///< up, every scale note between the lowest and highest note
+};
+
+/// Where the arpeggiator takes its notes from.
+enum ArpSource : uint8_t {
+    ARP_SOURCE_HELD  = 0,  ///< the held notes
+    ARP_SOURCE_CHORD = 1   ///< the current chord's formula, rooted at or below the lowest held note
+};
+
+/// Tempo-synced arpeggiator.
+///
+/// Time is counted in ticks of GINGODUINO_ARP_PPQN per quarter note. The
+/// host either calls tick() from a clock (an external MIDI clock at 24
+/// PPQN is tick(PPQN / 24) per pulse) or advance() with elapsed
+/// microseconds at the tempo set with setTempo(). Each step lasts the
+/// rate; with swing the first step of each pair takes the swing fraction
+/// of the pair. A note sounds for the gate fraction of its step (1 =
+/// legato: its note-off comes right before the next note-on).
+///
+/// Edges go to onNote() as (note, velocity), velocity 0 for note-off.
+/// The first note after silence starts the pattern at once; releasing
+/// every note ends the sounding step at once.
+///
+/// The notes come from setNotes() / setChord() / setField() or from a
+/// GingoMonitor through follow(). They are sorted and spread over
+/// setOctaves() octaves into a pattern of up to GINGODUINO_ARP_MAX_STEPS
+/// steps; that happens only when the input changes, so calling follow()
+/// every loop costs a comparison. All state is in the object (about 100
+/// bytes plus the pattern); no allocation.
+///
+/// Examples:
+///   GingoArpeggiator arp;
+///   arp.setOctaves(2);
+///   arp.setSwing(0.66f);
+///   const uint8_t cmaj[] = { 60, 64, 67 };
+///   arp.setNotes(cmaj, 3);
+///   arp.tick(GingoArpeggiator::PPQN);   // one beat: four sixteenths
+class GingoArpeggiator {
+public:
+    static const uint8_t  MAX_STEPS = GINGODUINO_ARP_MAX_STEPS;
+    static const uint16_t PPQN      = GINGODUINO_ARP_PPQN;
+
+    /// Called on every edge; velocity 0 is a note-off.
+    typedef void (*NoteCallback)(uint8_t midiNum, uint8_t velocity, void* ctx);
+
+    /// Up over held notes, one octave, sixteenths, gate 0.5, no swing,
+    /// 120 BPM, velocity 100.
+    GingoArpeggiator();
+
+    // -- Pattern --
+
+    void setPattern(ArpPattern pattern);
+    ArpPattern pattern() const { return pattern_; }
+
+    void setSource(ArpSource source);
+    ArpSource source() const { return source_; }
+
+    /// Octaves the notes are repeated over (1-8).
+    void setOctaves(uint8_t octaves);
+    uint8_t octaves() const { return octaves_; }
+
+    /// Seed of ARP_RANDOM; reset() restarts the same sequence.
+    void setSeed(uint32_t seed);
+
+    /// Velocity of every note-on (1-127).
+    void setVelocity(uint8_t velocity);
+    uint8_t velocity() const { return velocity_; }
+
+    // -- Timing --
+
+    /// Step length as a note value (sixteenth = PPQN / 4 ticks).
+    void setRate(const GingoDuration& duration);
+
+    /// Step length in ticks (at least 1).
+    void setRate(uint16_t ticks);
+    uint16_t rate() const { return rate_; }
+
+    /// Fraction of the step a note sounds, 0.05-1 (1 = legato).
+    void setGate(float gate);
+    float gate() const { return gate_; }
+
+    /// Share of each pair of steps taken by the first one, 0.5 (straight)
+    /// to 0.75; 0.66 is a triplet shuffle.
+    void setSwing(float swing);
+    float swing() const { return swing_; }
+
+    /// Tempo used by advance(), in BPM.
+    void setTempo(float bpm);
+    float tempo() const { return bpm_; }
+
+    // -- Input --
+
+    /// Notes to arpeggiate (any order, duplicates ignored, up to 16).
+    void setNotes(const uint8_t* notes, uint8_t count);
+
+    /// Chord for ARP_SOURCE_CHORD and ARP_CHORD_TONES.
+    void setChord(const GingoChord& chord);
+    void clearChord();
+
+    /// Field whose scale ARP_SCALE_FILL walks.
+    void setField(const GingoField& field);
+    void clearField();
+
+    /// Take the held notes, chord and field from a monitor. Call it after
+    /// feeding the monitor; nothing is rebuilt if they did not change.
+    void follow(const GingoMonitor& monitor);
+
+    // -- Output --
+
+    void onNote(NoteCallback cb, void* ctx = nullptr) {
+        noteCb_ = cb;
+        noteCtx_ = ctx;
+    }
+
+#if GINGODUINO_TIER >= 3
+    /// Lambda variant (both fire when both are set).
+    void onNote(std::function<void(uint8_t, uint8_t)> fn) { noteFn_ = fn; }
+#endif
+
+    // -- Clock --
+
+    /// Advance the clock by ticks, firing every edge that falls in them.
+    void tick(uint16_t ticks = 1);
+
+    /// Advance by elapsed time at the current tempo. The remainder below
+    /// a tick is kept for the next call.
+    void advance(uint32_t micros);
+
+    /// Release the sounding note and restart the pattern and the clock.
+    void reset();
+
+    // -- State --
+
+    /// Pattern length in steps (up-down includes the way back).
+    uint8_t steps() const { return length_; }
+
+    /// Note at a pattern position (0xFF past the end). For ARP_RANDOM the
+    /// pattern is the pool the steps are drawn from, lowest first.
+    uint8_t step(uint8_t index) const { return index < length_ ? notes_[index] : 0xFF; }
+
+    /// Sounding note (0xFF = none).
+    uint8_t playing() const { return sounding_; }
+
+    /// Clock position in ticks.
+    uint32_t ticks() const { return now_; }
+
+private:
+    static const uint8_t MAX_HELD = 16;
+    static const uint8_t NONE = 0xFF;
+
+    uint8_t  notes_[MAX_STEPS];    ///< the pattern
+    uint8_t  held_[MAX_HELD];      ///< input notes, ascending
+    uint8_t  heldCount_;
+    uint8_t  chordRoot_;           ///< pitch class, NONE = no chord
+    uint8_t  chordFormula_;
+    uint16_t chordMask_;           ///< pitch classes of the chord
+    uint16_t scaleMask_;           ///< pitch classes of the field (0 = none)
+    uint8_t  length_;
+    uint8_t  pos_;                 ///< next pattern position
+    uint8_t  sounding_;
+    uint8_t  last_;                ///< last random pick
+    ArpPattern pattern_;
+    ArpSource source_;
+    uint8_t  octaves_;
+    uint8_t  velocity_;
+    uint16_t rate_;
+    float    gate_;
+    float    swing_;
+    float    bpm_;
+    uint32_t seed_;
+    uint32_t rng_;
+    bool     running_;
+    uint32_t now_;                 ///< next tick to process
+    uint32_t nextOn_;              ///< tick of the next note-on
+    uint32_t offAt_;               ///< tick of the sounding note's note-off
+    uint32_t stepCount_;           ///< steps since the pattern started (swing parity)
+    uint64_t clockAcc_;            ///< advance() remainder, us x BPM x PPQN
+
+    NoteCallback noteCb_;
+    void*        noteCtx_;
+#if GINGODUINO_TIER >= 3
+    std::function<void(uint8_t, uint8_t)> noteFn_;
+#endif
+
+    bool storeNotes_(const uint8_t* notes, uint8_t count);
+    bool storeChord_(const GingoChord* chord);
+    bool storeField_(const GingoField* field);
+    void rebuild_();
+    void emit_(uint8_t note, uint8_t velocity);
+    void noteOn_();
+    uint8_t next_();
+};
+
+} // namespace gingoduino
+
+#endif // GINGODUINO_HAS_ARP
+#endif // GINGO_ARPEGGIATOR_H
@@ -82,6 +82,30 @@ uint8_t GingoChord::notes(GingoNote* output, uint8_t maxNotes) const {
     return written;
 }
 
+uint8_t GingoChord::formalNotes(GingoNote* output, uint8_t maxNotes) const {
+    if (formulaIdx_ == 255 || !output) return 0;
+
+    uint8_t intervals[7];
+    uint8_t count;
+    data::readChordFormula(formulaIdx_, intervals, &count);
+
+    // A sixth beside a b5 and no perfect fifth is a diminished seventh
+    bool flatFive = false, fifth = false;
+    for (uint8_t i = 0; i < count; i++) {
+        if (intervals[i] == 6) flatFive = true;
+        if (intervals[i] == 7) fifth = true;
+    }
+
+    const GingoNote root(rootStr_.c_str());
+    uint8_t written = 0;
+    for (uint8_t i = 0; i < count && written < maxNotes; i++) {
+        uint8_t steps = pgm_read_byte(&data::CHORD_TONE_STEPS[intervals[i]]);
+        if (intervals[i] == 9 && flatFive && !fifth) steps = 6;
+        output[written++] = root.spell(intervals[i], steps);
+    }
+    return written;
+}
+
 uint8_t GingoChord::intervalLabels(LabelStr* output, uint8_t maxLabels) const {
     if (formulaIdx_ == 255 || !output) return 0;
 
@@ -152,6 +176,7 @@ uint8_t GingoChord::intervals(GingoInterval* output, uint8_t maxIntervals) const
 
 bool GingoChord::identify(const GingoNote* notes, uint8_t count,
                           char* output, uint8_t maxLen) {
+    GINGODUINO_PROBE(PROBE_CHORD_IDENTIFY);
     if (!notes || count == 0 || !output || maxLen < 2) return false;
 
     // Get root semitone (first note)
@@ -192,32 +217,9 @@ bool GingoChord::identify(const GingoNote* notes, uint8_t count,
                 pos++;
             }
 
-            // Find canonical name for this formula index
-            // (shortest name that maps to this index)
-            char bestName[10] = "";
-            uint8_t bestLen = 255;
-            for (uint8_t a = 0; a < data::CHORD_TYPE_MAP_SIZE; a++) {
-                uint8_t idx = pgm_read_byte(&data::CHORD_TYPE_MAP[a].formulaIdx);
-                if (idx == fi) {
-                    char aliasName[10];
-                    data::readPgmStr(aliasName, data::CHORD_TYPE_MAP[a].name, sizeof(aliasName));
-                    uint8_t alen = (uint8_t)strlen(aliasName);
-                    // Prefer shortest alphanumeric name
-                    bool hasAlpha = false;
-                    for (uint8_t c = 0; c < alen; c++) {
-                        if ((aliasName[c] >= 'A' && aliasName[c] <= 'Z') ||
-                            (aliasName[c] >= 'a' && aliasName[c] <= 'z') ||
-                            (aliasName[c] >= '0' && aliasName[c] <= '9')) {
-                            hasAlpha = true;
-                            break;
-                        }
-                    }
-                    if (hasAlpha && alen < bestLen) {
-                        bestLen = alen;
-                        for (uint8_t c = 0; c <= alen; c++) bestName[c] = aliasName[c];
-                    }
-                }
-            }
+            // Canonical name for this formula index
+            char bestName[10];
+            data::readCanonicalChordType(fi, bestName, sizeof(bestName));
 
             // Append type name
             uint8_t ti = 0;
@@ -233,4 +235,72 @@ bool GingoChord::identify(const GingoNote* notes, uint8_t count,
     return false;
 }
 
+// ---------------------------------------------------------------------------
+// Mask-based identification
+// ---------------------------------------------------------------------------
+
+uint8_t GingoChord::identifyMask(uint16_t pcMask, uint8_t bassPc,
+                                 ChordMatch* output, uint8_t maxResults) {
+    GINGODUINO_PROBE(PROBE_CHORD_IDENTIFY_MASK);
+    if (!output || maxResults == 0) return 0;
+    pcMask &= 0x0FFF;
+    if (bassPc != 255 && !(pcMask & (1u << (bassPc % 12)))) bassPc = 255;
+
+    uint8_t written = 0;
+
+    for (uint8_t root = 0; root < 12; root++) {
+        if (!(pcMask & (1u << root))) continue;
+        // Rotate so the candidate root sits at bit 0
+        uint16_t rel = (uint16_t)(((pcMask >> root) | (pcMask << (12 - root))) & 0x0FFF);
+        uint8_t inversion = (bassPc != 255 && bassPc != root) ? 4 : 0;
+
+        // Binary search for the first index entry with this mask
+        uint8_t lo = 0, hi = data::CHORD_MASK_INDEX_COUNT;
+        while (lo < hi) {
+            uint8_t mid = (uint8_t)((lo + hi) / 2);
+            if (pgm_read_word(&data::CHORD_MASK_INDEX[mid].mask) < rel) lo = (uint8_t)(mid + 1);
+            else hi = mid;
+        }
+
+        for (; lo < data::CHORD_MASK_INDEX_COUNT &&
+               pgm_read_word(&data::CHORD_MASK_INDEX[lo].mask) == rel; lo++) {
+            uint8_t fi   = pgm_read_byte(&data::CHORD_MASK_INDEX[lo].formula);
+            uint8_t rank = (uint8_t)(pgm_read_byte(&data::CHORD_MASK_INDEX[lo].rank) + inversion);
+            if (written == maxResults) {
+                const ChordMatch& last = output[written - 1];
+                if (rank > last.rank || (rank == last.rank && fi >= last.formula)) continue;
+                written--;
+            }
+
+            // Insertion into the sorted output
+            uint8_t pos = written;
+            while (pos > 0 && (output[pos - 1].rank > rank ||
+                   (output[pos - 1].rank == rank && output[pos - 1].formula > fi))) {
+                output[pos] = output[pos - 1];
+                pos--;
+            }
+            ChordMatch& m = output[pos];
+            m.root    = root;
+            m.formula = fi;
+            m.bass    = bassPc;
+            m.rank    = rank;
+
+            char buf[20];
+            data::readChromaticName(root, buf, 4);
+            uint8_t len = (uint8_t)strlen(buf);
+            data::readCanonicalChordType(fi, buf + len, (uint8_t)(sizeof(buf) - len));
+            if (inversion) {
+                len = (uint8_t)strlen(buf);
+                if ((size_t)len + 4 <= sizeof(buf)) {
+                    buf[len++] = '/';
+                    data::readChromaticName(bassPc, buf + len, 4);
+                }
+            }
+            m.name.set(buf);
+            written++;
+        }
+    }
+    return written;
+}
+
 } // namespace gingoduino
@@ -13,6 +13,16 @@
 
 namespace gingoduino {
 
+/// Result of GingoChord::identifyMask() - one candidate reading of a
+/// pitch-class set.
+struct ChordMatch {
+    NameStr name;      ///< e.g. "Am7", "CM/E" (slash bass for inversions)
+    uint8_t root;      ///< root pitch class (C = 0)
+    uint8_t formula;   ///< index in CHORD_FORMULAS
+    uint8_t bass;      ///< lowest sounding pitch class (255 = unknown)
+    uint8_t rank;      ///< 0 = exact, root in bass; +2 fifth omitted; +4 inversion
+};
+
 /// Represents a musical chord - a root note plus a set of intervals.
 ///
 /// Constructed from a name string (e.g. "Cm7", "Db7M", "A#m") and
@@ -52,6 +62,12 @@ public:
     /// Returns the number of notes written.
     uint8_t notes(GingoNote* output, uint8_t maxNotes) const;
 
+    /// Fill output array with chord tones spelled from the root by
+    /// letter: each tone takes the letter of its chord degree ("Bb7" ->
+    /// Bb D F Ab, "Caug" -> C E G#, "Bdim7" -> B D F Ab).
+    /// Returns the number of notes written.
+    uint8_t formalNotes(GingoNote* output, uint8_t maxNotes) const;
+
     /// Fill output array with interval labels.
     /// Returns the number of labels written.
     uint8_t intervalLabels(LabelStr* output, uint8_t maxLabels) const;
@@ -68,6 +84,16 @@ public:
     static bool identify(const GingoNote* notes, uint8_t count,
                          char* output, uint8_t maxLen);
 
+    /// Identify chords from a pitch-class mask (bit p = pitch class p).
+    /// Every sounding pitch class is tried as root by binary search in the
+    /// sorted formula mask index (CHORD_MASK_INDEX), so inversions and
+    /// doubled tones resolve; seventh and larger chords may omit the
+    /// fifth. bassPc (255 = unknown) selects root position over
+    /// inversions, which are named with a slash bass. Writes candidates
+    /// best-first (rank, then formula index) and returns the count.
+    static uint8_t identifyMask(uint16_t pcMask, uint8_t bassPc,
+                                ChordMatch* output, uint8_t maxResults);
+
     /// Fill output array with GingoInterval objects for this chord.
     /// Returns the number of intervals written.
     uint8_t intervals(GingoInterval* output, uint8_t maxIntervals) const;
@@ -9,6 +9,7 @@
 
 #include <stdint.h>
 #include <string.h>
+#include "gingoduino_progmem.h"
 
 namespace gingoduino {
 
@@ -16,78 +17,45 @@ namespace gingoduino {
 // Internal helpers
 // ===========================================================================
 
-/// Build a 12-bit pitch class bitmask from a chord's notes.
-static uint16_t pcMaskFromChord_(const GingoChord& chord) {
-    GingoNote notes[GINGODUINO_MAX_CHORD_NOTES];
-    uint8_t n = chord.notes(notes, GINGODUINO_MAX_CHORD_NOTES);
-    uint16_t mask = 0;
-    for (uint8_t i = 0; i < n; i++) {
-        mask |= (uint16_t)(1u << (notes[i].semitone() % 12));
-    }
-    return mask;
-}
-
-/// Build a 12-bit bitmask of interval semitones from root.
-/// Bit i = semitone interval i (0-11) is present in chord's structure.
-static uint16_t intervalMaskFromChord_(const GingoChord& chord) {
-    GingoNote notes[GINGODUINO_MAX_CHORD_NOTES];
-    uint8_t n = chord.notes(notes, GINGODUINO_MAX_CHORD_NOTES);
-    uint8_t root_pc = (uint8_t)(chord.root().semitone() % 12);
-    uint16_t mask = 0;
-    for (uint8_t i = 0; i < n; i++) {
-        uint8_t interval = (uint8_t)((notes[i].semitone() % 12 - root_pc + 12) % 12);
-        mask |= (uint16_t)(1u << interval);
-    }
-    return mask;
-}
-
 /// Count bits in a 12-bit bitmask.
-static uint8_t popcount12_(uint16_t mask) {
+static inline uint8_t popcount12_(uint16_t mask) {
+#if defined(__GNUC__)
+    return (uint8_t)__builtin_popcount(mask & 0x0FFFu);
+#else
     uint8_t count = 0;
     mask &= 0x0FFF;
-    while (mask) { count += (mask & 1); mask >>= 1; }
+    while (mask) { mask &= (uint16_t)(mask - 1); count++; }
     return count;
+#endif
 }
 
 /// Chromatic distance: shortest arc on the circle of semitones (0-6).
-static uint8_t chromaticDist_(uint8_t a, uint8_t b) {
+static inline uint8_t chromaticDist_(uint8_t a, uint8_t b) {
     uint8_t d = (uint8_t)((b + 12 - a) % 12);
     return (d > 6) ? (uint8_t)(12 - d) : d;
 }
 
 /// Rotate a 12-bit pitch class bitmask by n semitones upward.
 /// Bit i → bit (i+n)%12.
-static uint16_t rotatePc_(uint16_t mask, uint8_t n) {
-    uint16_t result = 0;
+static inline uint16_t rotatePc_(uint16_t mask, uint8_t n) {
     n = n % 12;
-    for (uint8_t i = 0; i < 12; i++) {
-        if (mask & (uint16_t)(1u << i)) {
-            result |= (uint16_t)(1u << ((i + n) % 12));
-        }
-    }
-    return result;
+    mask &= 0x0FFF;
+    if (n == 0) return mask;
+    return (uint16_t)(((mask << n) | (mask >> (12 - n))) & 0x0FFF);
 }
 
 /// Compute the Forte interval-class vector for a pitch class bitmask.
 /// Output: iv[0..5] where iv[i] = count of note pairs with interval class (i+1).
 /// Interval class ic(d) = min(d, 12-d) for chromatic distance d.
 static void computeIntervalVector_(uint16_t pc_mask, uint8_t iv[6]) {
-    for (uint8_t i = 0; i < 6; i++) iv[i] = 0;
-    for (uint8_t i = 0; i < 12; i++) {
-        if (!(pc_mask & (uint16_t)(1u << i))) continue;
-        for (uint8_t j = i + 1; j < 12; j++) {
-            if (!(pc_mask & (uint16_t)(1u << j))) continue;
-            uint8_t d = j - i;
-            uint8_t ic = (d > 6) ? (uint8_t)(12 - d) : d;
-            if (ic > 0 && ic <= 6) iv[ic - 1]++;
-        }
+    // Pairs at distance d are the bits shared by the mask and its rotation
+    // by d; d and 12-d give the same class, and d = 6 counts each pair twice.
+    for (uint8_t d = 1; d <= 6; d++) {
+        uint8_t n = popcount12_(pc_mask & rotatePc_(pc_mask, d));
+        iv[d - 1] = (d == 6) ? (uint8_t)(n / 2) : n;
     }
 }
 
-// ===========================================================================
-// Voice leading (minimum sum of chromatic distances over all pairings)
-// ===========================================================================
-
 /// In-place sort of a uint8_t array (insertion sort - stable, tiny N).
 static void sortU8_(uint8_t* a, uint8_t n) {
     for (uint8_t i = 1; i < n; i++) {
@@ -98,55 +66,26 @@ static void sortU8_(uint8_t* a, uint8_t n) {
     }
 }
 
-/// Advance to next lexicographic permutation of array a[0..n-1].
-/// Returns false if already at last permutation.
-static bool nextPerm_(uint8_t* a, uint8_t n) {
-    int8_t i = (int8_t)(n - 2);
-    while (i >= 0 && a[i] >= a[i + 1]) i--;
-    if (i < 0) return false;
-    int8_t j = (int8_t)(n - 1);
-    while (a[j] <= a[i]) j--;
-    uint8_t t = a[i]; a[i] = a[j]; a[j] = t;
-    uint8_t lo = (uint8_t)(i + 1), hi = (uint8_t)(n - 1);
-    while (lo < hi) { t = a[lo]; a[lo] = a[hi]; a[hi] = t; lo++; hi--; }
-    return true;
-}
-
-/// Compute minimum voice leading distance between two chords of equal size.
-/// Returns -1 if sizes differ.
-static int8_t computeVoiceLeading_(const GingoChord& a, const GingoChord& b) {
-    uint8_t na = a.size(), nb = b.size();
-    if (na != nb || na == 0) return -1;
-
-    GingoNote notesA[GINGODUINO_MAX_CHORD_NOTES];
-    GingoNote notesB[GINGODUINO_MAX_CHORD_NOTES];
-    a.notes(notesA, GINGODUINO_MAX_CHORD_NOTES);
-    b.notes(notesB, GINGODUINO_MAX_CHORD_NOTES);
-
-    // Extract pitch classes
-    uint8_t pcA[GINGODUINO_MAX_CHORD_NOTES];
-    uint8_t pcB[GINGODUINO_MAX_CHORD_NOTES];
-    for (uint8_t i = 0; i < na; i++) {
-        pcA[i] = (uint8_t)(notesA[i].semitone() % 12);
-        pcB[i] = (uint8_t)(notesB[i].semitone() % 12);
-    }
-
-    // Sort B to start from lexicographically first permutation
-    sortU8_(pcB, na);
+// ===========================================================================
+// Voice leading (minimum sum of chromatic distances over all pairings)
+// ===========================================================================
 
-    int16_t minSum = 127;
-    do {
-        int16_t sum = 0;
-        for (uint8_t i = 0; i < na; i++) {
-            sum += chromaticDist_(pcA[i], pcB[i]);
+/// Minimum voice leading between two ascending pitch class lists of equal
+/// size. On the circle an optimal pairing is always a cyclic shift of the
+/// sorted orders, so n shifts replace the n! permutations.
+static int8_t voiceLeadingSorted_(const uint8_t* a, const uint8_t* b, uint8_t n) {
+    if (n == 0) return -1;
+    uint8_t best = 255;
+    for (uint8_t k = 0; k < n; k++) {
+        uint8_t sum = 0;
+        uint8_t j = k;
+        for (uint8_t i = 0; i < n; i++) {
+            sum = (uint8_t)(sum + chromaticDist_(a[i], b[j]));
+            if (++j == n) j = 0;
         }
-        if (sum < minSum) {
-            minSum = sum;
-            if (minSum == 0) break;  // can't do better
-        }
-    } while (nextPerm_(pcB, na));
-
-    return (int8_t)minSum;
+        if (sum < best) best = sum;
+    }
+    return (int8_t)best;
 }
 
 // ===========================================================================
@@ -183,13 +122,13 @@ static void applyNeoStep_(uint8_t& root, bool& isMajor, uint8_t op) {
 }
 
 /// Detect Neo-Riemannian transformation from A to B.
-/// Returns NEO_NONE if no 1 or 2-step path is found.
-static uint8_t detectNeoRiemannian_(const GingoChord& a, const GingoChord& b) {
-    bool aMajor, bMajor;
-    if (!isTriad_(a, aMajor) || !isTriad_(b, bMajor)) return NEO_NONE;
+/// Returns NEO_NONE if either is not a M/m triad or no 1 or 2-step path is found.
+static uint8_t detectNeoRiemannian_(const GingoChordProfile& a,
+                                    const GingoChordProfile& b) {
+    if (!a.triad || !b.triad) return NEO_NONE;
 
-    uint8_t aRoot = (uint8_t)(a.root().semitone() % 12);
-    uint8_t bRoot = (uint8_t)(b.root().semitone() % 12);
+    const bool aMajor = (a.triad == 1), bMajor = (b.triad == 1);
+    const uint8_t aRoot = a.root, bRoot = b.root;
 
     // Single-step candidates
     static const uint8_t SINGLE[] = { NEO_P, NEO_L, NEO_R };
@@ -219,77 +158,501 @@ static uint8_t detectNeoRiemannian_(const GingoChord& a, const GingoChord& b) {
     return NEO_NONE;
 }
 
+// ===========================================================================
+// Pair dimensions over profiles
+// ===========================================================================
+
+/// Smallest n with rotate(A, n) == B, or -1.
+/// Both sets reduce to the same tn_class when related; the rotations are
+/// unique modulo the class's period.
+static inline int8_t transposition_(const GingoChordProfile& a,
+                                    const GingoChordProfile& b) {
+    if (a.tn_class != b.tn_class || a.tn_period == 0) return -1;
+    return (int8_t)(((a.tn_offset + 12 - b.tn_offset) % 12) % a.tn_period);
+}
+
+static inline int8_t rootDirection_(const GingoChordProfile& a,
+                                    const GingoChordProfile& b) {
+    int8_t diff = (int8_t)((int)b.root - (int)a.root);
+    if (diff > 6)  diff = (int8_t)(diff - 12);
+    if (diff < -6) diff = (int8_t)(diff + 12);
+    return diff;
+}
+
+static inline uint8_t subset_(uint16_t pcA, uint16_t pcB) {
+    if (pcA == pcB)          return CHORD_SUBSET_EQUAL;
+    if ((pcA & pcB) == pcA)  return CHORD_SUBSET_A_IN_B;
+    if ((pcA & pcB) == pcB)  return CHORD_SUBSET_B_IN_A;
+    return CHORD_SUBSET_NONE;
+}
+
+static inline int8_t voiceLeading_(const GingoChordProfile& a,
+                                   const GingoChordProfile& b) {
+    if (a.size != b.size) return -1;
+    return voiceLeadingSorted_(a.pcs, b.pcs, a.size);
+}
+
+static inline int8_t dimensionOf_(const GingoChordProfile& a,
+                                  const GingoChordProfile& b, uint8_t dim) {
+    switch (dim) {
+        case CMP_COMMON_COUNT:     return (int8_t)popcount12_(a.pc_mask & b.pc_mask);
+        case CMP_ROOT_DISTANCE: {
+            int8_t d = rootDirection_(a, b);
+            return (int8_t)(d < 0 ? -d : d);
+        }
+        case CMP_ROOT_DIRECTION:   return rootDirection_(a, b);
+        case CMP_SAME_QUALITY:     return (int8_t)(a.formula == b.formula);
+        case CMP_SAME_SIZE:        return (int8_t)(a.size == b.size);
+        case CMP_COMMON_INTERVALS:
+            return (int8_t)popcount12_(a.interval_mask & b.interval_mask);
+        case CMP_ENHARMONIC:       return (int8_t)(a.pc_mask == b.pc_mask);
+        case CMP_SUBSET:           return (int8_t)subset_(a.pc_mask, b.pc_mask);
+        case CMP_INVERSION:
+            return (int8_t)(a.pc_mask == b.pc_mask && a.root != b.root);
+        case CMP_TRANSPOSITION:    return transposition_(a, b);
+        case CMP_VOICE_LEADING:    return voiceLeading_(a, b);
+        case CMP_TRANSFORMATION:   return (int8_t)detectNeoRiemannian_(a, b);
+        case CMP_SAME_INTERVAL_VECTOR:
+            return (int8_t)(memcmp(a.interval_vector, b.interval_vector, 6) == 0);
+        default:                   return 0;
+    }
+}
+
+/// Dimensions where (A, B) and (B, A) always agree.
+static inline bool symmetricDim_(uint8_t dim) {
+    switch (dim) {
+        case CMP_ROOT_DIRECTION:
+        case CMP_SUBSET:
+        case CMP_TRANSPOSITION:
+        case CMP_TRANSFORMATION:
+            return false;
+        default:
+            return true;
+    }
+}
+
+// ===========================================================================
+// GingoChordComparison::profile
+// ===========================================================================
+
+/// Fill the parts of a profile that the flags need. Masks come straight
+/// from the PROGMEM formula masks; no GingoNote is built.
+static void buildProfile_(const GingoChord& chord, uint16_t flags,
+                          GingoChordProfile& p) {
+    memset(&p, 0, sizeof(p));
+    p.tn_period = 1;   // the empty set maps onto itself under every rotation
+    p.formula = chord.formulaIndex();
+    if (p.formula >= data::CHORD_FORMULA_COUNT) return;
+
+    p.root          = (uint8_t)(chord.root().semitone() % 12);
+    p.interval_mask = pgm_read_word(&data::CHORD_FORMULA_MASKS[p.formula]);
+    p.pc_mask       = rotatePc_(p.interval_mask, p.root);
+
+    uint8_t intervals[7];
+    uint8_t count;
+    data::readChordFormula(p.formula, intervals, &count);
+    p.size = (count < GINGODUINO_MAX_CHORD_NOTES) ? count : (uint8_t)GINGODUINO_MAX_CHORD_NOTES;
+
+    if (flags & CMP_F_VOICE_LEADING) {
+        for (uint8_t i = 0; i < p.size; i++) {
+            p.pcs[i] = (uint8_t)((p.root + intervals[i]) % 12);
+        }
+        sortU8_(p.pcs, p.size);
+    }
+
+    if (flags & CMP_F_TRANSFORMATION) {
+        bool major;
+        if (isTriad_(chord, major)) p.triad = major ? 1 : 2;
+    }
+
+    if (flags & CMP_F_INTERVAL_VECTOR) {
+        computeIntervalVector_(p.pc_mask, p.interval_vector);
+    }
+
+    if (flags & CMP_F_TRANSPOSITION) {
+        // Transposition class: lowest rotation, and the symmetry period
+        p.tn_class  = p.pc_mask;
+        p.tn_offset = 0;
+        for (uint8_t r = 1; r < 12; r++) {
+            uint16_t rot = rotatePc_(p.pc_mask, r);
+            if (rot < p.tn_class) { p.tn_class = rot; p.tn_offset = r; }
+        }
+        p.tn_period = 12;
+        for (uint8_t r = 1; r < 12; r++) {
+            if (rotatePc_(p.tn_class, r) == p.tn_class) { p.tn_period = r; break; }
+        }
+    }
+}
+
+GingoChordProfile GingoChordComparison::profile(const GingoChord& chord) {
+    GingoChordProfile p;
+    buildProfile_(chord, CMP_F_ALL, p);
+    return p;
+}
+
 // ===========================================================================
 // GingoChordComparison::compute
 // ===========================================================================
 
-GingoChordComparison GingoChordComparison::compute(const GingoChord& a,
-                                                    const GingoChord& b) {
+GingoChordComparison GingoChordComparison::compute(const GingoChordProfile& pa,
+                                                    const GingoChordProfile& pb,
+                                                    uint16_t flags) {
     GingoChordComparison c;
     memset(&c, 0, sizeof(c));
 
-    // ── Pitch class sets ─────────────────────────────────────────────────────
-    uint16_t pcA = pcMaskFromChord_(a);
-    uint16_t pcB = pcMaskFromChord_(b);
+    uint16_t pcA = pa.pc_mask;
+    uint16_t pcB = pb.pc_mask;
 
-    c.common_pc      = pcA & pcB;
-    c.exclusive_a_pc = pcA & ~pcB;
-    c.exclusive_b_pc = pcB & ~pcA;
-    c.common_count   = popcount12_(c.common_pc);
+    // ── Pitch class sets ─────────────────────────────────────────────────────
+    if (flags & CMP_F_OVERLAP) {
+        c.common_pc      = pcA & pcB;
+        c.exclusive_a_pc = pcA & ~pcB;
+        c.exclusive_b_pc = pcB & ~pcA;
+        c.common_count   = popcount12_(c.common_pc);
+    }
 
     // ── Root geometry ─────────────────────────────────────────────────────────
-    uint8_t ra = (uint8_t)(a.root().semitone() % 12);
-    uint8_t rb = (uint8_t)(b.root().semitone() % 12);
-
-    int8_t diff = (int8_t)((int)rb - (int)ra);
-    if (diff > 6)  diff = (int8_t)(diff - 12);
-    if (diff < -6) diff = (int8_t)(diff + 12);
-
-    c.root_direction = diff;
-    c.root_distance  = (uint8_t)(diff < 0 ? -diff : diff);
+    if (flags & CMP_F_ROOT) {
+        int8_t diff = rootDirection_(pa, pb);
+        c.root_direction = diff;
+        c.root_distance  = (uint8_t)(diff < 0 ? -diff : diff);
+    }
 
     // ── Quality match ─────────────────────────────────────────────────────────
-    c.same_quality        = (strcmp(a.type(), b.type()) == 0);
-    c.same_size           = (a.size() == b.size());
-    c.common_interval_mask = intervalMaskFromChord_(a) & intervalMaskFromChord_(b);
+    if (flags & CMP_F_QUALITY) {
+        c.same_quality         = (pa.formula == pb.formula);
+        c.same_size            = (pa.size == pb.size);
+        c.common_interval_mask = pa.interval_mask & pb.interval_mask;
+    }
 
     // ── Set theory ────────────────────────────────────────────────────────────
-    c.enharmonic = (pcA == pcB);
-
-    if (pcA == pcB) {
-        c.subset = CHORD_SUBSET_EQUAL;
-    } else if ((pcA & pcB) == pcA) {
-        c.subset = CHORD_SUBSET_A_IN_B;
-    } else if ((pcA & pcB) == pcB) {
-        c.subset = CHORD_SUBSET_B_IN_A;
-    } else {
-        c.subset = CHORD_SUBSET_NONE;
+    if (flags & CMP_F_SET) {
+        c.enharmonic = (pcA == pcB);
+        c.subset     = subset_(pcA, pcB);
+        c.inversion  = (pcA == pcB) && (pa.root != pb.root);
     }
+    if (flags & CMP_F_TRANSPOSITION) c.transposition = transposition_(pa, pb);
 
-    c.inversion = (pcA == pcB) && (ra != rb);
+    // ── Voice leading ─────────────────────────────────────────────────────────
+    if (flags & CMP_F_VOICE_LEADING) c.voice_leading = voiceLeading_(pa, pb);
+
+    // ── Neo-Riemannian ────────────────────────────────────────────────────────
+    if (flags & CMP_F_TRANSFORMATION) c.transformation = detectNeoRiemannian_(pa, pb);
+
+    // ── Forte interval vectors ─────────────────────────────────────────────────
+    if (flags & CMP_F_INTERVAL_VECTOR) {
+        memcpy(c.interval_vector_a, pa.interval_vector, 6);
+        memcpy(c.interval_vector_b, pb.interval_vector, 6);
+        c.same_interval_vector =
+            (memcmp(c.interval_vector_a, c.interval_vector_b, 6) == 0);
+    }
 
-    // T_n transposition: find n such that rotate(pcA, n) == pcB
-    c.transposition = -1;
-    for (uint8_t n = 0; n < 12; n++) {
-        if (rotatePc_(pcA, n) == pcB) {
-            c.transposition = (int8_t)n;
+    return c;
+}
+
+GingoChordComparison GingoChordComparison::compute(const GingoChord& a,
+                                                    const GingoChord& b,
+                                                    uint16_t flags) {
+    GingoChordProfile pa, pb;
+    buildProfile_(a, flags, pa);
+    buildProfile_(b, flags, pb);
+    GingoChordComparison c = compute(pa, pb, flags);
+
+    // Chords carry their type string: keep the spelling-level quality match
+    if (flags & CMP_F_QUALITY) {
+        c.same_quality = (strcmp(a.type(), b.type()) == 0);
+        c.same_size    = (a.size() == b.size());
+    }
+    return c;
+}
+
+GingoChordComparison GingoChordComparison::compute(const GingoChord& a,
+                                                    const GingoChord& b) {
+    return compute(a, b, CMP_F_ALL);
+}
+
+// ===========================================================================
+// Batch comparison
+// ===========================================================================
+
+int8_t GingoChordComparison::dimension(const GingoChordProfile& a,
+                                       const GingoChordProfile& b, uint8_t dim) {
+    return dimensionOf_(a, b, dim);
+}
+
+#if GINGODUINO_MATRIX_TILE > 0
+
+// Columns of a matrix() tile, one array per profile field, so each
+// dimension is a straight loop over plain integers that the compiler can
+// vectorize (SSE2 / NEON on hosts); no branch depends on the data.
+struct ProfileTile_ {
+    uint16_t pc[GINGODUINO_MATRIX_TILE];
+    uint16_t intervals[GINGODUINO_MATRIX_TILE];
+    uint16_t tnClass[GINGODUINO_MATRIX_TILE];
+    uint8_t  root[GINGODUINO_MATRIX_TILE];
+    uint8_t  formula[GINGODUINO_MATRIX_TILE];
+    uint8_t  size[GINGODUINO_MATRIX_TILE];
+    uint8_t  tnResidue[GINGODUINO_MATRIX_TILE];  // tn_offset mod tn_period
+    uint32_t ivLow[GINGODUINO_MATRIX_TILE];      // interval vector ic1-ic4
+    uint16_t ivHigh[GINGODUINO_MATRIX_TILE];     // interval vector ic5-ic6
+};
+
+static inline uint32_t ivLow_(const uint8_t iv[6]) {
+    return (uint32_t)iv[0] | ((uint32_t)iv[1] << 8) | ((uint32_t)iv[2] << 16) |
+           ((uint32_t)iv[3] << 24);
+}
+
+static inline uint16_t ivHigh_(const uint8_t iv[6]) {
+    return (uint16_t)(iv[4] | (iv[5] << 8));
+}
+
+static inline uint8_t tnResidue_(const GingoChordProfile& p) {
+    return p.tn_period ? (uint8_t)(p.tn_offset % p.tn_period) : 0;
+}
+
+/// Bit count of a 12-bit mask without a loop or builtin (vectorizes).
+static inline uint8_t swarPopcount12_(uint16_t x) {
+    x = (uint16_t)(x - ((x >> 1) & 0x5555u));
+    x = (uint16_t)((x & 0x3333u) + ((x >> 2) & 0x3333u));
+    x = (uint16_t)((x + (x >> 4)) & 0x0F0Fu);
+    return (uint8_t)((x + (x >> 8)) & 0x1Fu);
+}
+
+/// Dimensions with a tile kernel; voice leading and transformation stay
+/// per pair.
+static inline bool hasKernel_(uint8_t dim) {
+    return dim < CMP_DIM_COUNT && dim != CMP_VOICE_LEADING && dim != CMP_TRANSFORMATION;
+}
+
+/// Fill row[0..n) with dimension dim of (a, tile column j), for a dim
+/// that hasKernel_().
+static void tileKernel_(const GingoChordProfile& a, const ProfileTile_& t,
+                        uint8_t n, uint8_t dim, int8_t* row) {
+    switch (dim) {
+        case CMP_COMMON_COUNT:
+            for (uint8_t j = 0; j < n; j++) {
+                row[j] = (int8_t)swarPopcount12_((uint16_t)(a.pc_mask & t.pc[j]));
+            }
+            break;
+        case CMP_COMMON_INTERVALS:
+            for (uint8_t j = 0; j < n; j++) {
+                row[j] = (int8_t)swarPopcount12_((uint16_t)(a.interval_mask & t.intervals[j]));
+            }
+            break;
+        case CMP_ROOT_DISTANCE:
+            for (uint8_t j = 0; j < n; j++) {
+                int8_t d = (int8_t)(t.root[j] - a.root);
+                d = (int8_t)(d + ((d < 0) ? 12 : 0));
+                row[j] = (int8_t)((d > 6) ? 12 - d : d);
+            }
+            break;
+        case CMP_ROOT_DIRECTION:
+            for (uint8_t j = 0; j < n; j++) {
+                int8_t d = (int8_t)(t.root[j] - a.root);
+                d = (int8_t)(d - ((d > 6) ? 12 : 0) + ((d < -6) ? 12 : 0));
+                row[j] = d;
+            }
+            break;
+        case CMP_SAME_QUALITY:
+            for (uint8_t j = 0; j < n; j++) row[j] = (int8_t)(t.formula[j] == a.formula);
+            break;
+        case CMP_SAME_SIZE:
+            for (uint8_t j = 0; j < n; j++) row[j] = (int8_t)(t.size[j] == a.size);
+            break;
+        case CMP_ENHARMONIC:
+            for (uint8_t j = 0; j < n; j++) row[j] = (int8_t)(t.pc[j] == a.pc_mask);
+            break;
+        case CMP_SUBSET:
+            // NONE 0, A_IN_B 1, B_IN_A 2, EQUAL 3: the two inclusions as bits
+            for (uint8_t j = 0; j < n; j++) {
+                uint16_t common = (uint16_t)(a.pc_mask & t.pc[j]);
+                row[j] = (int8_t)((common == a.pc_mask) | ((common == t.pc[j]) << 1));
+            }
+            break;
+        case CMP_INVERSION:
+            for (uint8_t j = 0; j < n; j++) {
+                row[j] = (int8_t)((t.pc[j] == a.pc_mask) & (t.root[j] != a.root));
+            }
+            break;
+        case CMP_TRANSPOSITION: {
+            // Equal classes share the period p, which divides 12, so
+            // (offA - offB) mod 12 mod p = (offA mod p - offB mod p) mod p
+            if (a.tn_period == 0) {
+                memset(row, -1, n);
+                break;
+            }
+            const int8_t p = (int8_t)a.tn_period;
+            const int8_t ra = (int8_t)tnResidue_(a);
+            for (uint8_t j = 0; j < n; j++) {
+                int8_t x = (int8_t)(ra - (int8_t)t.tnResidue[j]);
+                x = (int8_t)(x + ((x < 0) ? p : 0));
+                row[j] = (t.tnClass[j] == a.tn_class) ? x : (int8_t)-1;
+            }
             break;
         }
+        case CMP_SAME_INTERVAL_VECTOR: {
+            const uint32_t lo = ivLow_(a.interval_vector);
+            const uint16_t hi = ivHigh_(a.interval_vector);
+            for (uint8_t j = 0; j < n; j++) {
+                row[j] = (int8_t)((t.ivLow[j] == lo) & (t.ivHigh[j] == hi));
+            }
+            break;
+        }
+        default:
+            break;
     }
+}
 
-    // ── Voice leading ─────────────────────────────────────────────────────────
-    c.voice_leading = computeVoiceLeading_(a, b);
+#endif // GINGODUINO_MATRIX_TILE
+
+void GingoChordComparison::matrix(const GingoChordProfile* profiles, uint16_t count,
+                                  const uint8_t* dims, uint8_t dimCount,
+                                  int8_t* output) {
+    if (!profiles || !dims || !output) return;
+    const uint32_t plane = (uint32_t)count * count;
+
+#if GINGODUINO_MATRIX_TILE > 0
+    // Kernel dimensions: one tile of columns at a time, every row
+    ProfileTile_ tile;
+    for (uint16_t j0 = 0; j0 < count; j0 += GINGODUINO_MATRIX_TILE) {
+        const uint8_t n = (uint8_t)((count - j0 < GINGODUINO_MATRIX_TILE)
+                                    ? count - j0 : GINGODUINO_MATRIX_TILE);
+        for (uint8_t j = 0; j < n; j++) {
+            const GingoChordProfile& b = profiles[j0 + j];
+            tile.pc[j]        = b.pc_mask;
+            tile.intervals[j] = b.interval_mask;
+            tile.tnClass[j]   = b.tn_class;
+            tile.root[j]      = b.root;
+            tile.formula[j]   = b.formula;
+            tile.size[j]      = b.size;
+            tile.tnResidue[j] = tnResidue_(b);
+            tile.ivLow[j]     = ivLow_(b.interval_vector);
+            tile.ivHigh[j]    = ivHigh_(b.interval_vector);
+        }
+        for (uint8_t d = 0; d < dimCount; d++) {
+            if (!hasKernel_(dims[d])) continue;
+            int8_t* out = output + d * plane + j0;
+            for (uint16_t i = 0; i < count; i++) {
+                tileKernel_(profiles[i], tile, n, dims[d], out + (uint32_t)i * count);
+            }
+        }
+    }
+#endif
+
+    // Per-pair dimensions, one plane each, filled row by row so the writes
+    // stay sequential; symmetric ones fill the upper triangle and mirror.
+    for (uint8_t d = 0; d < dimCount; d++) {
+        int8_t* out = output + d * plane;
+        const uint8_t dim = dims[d];
+#if GINGODUINO_MATRIX_TILE > 0
+        if (hasKernel_(dim)) continue;
+#endif
+        if (symmetricDim_(dim)) {
+            for (uint16_t i = 0; i < count; i++) {
+                int8_t* row = out + (uint32_t)i * count;
+                for (uint16_t j = i; j < count; j++) {
+                    row[j] = dimensionOf_(profiles[i], profiles[j], dim);
+                }
+                for (uint16_t j = 0; j < i; j++) {
+                    row[j] = out[(uint32_t)j * count + i];
+                }
+            }
+        } else {
+            for (uint16_t i = 0; i < count; i++) {
+                int8_t* row = out + (uint32_t)i * count;
+                for (uint16_t j = 0; j < count; j++) {
+                    row[j] = dimensionOf_(profiles[i], profiles[j], dim);
+                }
+            }
+        }
+    }
+}
 
-    // ── Neo-Riemannian ────────────────────────────────────────────────────────
-    c.transformation = detectNeoRiemannian_(a, b);
+bool GingoChordComparison::matrix(const GingoChord* chords, uint8_t count,
+                                  const uint8_t* dims, uint8_t dimCount,
+                                  int8_t* output) {
+    if (!chords || count > GINGODUINO_MAX_MATRIX_CHORDS) return false;
+    GingoChordProfile profiles[GINGODUINO_MAX_MATRIX_CHORDS];
+    for (uint8_t i = 0; i < count; i++) profiles[i] = profile(chords[i]);
+    matrix(profiles, count, dims, dimCount, output);
+    return true;
+}
 
-    // ── Forte interval vectors ─────────────────────────────────────────────────
-    computeIntervalVector_(pcA, c.interval_vector_a);
-    computeIntervalVector_(pcB, c.interval_vector_b);
-    c.same_interval_vector =
-        (memcmp(c.interval_vector_a, c.interval_vector_b, 6) == 0);
+// ===========================================================================
+// Concrete voicings
+// ===========================================================================
 
-    return c;
+/// Voice indices in ascending pitch (insertion sort - stable, tiny N).
+static void sortVoices_(const uint8_t* pitch, uint8_t n, uint8_t* order) {
+    for (uint8_t i = 0; i < n; i++) order[i] = i;
+    for (uint8_t i = 1; i < n; i++) {
+        uint8_t key = order[i];
+        int8_t j = (int8_t)(i - 1);
+        while (j >= 0 && pitch[order[j]] > pitch[key]) { order[j + 1] = order[j]; j--; }
+        order[j + 1] = key;
+    }
+}
+
+int16_t GingoChordComparison::voiceLeading(const uint8_t* from, uint8_t fromCount,
+                                           const uint8_t* to, uint8_t toCount,
+                                           VoiceMove* output, uint8_t maxMoves) {
+    if (!from || !to || fromCount == 0 || toCount == 0) return -1;
+    if (fromCount > GINGODUINO_MAX_VOICES || toCount > GINGODUINO_MAX_VOICES) return -1;
+
+    uint8_t fromOrder[GINGODUINO_MAX_VOICES], toOrder[GINGODUINO_MAX_VOICES];
+    sortVoices_(from, fromCount, fromOrder);
+    sortVoices_(to, toCount, toOrder);
+
+    // Walk the larger voicing L; each of its voices lands on one voice of
+    // the smaller voicing S, whose index advances by 0 (doubling) or 1.
+    const bool fromLarger = (fromCount >= toCount);
+    const uint8_t* lPitch = fromLarger ? from : to;
+    const uint8_t* sPitch = fromLarger ? to : from;
+    const uint8_t* lOrder = fromLarger ? fromOrder : toOrder;
+    const uint8_t* sOrder = fromLarger ? toOrder : fromOrder;
+    const uint8_t  p = fromLarger ? fromCount : toCount;
+    const uint8_t  q = fromLarger ? toCount : fromCount;
+
+    // cost[i][j]: least movement for L[0..i] with L[i] on S[j].
+    // stay[i] bit j: L[i-1] was also on S[j] (else on S[j-1]).
+    const uint16_t INF = 0xFFFF;
+    uint16_t cost[GINGODUINO_MAX_VOICES][GINGODUINO_MAX_VOICES];
+    uint16_t stay[GINGODUINO_MAX_VOICES];
+    for (uint8_t i = 0; i < p; i++) {
+        stay[i] = 0;
+        const uint8_t lp = lPitch[lOrder[i]];
+        for (uint8_t j = 0; j < q; j++) {
+            const uint8_t sp = sPitch[sOrder[j]];
+            const uint16_t d = (uint16_t)(lp > sp ? lp - sp : sp - lp);
+            uint16_t best;
+            if (i == 0) {
+                best = (j == 0) ? 0 : INF;
+            } else {
+                best = (j > 0) ? cost[i - 1][j - 1] : INF;
+                if (cost[i - 1][j] < best) {
+                    best = cost[i - 1][j];
+                    stay[i] |= (uint16_t)(1u << j);
+                }
+            }
+            cost[i][j] = (best == INF) ? INF : (uint16_t)(best + d);
+        }
+    }
+
+    // Trace back from the last voice of each
+    if (output) {
+        uint8_t j = (uint8_t)(q - 1);
+        for (int8_t i = (int8_t)(p - 1); i >= 0; i--) {
+            if (i < maxMoves) {
+                const uint8_t li = lOrder[i], si = sOrder[j];
+                VoiceMove& m = output[i];
+                m.from   = fromLarger ? li : si;
+                m.to     = fromLarger ? si : li;
+                m.motion = (int8_t)((int)to[m.to] - (int)from[m.from]);
+            }
+            if (i > 0 && !(stay[i] & (1u << j))) j--;
+        }
+    }
+    return (int16_t)cost[p - 1][q - 1];
 }
 
 // ===========================================================================
@@ -311,6 +674,18 @@ const char* GingoChordComparison::transformationName(uint8_t t) {
     }
 }
 
+const char* GingoChordComparison::transformationName(uint8_t t, char* buf, uint8_t maxLen) {
+    if (!buf || maxLen == 0) return buf;
+    const char* name = transformationName(t);
+    uint8_t i = 0;
+    while (name[i] && i < maxLen - 1) {
+        buf[i] = name[i];
+        i++;
+    }
+    buf[i] = '\0';
+    return buf;
+}
+
 } // namespace gingoduino
 
 #endif // GINGODUINO_HAS_COMPARISON
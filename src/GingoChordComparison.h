@@ -68,6 +68,69 @@ enum NeoRiemannianTransform : uint8_t {
     NEO_PL = 9   ///< P then L  (CM → AbM)
 };
 
+/// Dimension selectors for GingoChordComparison::matrix() and dimension().
+/// Each selects one int8_t value per chord pair (booleans are 0/1).
+enum ChordCompareDim : uint8_t {
+    CMP_COMMON_COUNT         = 0,   ///< common_count
+    CMP_ROOT_DISTANCE        = 1,   ///< root_distance
+    CMP_ROOT_DIRECTION       = 2,   ///< root_direction
+    CMP_SAME_QUALITY         = 3,   ///< same chord formula (aliases match)
+    CMP_SAME_SIZE            = 4,   ///< same_size
+    CMP_COMMON_INTERVALS     = 5,   ///< popcount of common_interval_mask
+    CMP_ENHARMONIC           = 6,   ///< enharmonic
+    CMP_SUBSET               = 7,   ///< subset (ChordSubsetRelation)
+    CMP_INVERSION            = 8,   ///< inversion
+    CMP_TRANSPOSITION        = 9,   ///< transposition (-1 = none)
+    CMP_VOICE_LEADING        = 10,  ///< voice_leading (-1 = sizes differ)
+    CMP_TRANSFORMATION       = 11,  ///< transformation (NeoRiemannianTransform)
+    CMP_SAME_INTERVAL_VECTOR = 12,  ///< same_interval_vector
+    CMP_DIM_COUNT            = 13
+};
+
+/// Dimension groups for the flags overloads of GingoChordComparison::compute().
+/// Fields outside the requested groups are left zero.
+enum ChordCompareFlags : uint16_t {
+    CMP_F_OVERLAP         = 0x0001,  ///< common_pc, exclusive_*_pc, common_count
+    CMP_F_ROOT            = 0x0002,  ///< root_distance, root_direction
+    CMP_F_QUALITY         = 0x0004,  ///< same_quality, same_size, common_interval_mask
+    CMP_F_SET             = 0x0008,  ///< enharmonic, subset, inversion
+    CMP_F_TRANSPOSITION   = 0x0010,  ///< transposition
+    CMP_F_VOICE_LEADING   = 0x0020,  ///< voice_leading
+    CMP_F_TRANSFORMATION  = 0x0040,  ///< transformation
+    CMP_F_INTERVAL_VECTOR = 0x0080,  ///< interval_vector_a/b, same_interval_vector
+    CMP_F_ALL             = 0x00FF
+};
+
+/// One voice pairing found by GingoChordComparison::voiceLeading().
+struct VoiceMove {
+    uint8_t from;    ///< index in the source voicing (as passed in)
+    uint8_t to;      ///< index in the target voicing (as passed in)
+    int8_t  motion;  ///< signed semitones, target pitch - source pitch
+};
+
+// ===========================================================================
+// GingoChordProfile
+// ===========================================================================
+
+/// Per-chord data used by the comparison, computed once per chord.
+///
+/// Batch comparisons build one profile per chord and then compare
+/// profiles, so notes, masks and interval vectors are never rebuilt
+/// per pair.
+struct GingoChordProfile {
+    uint16_t pc_mask;        ///< pitch classes present (bit i = semitone i)
+    uint16_t interval_mask;  ///< intervals from root present
+    uint16_t tn_class;       ///< lowest rotation of pc_mask (same for all T_n)
+    uint8_t  tn_offset;      ///< smallest rotation taking pc_mask to tn_class
+    uint8_t  tn_period;      ///< smallest rotation mapping tn_class onto itself
+    uint8_t  root;           ///< root pitch class (0-11)
+    uint8_t  size;           ///< number of notes
+    uint8_t  formula;        ///< index in CHORD_FORMULAS (255 = unknown)
+    uint8_t  triad;          ///< 0 = not a M/m triad, 1 = major, 2 = minor
+    uint8_t  interval_vector[6];                   ///< Forte vector
+    uint8_t  pcs[GINGODUINO_MAX_CHORD_NOTES];      ///< pitch classes, ascending
+};
+
 // ===========================================================================
 // GingoChordComparison
 // ===========================================================================
@@ -170,9 +233,91 @@ struct GingoChordComparison {
     /// Compute the full comparison between chords A and B.
     static GingoChordComparison compute(const GingoChord& a, const GingoChord& b);
 
+    /// Compute only the dimension groups in flags (ChordCompareFlags).
+    /// The bitmask groups cost a few table reads and popcounts; voice
+    /// leading, transformation and interval vectors are evaluated only
+    /// when asked for.
+    ///
+    ///   GingoChordComparison c = GingoChordComparison::compute(a, b,
+    ///       CMP_F_OVERLAP | CMP_F_ROOT);
+    ///   c.common_count; c.root_distance;   // everything else is 0
+    static GingoChordComparison compute(const GingoChord& a, const GingoChord& b,
+                                        uint16_t flags);
+
+    /// Same, from precomputed profiles (see profile()). For search loops
+    /// that compare one chord against many fixed candidates.
+    /// same_quality compares chord formulas, so type aliases match.
+    static GingoChordComparison compute(const GingoChordProfile& a,
+                                        const GingoChordProfile& b,
+                                        uint16_t flags = CMP_F_ALL);
+
     /// Human-readable name for a NeoRiemannianTransform enum value.
     /// Returns "P", "L", "R", "RP", "RL", "LP", "LR", "PR", "PL", or "".
+    /// The result is a string literal, safe to share between threads.
     static const char* transformationName(uint8_t t);
+
+    /// Same, copied into caller storage (truncated to maxLen - 1). Returns buf.
+    static const char* transformationName(uint8_t t, char* buf, uint8_t maxLen);
+
+    // ── Batch comparison ───────────────────────────────────────────────────────
+
+    /// Precompute the per-chord data used by dimension() and matrix().
+    static GingoChordProfile profile(const GingoChord& chord);
+
+    /// One comparison dimension (ChordCompareDim) between two profiles.
+    /// Returns 0 for an unknown dimension.
+    static int8_t dimension(const GingoChordProfile& a, const GingoChordProfile& b,
+                            uint8_t dim);
+
+    /// Fill an all-pairs matrix of the selected dimensions.
+    ///
+    /// Output holds one count x count plane per entry of dims, row-major:
+    /// output[d * count * count + i * count + j] is dimension dims[d] of
+    /// (profiles[i], profiles[j]). Output must hold dimCount * count * count
+    /// values.
+    ///
+    /// Columns are gathered GINGODUINO_MATRIX_TILE at a time into one array
+    /// per profile field, and every dimension except voice leading and
+    /// transformation is filled by a branch-free loop over that tile (SIMD
+    /// on hosts at -O3). The other two are evaluated per pair.
+    ///
+    ///   GingoChord c[7];  field.chords(c, 7);
+    ///   const uint8_t dims[] = { CMP_COMMON_COUNT, CMP_VOICE_LEADING };
+    ///   int8_t m[2 * 7 * 7];
+    ///   GingoChordComparison::matrix(c, 7, dims, 2, m);
+    ///   // m[0 * 49 + 0 * 7 + 5] = common notes of I and vi
+    static void matrix(const GingoChordProfile* profiles, uint16_t count,
+                       const uint8_t* dims, uint8_t dimCount, int8_t* output);
+
+    /// Same, building the profiles on the stack.
+    /// Returns false if count exceeds GINGODUINO_MAX_MATRIX_CHORDS.
+    static bool matrix(const GingoChord* chords, uint8_t count,
+                       const uint8_t* dims, uint8_t dimCount, int8_t* output);
+
+    // ── Concrete voicings ──────────────────────────────────────────────────────
+
+    /// Minimal total semitone movement between two MIDI voicings, with
+    /// register (unlike voice_leading, which works on pitch classes).
+    ///
+    /// Every voice of the larger voicing moves to exactly one voice of the
+    /// smaller one, and every voice of the smaller one is used, so a
+    /// 3 -> 4 change doubles one voice and 4 -> 3 merges two. Equal sizes
+    /// pair voices one to one. Voices may be given in any order; an
+    /// optimal pairing never crosses, so a DP over the sorted voices
+    /// finds it in at most MAX_VOICES^2 steps.
+    ///
+    /// Writes max(fromCount, toCount) moves (up to maxMoves, output may be
+    /// null) sorted by source pitch, then target pitch: a doubled source
+    /// (fromCount < toCount) appears in adjacent moves, lower target first.
+    /// Returns the total movement, or -1 if either voicing is empty or has
+    /// more than GINGODUINO_MAX_VOICES.
+    ///
+    ///   const uint8_t c[] = { 48, 64, 67, 72 }, g7[] = { 47, 62, 65, 67 };
+    ///   VoiceMove m[4];
+    ///   GingoChordComparison::voiceLeading(c, 4, g7, 4, m, 4);  // 1+2+2+5 = 10
+    static int16_t voiceLeading(const uint8_t* from, uint8_t fromCount,
+                                const uint8_t* to, uint8_t toCount,
+                                VoiceMove* output, uint8_t maxMoves);
 };
 
 } // namespace gingoduino
@@ -0,0 +1,412 @@
+// Gingoduino - Music Theory Library for Embedded Systems
+// Implementation of GingoChroma.
+//
+// SPDX-License-Identifier: MIT
+
+#include "GingoChroma.h"
+
+#if GINGODUINO_HAS_CHROMA
+
+#include "gingoduino_progmem.h"
+
+namespace gingoduino {
+
+// ---------------------------------------------------------------------------
+// Helpers
+// ---------------------------------------------------------------------------
+
+static const uint8_t CHORD_CONFIRM_HOPS = 2;   // hops a new chord must win
+static const uint8_t CHORD_RELEASE_HOPS = 2;   // gated hops before the chord clears
+
+// Weight of a chord tone's overtones in its template: the 3rd harmonic
+// lands a fifth up, the 5th harmonic a major third up.
+static const float OVERTONE_FIFTH = 0.2f;
+static const float OVERTONE_THIRD = 0.05f;
+
+// Lowest peak at least this fraction of the loudest one is the bass; a
+// chord rooted on it gets BASS_BONUS added to its correlation, which
+// settles readings of the same pitch classes (Am7 / C6).
+static const float BASS_LEVEL = 0.25f;
+static const float BASS_BONUS = 0.05f;
+
+// Krumhansl-Kessler key profiles, tonic first.
+static const float KEY_PROFILES[2][12] PROGMEM = {
+    { 6.35f, 2.23f, 3.48f, 2.33f, 4.38f, 4.09f, 2.52f, 5.19f, 2.39f, 3.66f, 2.29f, 2.88f },
+    { 6.33f, 2.68f, 3.52f, 5.38f, 2.60f, 3.53f, 2.54f, 4.75f, 3.98f, 2.69f, 3.34f, 3.17f },
+};
+
+/// Subtract the mean and scale to unit length; false for a flat vector.
+static bool centre(const float* in, float* out) {
+    float mean = 0.0f;
+    for (uint8_t i = 0; i < 12; i++) mean += in[i];
+    mean /= 12.0f;
+    float norm = 0.0f;
+    for (uint8_t i = 0; i < 12; i++) {
+        out[i] = in[i] - mean;
+        norm += out[i] * out[i];
+    }
+    if (norm <= 1e-12f) return false;
+    norm = 1.0f / sqrtf(norm);
+    for (uint8_t i = 0; i < 12; i++) out[i] *= norm;
+    return true;
+}
+
+/// Correlation of a centred chroma with a centred template rotated to root.
+static float correlate(const float* c, const float* t, uint8_t root) {
+    float sum = 0.0f;
+    for (uint8_t i = 0; i < 12; i++) sum += c[(i + root) % 12] * t[i];
+    return sum;
+}
+
+// ---------------------------------------------------------------------------
+// GingoChroma
+// ---------------------------------------------------------------------------
+
+GingoChroma::GingoChroma(uint32_t sampleRate)
+    : sampleRate_(sampleRate ? sampleRate : 44100),
+      chordThreshold_(0.6f), keyThreshold_(0.5f),
+      chordWeight_(0.8f), keyWeight_(0.05f),
+      chordCb_(nullptr), chordCtx_(nullptr),
+      fieldCb_(nullptr), fieldCtx_(nullptr),
+      chromaCb_(nullptr), chromaCtx_(nullptr)
+{
+    for (uint16_t k = 0; k <= FFT_SIZE / 4; k++) {
+        sin_[k] = sinf(6.2831853f * k / FFT_SIZE);
+    }
+    setGate(-50.0f);
+    setRange(60.0f, 4000.0f);
+}
+
+void GingoChroma::setRange(float minHz, float maxHz) {
+    if (minHz < 20.0f) minHz = 20.0f;
+    const float nyquist = sampleRate_ * 0.5f;
+    if (maxHz > nyquist) maxHz = nyquist;
+    if (maxHz <= minHz) maxHz = minHz * 2.0f;
+    minHz_ = minHz;
+    maxHz_ = maxHz;
+
+    // Folding table: pitch of each bin's centre frequency, read with the
+    // interpolated peak offset and rounded to a pitch class
+    const float binHz = (float)sampleRate_ / FFT_SIZE;
+    for (uint16_t k = 0; k < BINS; k++) {
+        const float f = k * binHz;
+        if (f < minHz || f > maxHz) {
+            pitch_[k] = 0;
+            continue;
+        }
+        const float midi = 69.0f + 12.0f * log2f(f / 440.0f);
+        pitch_[k] = (uint16_t)lroundf((midi < 1.0f ? 1.0f : midi) * PITCH_ONE);
+    }
+    reset();
+}
+
+void GingoChroma::setGate(float dbfs) {
+    const float rms = powf(10.0f, dbfs / 20.0f) * 32768.0f;
+    gate_ = (int64_t)(rms * rms * FFT_SIZE);
+}
+
+void GingoChroma::setSmoothing(float chord, float key) {
+    chordWeight_ = chord < 0.01f ? 0.01f : chord > 1.0f ? 1.0f : chord;
+    keyWeight_   = key < 0.001f ? 0.001f : key > 1.0f ? 1.0f : key;
+}
+
+void GingoChroma::reset() {
+    memset(x_, 0, sizeof(x_));
+    memset(chroma_, 0, sizeof(chroma_));
+    memset(smooth_, 0, sizeof(smooth_));
+    memset(key_, 0, sizeof(key_));
+    hops_ = 0;
+    fill_ = 0;
+    chord_ = GingoChord();
+    chordValid_ = false;
+    chordScore_ = 0.0f;
+    candRoot_ = 0xFF;
+    candFormula_ = 0xFF;
+    candHops_ = 0;
+    silentHops_ = 0;
+    bass_ = 0xFF;
+    field_ = GingoField();
+    fieldValid_ = false;
+    keyScore_ = 0.0f;
+    keyTonic_ = 0xFF;
+    keyType_ = SCALE_MAJOR;
+}
+
+void GingoChroma::process(const int16_t* samples, uint16_t count, uint8_t stride) {
+    if (!samples || stride == 0) return;
+    int16_t* in = x_ + (FFT_SIZE - HOP);
+    for (uint16_t i = 0; i < count; i++) {
+        in[fill_++] = samples[(uint32_t)i * stride];
+        if (fill_ == HOP) hop_();
+    }
+}
+
+// sin(2 pi k / FFT_SIZE) for any k, from the quarter wave.
+float GingoChroma::sinAt_(uint32_t k) const {
+    k %= FFT_SIZE;
+    const uint32_t q = FFT_SIZE / 4;
+    if (k <= q)     return sin_[k];
+    if (k <= 2 * q) return sin_[2 * q - k];
+    if (k <= 3 * q) return -sin_[k - 2 * q];
+    return -sin_[FFT_SIZE - k];
+}
+
+// A full hop of new samples sits at the end of the history.
+void GingoChroma::hop_() {
+    // Window straight into the work area: even samples land on the real
+    // parts and odd ones on the imaginary parts of the half-size FFT
+    int64_t energy = 0;
+    for (uint16_t n = 0; n < FFT_SIZE; n++) {
+        const int32_t s = x_[n];
+        energy += s * s;
+        buf_[n] = (float)s * (0.5f - 0.5f * cosAt_(n)) * (1.0f / 32768.0f);
+    }
+    memmove(x_, x_ + HOP, (FFT_SIZE - HOP) * sizeof(int16_t));
+    fill_ = 0;
+    hops_++;
+
+    bool voiced = energy >= gate_;
+    if (voiced) {
+        fft_();
+        voiced = fold_();
+    }
+    if (!voiced) {
+        memset(chroma_, 0, sizeof(chroma_));
+        bass_ = 0xFF;
+    }
+
+    if (chromaFn_)      chromaFn_(chroma_);
+    else if (chromaCb_) chromaCb_(chroma_, chromaCtx_);
+
+    if (voiced) {
+        silentHops_ = 0;
+        track_();
+    } else if (++silentHops_ >= CHORD_RELEASE_HOPS) {
+        chordValid_ = false;
+        candHops_ = 0;
+        memset(smooth_, 0, sizeof(smooth_));
+    }
+}
+
+// In-place radix-2 complex FFT of BINS points over buf_ (re, im pairs).
+void GingoChroma::fft_() {
+    float* z = buf_;
+    for (uint16_t i = 1, j = 0; i < BINS; i++) {
+        uint16_t bit = BINS >> 1;
+        for (; j & bit; bit >>= 1) j ^= bit;
+        j ^= bit;
+        if (i < j) {
+            float t = z[2 * i];     z[2 * i] = z[2 * j];         z[2 * j] = t;
+            t = z[2 * i + 1];       z[2 * i + 1] = z[2 * j + 1]; z[2 * j + 1] = t;
+        }
+    }
+    for (uint16_t len = 2; len <= BINS; len <<= 1) {
+        const uint16_t half = len >> 1;
+        const uint16_t step = FFT_SIZE / len;    // twiddle e^(-2 pi i j / len)
+        for (uint16_t j = 0; j < half; j++) {
+            const float c = cosAt_((uint32_t)j * step);
+            const float s = sinAt_((uint32_t)j * step);
+            for (uint16_t a = j; a < BINS; a += len) {
+                float* p = z + 2 * a;
+                float* q = z + 2 * (a + half);
+                const float tr = c * q[0] + s * q[1];
+                const float ti = c * q[1] - s * q[0];
+                q[0] = p[0] - tr;
+                q[1] = p[1] - ti;
+                p[0] += tr;
+                p[1] += ti;
+            }
+        }
+    }
+}
+
+// Split the half-size FFT into the real spectrum, keep the magnitudes and
+// fold the peaks into chroma_. False when nothing lands in the range.
+bool GingoChroma::fold_() {
+    float* z = buf_;
+    for (uint16_t k = 1; k <= BINS / 2; k++) {
+        const uint16_t m = BINS - k;
+        const float ar = z[2 * k], ai = z[2 * k + 1];
+        const float br = z[2 * m], bi = z[2 * m + 1];
+
+        // X[k] = E[k] + W^k O[k], E and O from Z[k] and conj(Z[BINS - k])
+        float c = cosAt_(k), s = sinAt_(k);
+        float er = ar + br, ei = ai - bi, orr = ai + bi, oi = br - ar;
+        const float xr = er + c * orr + s * oi;
+        const float xi = ei + c * oi - s * orr;
+
+        // X[BINS - k], same with the roles of Z[k] and Z[BINS - k] swapped
+        c = cosAt_(m);
+        s = sinAt_(m);
+        er = br + ar; ei = bi - ai; orr = bi + ai; oi = ar - br;
+        const float yr = er + c * orr + s * oi;
+        const float yi = ei + c * oi - s * orr;
+
+        z[2 * k] = sqrtf(xr * xr + xi * xi);
+        z[2 * m] = sqrtf(yr * yr + yi * yi);
+    }
+
+    // Peaks: parabolic offset between the neighbours, pitch interpolated
+    // along the table
+    memset(chroma_, 0, sizeof(chroma_));
+    float loudest = 0.0f;
+    for (uint16_t k = 2; k < BINS - 1; k++) {
+        const float mag = z[2 * k];
+        if (pitch_[k] && mag > loudest) loudest = mag;
+    }
+    bass_ = 0xFF;
+    for (uint16_t k = 2; k < BINS - 1; k++) {
+        const float a = z[2 * k - 2], b = z[2 * k], c = z[2 * k + 2];
+        if (!pitch_[k] || b <= a || b < c) continue;
+        const float denom = a - 2.0f * b + c;
+        const float shift = denom < 0.0f ? 0.5f * (a - c) / denom : 0.0f;
+        const uint16_t next = pitch_[shift < 0.0f ? k - 1 : k + 1];
+        float p = pitch_[k];
+        if (next) p += (shift < 0.0f ? -shift : shift) * ((float)next - p);
+        const uint8_t pc = (uint8_t)(((uint32_t)p + PITCH_ONE / 2) / PITCH_ONE % 12);
+        chroma_[pc] += b;
+        if (bass_ == 0xFF && b >= BASS_LEVEL * loudest) bass_ = pc;
+    }
+    float peak = 0.0f;
+    for (uint8_t i = 0; i < 12; i++) if (chroma_[i] > peak) peak = chroma_[i];
+    if (peak <= 0.0f) return false;
+    for (uint8_t i = 0; i < 12; i++) chroma_[i] /= peak;
+    return true;
+}
+
+// Update the averages, then the chord and key state.
+void GingoChroma::track_() {
+    for (uint8_t i = 0; i < 12; i++) {
+        smooth_[i] += chordWeight_ * (chroma_[i] - smooth_[i]);
+        key_[i]    += keyWeight_ * (chroma_[i] - key_[i]);
+    }
+
+    ChromaChordMatch m;
+    if (matchChords(smooth_, bass_, &m, 1) && m.score >= chordThreshold_) {
+        if (m.root == candRoot_ && m.formula == candFormula_) {
+            if (candHops_ < 255) candHops_++;
+        } else {
+            candRoot_ = m.root;
+            candFormula_ = m.formula;
+            candHops_ = 1;
+        }
+        if (candHops_ >= CHORD_CONFIRM_HOPS) {
+            chordScore_ = m.score;
+            if (!chordValid_ || strcmp(chord_.name(), m.name.c_str()) != 0) {
+                chord_ = GingoChord(m.name.c_str());
+                chordValid_ = true;
+                if (chordFn_)      chordFn_(chord_);
+                else if (chordCb_) chordCb_(chord_, chordCtx_);
+            }
+        }
+    } else {
+        candHops_ = 0;
+    }
+
+    ChromaKeyMatch k;
+    if (matchKeys(key_, &k, 1) && k.score >= keyThreshold_) {
+        keyScore_ = k.score;
+        if (!fieldValid_ || k.tonic != keyTonic_ || k.scaleType != keyType_) {
+            keyTonic_ = k.tonic;
+            keyType_ = k.scaleType;
+            field_ = GingoField(k.tonicName, k.scaleType);
+            fieldValid_ = true;
+            if (fieldFn_)      fieldFn_(field_);
+            else if (fieldCb_) fieldCb_(field_, fieldCtx_);
+        }
+    }
+}
+
+uint8_t GingoChroma::matchChords(const float* chroma, uint8_t bassPc,
+                                 ChromaChordMatch* output, uint8_t maxResults) {
+    if (!chroma || !output || maxResults == 0) return 0;
+    float c[12];
+    if (!centre(chroma, c)) return 0;
+
+    uint8_t written = 0;
+    for (uint8_t fi = 0; fi < data::CHORD_FORMULA_COUNT; fi++) {
+        const uint16_t fm = pgm_read_word(&data::CHORD_FORMULA_MASKS[fi]);
+
+        // Formulas folding to the same mask: keep the first
+        bool dup = false;
+        for (uint8_t fj = 0; fj < fi && !dup; fj++) {
+            dup = pgm_read_word(&data::CHORD_FORMULA_MASKS[fj]) == fm;
+        }
+        if (dup) continue;
+
+        float t[12] = {};
+        for (uint8_t i = 0; i < 12; i++) {
+            if (!(fm & (1u << i))) continue;
+            t[i] += 1.0f;
+            t[(i + 7) % 12] += OVERTONE_FIFTH;
+            t[(i + 4) % 12] += OVERTONE_THIRD;
+        }
+        if (!centre(t, t)) continue;
+
+        for (uint8_t root = 0; root < 12; root++) {
+            float score = correlate(c, t, root);
+            if (root == bassPc) score += BASS_BONUS;
+            if (written == maxResults) {
+                if (score <= output[written - 1].score) continue;
+                written--;
+            }
+
+            // Insertion into the sorted output (earlier formulas win ties)
+            uint8_t pos = written;
+            while (pos > 0 && output[pos - 1].score < score) {
+                output[pos] = output[pos - 1];
+                pos--;
+            }
+            ChromaChordMatch& m = output[pos];
+            m.root    = root;
+            m.formula = fi;
+            m.score   = score;
+
+            char buf[20];
+            data::readChromaticName(root, buf, 4);
+            const uint8_t len = (uint8_t)strlen(buf);
+            data::readCanonicalChordType(fi, buf + len, (uint8_t)(sizeof(buf) - len));
+            m.name = buf;
+            written++;
+        }
+    }
+    return written;
+}
+
+uint8_t GingoChroma::matchKeys(const float* chroma, ChromaKeyMatch* output,
+                               uint8_t maxResults) {
+    if (!chroma || !output || maxResults == 0) return 0;
+    float c[12];
+    if (!centre(chroma, c)) return 0;
+
+    uint8_t written = 0;
+    for (uint8_t mode = 0; mode < 2; mode++) {
+        float t[12];
+        for (uint8_t i = 0; i < 12; i++) t[i] = pgm_read_float(&KEY_PROFILES[mode][i]);
+        centre(t, t);
+
+        for (uint8_t tonic = 0; tonic < 12; tonic++) {
+            const float score = correlate(c, t, tonic);
+            if (written == maxResults) {
+                if (score <= output[written - 1].score) continue;
+                written--;
+            }
+            uint8_t pos = written;
+            while (pos > 0 && output[pos - 1].score < score) {
+                output[pos] = output[pos - 1];
+                pos--;
+            }
+            ChromaKeyMatch& m = output[pos];
+            data::readChromaticName(tonic, m.tonicName, sizeof(m.tonicName));
+            m.tonic     = tonic;
+            m.scaleType = mode == 0 ? SCALE_MAJOR : SCALE_NATURAL_MINOR;
+            m.score     = score;
+            written++;
+        }
+    }
+    return written;
+}
+
+} // namespace gingoduino
+
+#endif // GINGODUINO_HAS_CHROMA
@@ -0,0 +1,228 @@
+// Gingoduino - Music Theory Library for Embedded Systems
+// GingoChroma: streaming chromagram for polyphonic audio input.
+//
+// Turns int16 audio (line-in, an amp output, a mixed band) into a 12-bin
+// pitch-class vector per hop and matches it against the chord formulas
+// and the major / minor key profiles, firing the same chord and field
+// callbacks as GingoMonitor. Chords without MIDI.
+//
+//   GingoChroma chroma(48000);
+//   chroma.onChordDetected([](const GingoChord& c) { ... });
+//   chroma.process(block, 256);          // from the I2S / ADC callback
+//   chroma.chroma();                     // last 12-bin vector, max = 1
+//
+// SPDX-License-Identifier: MIT
+
+#ifndef GINGO_CHROMA_H
+#define GINGO_CHROMA_H
+
+#include "gingoduino_config.h"
+
+#if GINGODUINO_HAS_CHROMA
+
+#include "gingoduino_types.h"
+#include "GingoChord.h"
+#include "GingoField.h"
+#include "GingoMonitor.h"
+
+#include <functional>
+
+namespace gingoduino {
+
+/// Result of GingoChroma::matchChords() - one chord reading of a chroma.
+struct ChromaChordMatch {
+    NameStr name;      ///< e.g. "Am7", built like identifyMask() names
+    uint8_t root;      ///< root pitch class (C = 0)
+    uint8_t formula;   ///< index in CHORD_FORMULAS
+    float   score;     ///< correlation with the chord template, -1..1
+};
+
+/// Result of GingoChroma::matchKeys() - one key reading of a chroma.
+struct ChromaKeyMatch {
+    char      tonicName[4]; ///< tonic name ("C", "C#", ...) and its NUL
+    uint8_t   tonic;        ///< tonic pitch class (C = 0)
+    ScaleType scaleType;    ///< SCALE_MAJOR or SCALE_NATURAL_MINOR
+    float     score;        ///< correlation with the key profile, -1..1
+};
+
+/// Streaming chromagram with chord and key matching.
+///
+/// Every GINGODUINO_CHROMA_HOP samples the last GINGODUINO_CHROMA_FFT
+/// samples are Hann-windowed and transformed with a float real FFT (a
+/// half-size complex FFT plus a split pass). Spectral peaks inside the
+/// frequency range are located between bins by parabolic interpolation
+/// and folded into 12 pitch classes through a bin to pitch table built
+/// when the range is set. The lowest strong peak gives the bass.
+///
+/// The chord match correlates a smoothed chroma with a template per
+/// chord formula and root (chord tones plus their strongest overtones),
+/// preferring the root in the bass among equal readings; the key match
+/// correlates a slower chroma with the Krumhansl-Kessler major and minor
+/// profiles. A chord is reported once it wins two hops in a row and is
+/// released after two gated hops; the key is reported when the best key
+/// changes.
+///
+/// Callbacks have the same types as GingoMonitor's, so one handler can be
+/// registered on both. State is about 8 x FFT bytes (about 32 KB with the
+/// defaults); keep the object static or global.
+///
+/// Examples:
+///   GingoChroma chroma(48000);
+///   chroma.onChordDetected([](const GingoChord& c, void*) {
+///       Serial.println(c.name());
+///   });
+///   chroma.process(samples, count, 2);    // left of interleaved stereo
+class GingoChroma {
+public:
+    static const uint16_t FFT_SIZE = GINGODUINO_CHROMA_FFT;
+    static const uint16_t HOP      = GINGODUINO_CHROMA_HOP;
+
+    typedef GingoMonitor::ChordCallback ChordCallback;
+    typedef GingoMonitor::FieldCallback FieldCallback;
+
+    /// Called after every analysed hop with the 12-bin chroma (max = 1,
+    /// all zero when the input is below the gate).
+    typedef void (*ChromaCallback)(const float* chroma, void* ctx);
+
+    /// Range 60-4000 Hz, gate -50 dBFS, chord threshold 0.6, key
+    /// threshold 0.5, smoothing 0.8 (chord) and 0.05 (key).
+    explicit GingoChroma(uint32_t sampleRate = 44100);
+
+    uint32_t sampleRate() const { return sampleRate_; }
+
+    /// Frequencies folded into the chroma. Rebuilds the folding table and
+    /// resets the analyser.
+    void setRange(float minHz, float maxHz);
+    float minFrequency() const { return minHz_; }
+    float maxFrequency() const { return maxHz_; }
+
+    /// Window RMS below which the input counts as silence, in dBFS.
+    void setGate(float dbfs);
+
+    /// Lowest correlation reported as a chord / as a key.
+    void setChordThreshold(float score) { chordThreshold_ = score; }
+    void setKeyThreshold(float score) { keyThreshold_ = score; }
+
+    /// Weight of each new hop in the chord and key chroma averages
+    /// (1 = no smoothing).
+    void setSmoothing(float chord, float key);
+
+    // -- Callbacks (same types as GingoMonitor) --
+
+    void onChordDetected(ChordCallback cb, void* ctx = nullptr) {
+        chordCb_ = cb;
+        chordCtx_ = ctx;
+    }
+    void onFieldChanged(FieldCallback cb, void* ctx = nullptr) {
+        fieldCb_ = cb;
+        fieldCtx_ = ctx;
+    }
+    void onChroma(ChromaCallback cb, void* ctx = nullptr) {
+        chromaCb_ = cb;
+        chromaCtx_ = ctx;
+    }
+
+    /// Lambda variants (take precedence).
+    void onChordDetected(std::function<void(const GingoChord&)> fn) { chordFn_ = fn; }
+    void onFieldChanged(std::function<void(const GingoField&)> fn) { fieldFn_ = fn; }
+    void onChroma(std::function<void(const float*)> fn) { chromaFn_ = fn; }
+
+    /// Feed count samples. With stride > 1 every stride-th sample is read
+    /// (one channel of interleaved audio).
+    void process(const int16_t* samples, uint16_t count, uint8_t stride = 1);
+
+    /// Clear the history, the averages and the chord / key state.
+    void reset();
+
+    // -- State (polling) --
+
+    /// Chroma of the last hop, 12 values, max = 1.
+    const float* chroma() const { return chroma_; }
+
+    /// Pitch class of the lowest strong peak on the last hop (0xFF = none).
+    uint8_t bass() const { return bass_; }
+
+    bool hasChord() const { return chordValid_; }
+    const GingoChord& currentChord() const { return chord_; }
+    float chordScore() const { return chordScore_; }
+
+    bool hasField() const { return fieldValid_; }
+    const GingoField& currentField() const { return field_; }
+    float keyScore() const { return keyScore_; }
+
+    /// Hops analysed so far.
+    uint32_t hops() const { return hops_; }
+
+    // -- Matching (usable on any chroma) --
+
+    /// Chord readings of a 12-bin chroma, best first (score, then formula
+    /// index). Formulas folding to the same pitch-class set are tried
+    /// once, as in GingoChord::identifyMask(). A chord rooted on bassPc
+    /// (255 = unknown) is preferred among equal readings. Returns the
+    /// count.
+    static uint8_t matchChords(const float* chroma, uint8_t bassPc,
+                               ChromaChordMatch* output, uint8_t maxResults);
+
+    /// Major and minor key readings of a 12-bin chroma, best first.
+    /// Returns the count (at most 24).
+    static uint8_t matchKeys(const float* chroma, ChromaKeyMatch* output,
+                             uint8_t maxResults);
+
+private:
+    static const uint16_t BINS = FFT_SIZE / 2;
+    static const uint16_t PITCH_ONE = 64;   ///< pitch_ units per semitone
+
+    int16_t  x_[FFT_SIZE];           ///< history, newest last
+    float    buf_[FFT_SIZE];         ///< FFT work area (BINS complex values)
+    float    sin_[FFT_SIZE / 4 + 1]; ///< quarter sine wave, sin(2 pi k / FFT_SIZE)
+    uint16_t pitch_[BINS];           ///< bin -> MIDI pitch x PITCH_ONE (0 = outside range)
+    float    chroma_[12];
+    float    smooth_[12];            ///< chord average
+    float    key_[12];               ///< key average
+    uint32_t sampleRate_;
+    uint32_t hops_;
+    uint16_t fill_;                  ///< new samples waiting for the hop
+    float    minHz_;
+    float    maxHz_;
+    int64_t  gate_;                  ///< energy threshold for the window
+    float    chordThreshold_;
+    float    keyThreshold_;
+    float    chordWeight_;
+    float    keyWeight_;
+
+    GingoChord chord_;
+    bool       chordValid_;
+    float      chordScore_;
+    uint8_t    candRoot_;            ///< chord that won the last hop
+    uint8_t    candFormula_;
+    uint8_t    candHops_;
+    uint8_t    silentHops_;
+    uint8_t    bass_;
+    GingoField field_;
+    bool       fieldValid_;
+    float      keyScore_;
+    uint8_t    keyTonic_;
+    ScaleType  keyType_;
+
+    ChordCallback  chordCb_;
+    void*          chordCtx_;
+    FieldCallback  fieldCb_;
+    void*          fieldCtx_;
+    ChromaCallback chromaCb_;
+    void*          chromaCtx_;
+    std::function<void(const GingoChord&)> chordFn_;
+    std::function<void(const GingoField&)> fieldFn_;
+    std::function<void(const float*)>      chromaFn_;
+
+    float sinAt_(uint32_t k) const;
+    float cosAt_(uint32_t k) const { return sinAt_(k + FFT_SIZE / 4); }
+    void  hop_();
+    void  fft_();
+    bool  fold_();
+    void  track_();
+};
+
+} // namespace gingoduino
+
+#endif // GINGODUINO_HAS_CHROMA
+#endif // GINGO_CHROMA_H
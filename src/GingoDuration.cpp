@@ -21,9 +21,7 @@ GingoDuration::GingoDuration(const char* name, uint8_t dots, uint8_t tuplet)
     // Find name in DURATION_NAMES table
     if (name) {
         for (uint8_t i = 0; i < data::DURATION_NAMES_SIZE; i++) {
-            char buf[16];
-            data::readPgmStr(buf, data::DURATION_NAMES[i].name, sizeof(buf));
-            if (strcmp(name, buf) == 0) {
+            if (data::pgmStrcmp(name, data::DURATION_NAMES[i].name) == 0) {
                 nameIdx_ = i;
                 break;
             }
@@ -75,6 +75,12 @@ float GingoEvent::frequency() const {
     }
 }
 
+#if GINGODUINO_HAS_TUNING
+float GingoEvent::frequency(const GingoTuning& tuning) const {
+    return type_ == EVENT_REST ? 0.0f : tuning.frequency(midiNumber());
+}
+#endif
+
 GingoEvent GingoEvent::transpose(int8_t semitones) const {
     switch (type_) {
         case EVENT_NOTE:
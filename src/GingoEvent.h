@@ -15,6 +15,10 @@
 #include "GingoChord.h"
 #include "GingoDuration.h"
 
+#if GINGODUINO_HAS_TUNING
+  #include "GingoTuning.h"
+#endif
+
 namespace gingoduino {
 
 /// Event type tag.
@@ -101,6 +105,11 @@ public:
     /// Frequency in Hz (EVENT_NOTE) or root frequency (EVENT_CHORD).
     float frequency() const;
 
+#if GINGODUINO_HAS_TUNING
+    /// Frequency from a tuning table.
+    float frequency(const GingoTuning& tuning) const;
+#endif
+
     /// Transpose the event by a number of semitones.
     GingoEvent transpose(int8_t semitones) const;
 
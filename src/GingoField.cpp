@@ -205,6 +205,7 @@ static void sortMatches(FieldMatch* arr, uint8_t n) {
 
 uint8_t GingoField::deduce(const char* const* items, uint8_t itemCount,
                            FieldMatch* output, uint8_t maxResults) {
+    GINGODUINO_PROBE(PROBE_FIELD_DEDUCE);
     if (itemCount == 0 || maxResults == 0) return 0;
 
     // Detect input type from first item
@@ -235,7 +236,7 @@ uint8_t GingoField::deduce(const char* const* items, uint8_t itemCount,
             uint8_t roleCount = 0;
 
             FieldMatch& fm = candidates[candCount];
-            fm.tonicName = TONICS[k];
+            memcpy(fm.tonicName, TONICS[k], strlen(TONICS[k]) + 1);
             fm.scaleType = st;
             fm.total = itemCount;
             fm.roleCount = 0;
@@ -29,7 +29,7 @@ namespace gingoduino {
 ///   // triads: CM, Dm, Em, FM, GM, Am, Bdim
 /// Result of GingoField::deduce() - a candidate harmonic field match.
 struct FieldMatch {
-    const char* tonicName;   // tonic name (points to internal static buffer)
+    char        tonicName[4]; // tonic name ("C", "C#", ...) and its NUL, held in the result
     ScaleType   scaleType;   // scale type of the candidate field
     uint8_t     matched;     // how many input items belong to this field
     uint8_t     total;       // how many input items were given
@@ -49,6 +49,12 @@ public:
     /// The underlying scale.
     const GingoScale& scale() const { return scale_; }
 
+    /// Fill output with the scale notes spelled by letter (see
+    /// GingoScale::formalNotes()). Returns the number written.
+    uint8_t formalNotes(GingoNote* output, uint8_t maxNotes) const {
+        return scale_.formalNotes(output, maxNotes);
+    }
+
     /// Fill output with triads (3-note chords) for each degree.
     /// Returns number of chords written.
     uint8_t chords(GingoChord* output, uint8_t maxChords) const;
@@ -8,6 +8,7 @@
 #if GINGODUINO_HAS_FRETBOARD
 
 #include "gingoduino_progmem.h"
+#include "gingoduino_shapes.h"
 
 namespace gingoduino {
 
@@ -20,13 +21,72 @@ GingoFretboard::GingoFretboard(const char* name,
                                uint8_t numStrings,
                                uint8_t numFrets)
     : numStrings_(numStrings > GINGODUINO_MAX_STRINGS ? GINGODUINO_MAX_STRINGS : numStrings)
-    , numFrets_(numFrets)
+    , numFrets_(numFrets > MAX_FRETS ? MAX_FRETS : numFrets)
     , capoFret_(0)
 {
     name_.set(name);
     for (uint8_t i = 0; i < numStrings_; i++) {
         openMidi_[i] = pgm_read_byte(&openMidi[i]);
     }
+#if GINGODUINO_HAS_FINGERING_CACHE
+    cache_ = nullptr;
+#endif
+    rebuildIndex_();
+}
+
+// ---------------------------------------------------------------------------
+// Position index
+// ---------------------------------------------------------------------------
+
+void GingoFretboard::rebuildIndex_() {
+    // Frets 0, 12, 24 share a pitch class; shift that pattern per string
+    const uint32_t OCTAVES = 0x01001001UL;
+    uint32_t range = (numFrets_ >= 31) ? 0xFFFFFFFFUL
+                                       : (((uint32_t)1 << (numFrets_ + 1)) - 1);
+    for (uint8_t pc = 0; pc < 12; pc++) {
+        for (uint8_t s = 0; s < GINGODUINO_MAX_STRINGS; s++) {
+            if (s >= numStrings_) { pcIndex_[pc][s] = 0; continue; }
+            uint8_t openPc = (uint8_t)((openMidi_[s] + capoFret_) % 12);
+            uint8_t first = (uint8_t)((pc + 12 - openPc) % 12);
+            pcIndex_[pc][s] = (OCTAVES << first) & range;
+        }
+    }
+
+    // FNV-1a over the open strings and fret count (capo is keyed separately)
+    uint32_t h = 2166136261UL;
+    for (uint8_t s = 0; s < numStrings_; s++) {
+        h = (h ^ openMidi_[s]) * 16777619UL;
+    }
+    h = (h ^ numStrings_) * 16777619UL;
+    tuningHash_ = (h ^ numFrets_) * 16777619UL;
+
+#if GINGODUINO_HAS_SHAPE_LIBRARY
+    // Shape table whose tuning this one transposes (capo is applied at lookup)
+    shapeTable_ = 255;
+    shapeShift_ = 0;
+    for (uint8_t t = 0; t < data::SHAPE_TABLE_COUNT && shapeTable_ == 255; t++) {
+        if (pgm_read_byte(&data::SHAPE_TABLES[t].numStrings) != numStrings_) continue;
+        const uint8_t* tuning = (const uint8_t*)pgm_read_ptr(&data::SHAPE_TABLES[t].tuning);
+        int16_t shift = (int16_t)openMidi_[0] - (int16_t)pgm_read_byte(&tuning[0]);
+        bool match = true;
+        for (uint8_t s = 1; s < numStrings_ && match; s++) {
+            match = (int16_t)openMidi_[s] - (int16_t)pgm_read_byte(&tuning[s]) == shift;
+        }
+        if (match) {
+            shapeTable_ = t;
+            shapeShift_ = (uint8_t)((shift % 12 + 12) % 12);
+        }
+    }
+#endif
+}
+
+uint32_t GingoFretboard::fretMask(uint16_t pcMask, uint8_t string) const {
+    if (string >= numStrings_) return 0;
+    uint32_t m = 0;
+    for (uint8_t pc = 0; pc < 12; pc++) {
+        if (pcMask & (1u << pc)) m |= pcIndex_[pc][string];
+    }
+    return m;
 }
 
 // ---------------------------------------------------------------------------
@@ -69,6 +129,30 @@ GingoFretboard GingoFretboard::dadgad(uint8_t numFrets) {
     return GingoFretboard("DADGAD", data::TUNING_DADGAD, 6, numFrets);
 }
 
+GingoFretboard GingoFretboard::bass(uint8_t numFrets) {
+    return GingoFretboard("Bass", data::TUNING_BASS, 4, numFrets);
+}
+
+GingoFretboard GingoFretboard::bass5(uint8_t numFrets) {
+    return GingoFretboard("Bass5", data::TUNING_BASS5, 5, numFrets);
+}
+
+GingoFretboard GingoFretboard::bass6(uint8_t numFrets) {
+    return GingoFretboard("Bass6", data::TUNING_BASS6, 6, numFrets);
+}
+
+#if GINGODUINO_MAX_STRINGS >= 7
+GingoFretboard GingoFretboard::sevenString(uint8_t numFrets) {
+    return GingoFretboard("SevenString", data::TUNING_SEVEN_STRING, 7, numFrets);
+}
+#endif
+
+#if GINGODUINO_MAX_STRINGS >= 8
+GingoFretboard GingoFretboard::eightString(uint8_t numFrets) {
+    return GingoFretboard("EightString", data::TUNING_EIGHT_STRING, 8, numFrets);
+}
+#endif
+
 // ---------------------------------------------------------------------------
 // Info
 // ---------------------------------------------------------------------------
@@ -120,16 +204,16 @@ uint8_t GingoFretboard::positions(const GingoNote& note,
 
     for (uint8_t s = 0; s < numStrings_ && written < maxPositions; s++) {
         uint8_t baseMidi = openMidi_[s] + capoFret_;
-        for (uint8_t f = 0; f <= numFrets_ && written < maxPositions; f++) {
+        uint32_t frets = pcIndex_[targetPc][s];
+        for (uint8_t f = 0; frets && written < maxPositions; f++, frets >>= 1) {
+            if (!(frets & 1u)) continue;
             uint8_t midi = baseMidi + f;
-            if (midi % 12 == targetPc) {
-                GingoFretPos& p = output[written++];
-                p.string = s;
-                p.fret = f;
-                p.midi = midi;
-                p.note = note;
-                p.octave = (midi / 12) - 1;
-            }
+            GingoFretPos& p = output[written++];
+            p.string = s;
+            p.fret = f;
+            p.midi = midi;
+            p.note = note;
+            p.octave = (midi / 12) - 1;
         }
     }
     return written;
@@ -139,193 +223,753 @@ uint8_t GingoFretboard::scalePositions(const GingoScale& scale,
                                        GingoFretPos* output, uint8_t maxPositions,
                                        uint8_t fretLo, uint8_t fretHi) const {
     if (fretHi > numFrets_) fretHi = numFrets_;
+    if (fretLo > fretHi) return 0;
+
+    // Scale mask is tonic-relative; rotate it to absolute pitch classes
+    uint16_t rel = scale.mask();
+    uint8_t tonicPc = scale.tonic().semitone();
+    uint16_t pcMask = (uint16_t)(((rel << tonicPc) | (rel >> (12 - tonicPc))) & 0x0FFF);
+
+    uint32_t range = (((fretHi >= 31) ? 0xFFFFFFFFUL
+                                      : (((uint32_t)1 << (fretHi + 1)) - 1))
+                      >> fretLo) << fretLo;
+
+    // Notes are built once per pitch class, on first use
+    GingoNote notes[12];
+    uint16_t built = 0;
     uint8_t written = 0;
 
     for (uint8_t s = 0; s < numStrings_ && written < maxPositions; s++) {
         uint8_t baseMidi = openMidi_[s] + capoFret_;
-        for (uint8_t f = fretLo; f <= fretHi && written < maxPositions; f++) {
+        uint32_t frets = fretMask(pcMask, s) & range;
+        for (uint8_t f = 0; frets && written < maxPositions; f++, frets >>= 1) {
+            if (!(frets & 1u)) continue;
             uint8_t midi = baseMidi + f;
-            char name[3];
-            data::readChromaticName(midi % 12, name, sizeof(name));
-            GingoNote n(name);
-            if (scale.contains(n)) {
-                GingoFretPos& p = output[written++];
-                p.string = s;
-                p.fret = f;
-                p.midi = midi;
-                p.note = n;
-                p.octave = (midi / 12) - 1;
+            uint8_t pc = midi % 12;
+            if (!(built & (1u << pc))) {
+                notes[pc] = GingoNote::fromMIDI(midi);
+                built |= (uint16_t)(1u << pc);
             }
+            GingoFretPos& p = output[written++];
+            p.string = s;
+            p.fret = f;
+            p.midi = midi;
+            p.note = notes[pc];
+            p.octave = (midi / 12) - 1;
         }
     }
     return written;
 }
 
+// ---------------------------------------------------------------------------
+// Packed fingerings
+// ---------------------------------------------------------------------------
+
+uint8_t GingoPackedFingering::baseFret() const {
+    uint8_t base = 0;
+    for (uint8_t s = 0; s < numStrings; s++) {
+        uint8_t f = frets[s];
+        if (f == 0 || (f & MUTED)) continue;
+        if (base == 0 || f < base) base = f;
+    }
+    return base;
+}
+
+const char* GingoPackedFingering::chordName(char* buf, uint8_t maxLen) const {
+    if (!buf || maxLen == 0) return buf;
+    buf[0] = '\0';
+    if (formula == 255 || maxLen < 3) return buf;
+    data::readChromaticName(rootPc, buf, maxLen);
+    uint8_t pos = (uint8_t)strlen(buf);
+    char type[10];
+    data::readCanonicalChordType(formula, type, sizeof(type));
+    for (uint8_t i = 0; type[i] && pos < maxLen - 1; i++) buf[pos++] = type[i];
+    buf[pos] = '\0';
+    return buf;
+}
+
+void GingoFretboard::unpack(const GingoPackedFingering& packed, GingoFingering& output) const {
+    char name[16];
+    unpack_(packed, output, packed.chordName(name, sizeof(name)));
+}
+
+void GingoFretboard::unpack_(const GingoPackedFingering& p, GingoFingering& output,
+                             const char* chordName) const {
+    uint8_t n = (p.numStrings < numStrings_) ? p.numStrings : numStrings_;
+    output.numStrings = n;
+    output.chordName.set(chordName);
+    output.baseFret = p.baseFret();
+    output.capoFret = p.capoFret;
+    output.numNotes = 0;
+    output.score    = p.score;
+    // Unused slots are zeroed so equal fingerings compare equal bytewise
+    memset(output.strings, 0, sizeof(output.strings));
+    memset(output.midiNotes, 0, sizeof(output.midiNotes));
+    for (uint8_t s = 0; s < n; s++) {
+        output.strings[s].string = s;
+        if (p.isMuted(s)) {
+            output.strings[s].action = STRING_MUTED;
+            output.strings[s].fret   = 0;
+            continue;
+        }
+        uint8_t f = p.fret(s);
+        output.strings[s].action = f ? STRING_FRETTED : STRING_OPEN;
+        output.strings[s].fret   = f;
+        output.midiNotes[output.numNotes++] = (uint8_t)(openMidi_[s] + p.capoFret + f);
+    }
+}
+
+// Inverse of unpack(); the chord identity is not recoverable from a
+// GingoFingering and is left unknown.
+static GingoPackedFingering fgPack_(const GingoFingering& fg) {
+    GingoPackedFingering p;
+    p.numStrings = fg.numStrings;
+    p.capoFret   = fg.capoFret;
+    p.rootPc     = 0;
+    p.formula    = 255;
+    p.score      = fg.score;
+    for (uint8_t s = 0; s < fg.numStrings; s++) {
+        p.frets[s] = (fg.strings[s].action == STRING_MUTED)
+                   ? GingoPackedFingering::MUTED : fg.strings[s].fret;
+    }
+    return p;
+}
+
 // ---------------------------------------------------------------------------
 // Fingerings
 // ---------------------------------------------------------------------------
 
-uint16_t GingoFretboard::scoreFingering(const GingoFingering& fg) const {
+// Playability limits for the fingering search.
+static const uint8_t FG_MAX_SPAN     = 3;    // fretted notes within 4 frets
+static const uint8_t FG_MAX_FINGERS  = 4;    // a barre counts as one finger
+static const uint8_t FG_MUTED        = GingoPackedFingering::MUTED;
+
+// Score weights (lower = better).
+static const uint16_t FG_W_MUTE      = 8;    // per muted string
+static const uint16_t FG_W_SPAN      = 5;    // per fret of stretch
+static const uint16_t FG_W_POSITION  = 2;    // per fret up the neck
+static const uint16_t FG_W_BASS      = 20;   // lowest note is not the root
+
+static uint8_t fgPopcount_(uint16_t mask) {
+    uint8_t count = 0;
+    while (mask) { mask &= (uint16_t)(mask - 1); count++; }
+    return count;
+}
+
+struct GingoFretboard::SearchCtx {
+    uint8_t          rootPc;
+    uint8_t          formula;
+    uint16_t         requiredMask;               // pitch classes that must sound
+    uint32_t         candidates[GINGODUINO_MAX_STRINGS];  // bit f = fret f is a chord tone
+    uint8_t          frets[GINGODUINO_MAX_STRINGS];       // current assignment
+    uint16_t         covered;                    // pitch classes sounding so far
+    uint8_t          minFret, maxFret;           // fretted range (minFret 255 = none)
+    uint8_t          atMin;                      // fretted notes at minFret
+    uint8_t          fretted;                    // fretted notes so far
+    uint8_t          muted;                      // muted strings so far
+    GingoPackedFingering* heap;                  // max-heap on score
+    uint8_t          k;
+    uint8_t          count;
+};
+
+// Heap order: worse fingering first (higher score, then higher base fret).
+static bool fgWorse_(const GingoPackedFingering& a, const GingoPackedFingering& b) {
+    if (a.score != b.score) return a.score > b.score;
+    return a.baseFret() > b.baseFret();
+}
+
+static void fgSiftDown_(GingoPackedFingering* heap, uint8_t n, uint8_t i) {
+    for (;;) {
+        uint8_t l = (uint8_t)(2 * i + 1), r = (uint8_t)(l + 1), top = i;
+        if (l < n && fgWorse_(heap[l], heap[top])) top = l;
+        if (r < n && fgWorse_(heap[r], heap[top])) top = r;
+        if (top == i) return;
+        GingoPackedFingering t = heap[i]; heap[i] = heap[top]; heap[top] = t;
+        i = top;
+    }
+}
+
+static void fgSiftUp_(GingoPackedFingering* heap, uint8_t i) {
+    while (i > 0) {
+        uint8_t parent = (uint8_t)((i - 1) / 2);
+        if (!fgWorse_(heap[i], heap[parent])) return;
+        GingoPackedFingering t = heap[i]; heap[i] = heap[parent]; heap[parent] = t;
+        i = parent;
+    }
+}
+
+uint16_t GingoFretboard::scoreFingering(const GingoPackedFingering& fg) const {
     uint16_t score = 0;
     uint8_t minFret = 255, maxFret = 0;
-    uint8_t mutedCount = 0;
+    uint8_t bass = 255;
 
     for (uint8_t i = 0; i < fg.numStrings; i++) {
-        if (fg.strings[i].action == STRING_MUTED) {
-            mutedCount++;
-            score += 10;
-        } else if (fg.strings[i].action == STRING_FRETTED) {
-            uint8_t f = fg.strings[i].fret;
+        if (fg.isMuted(i)) {
+            score += FG_W_MUTE;
+            continue;
+        }
+        uint8_t f = fg.fret(i);
+        if (f > 0) {
             if (f < minFret) minFret = f;
             if (f > maxFret) maxFret = f;
         }
+        uint8_t midi = (uint8_t)(openMidi_[i] + fg.capoFret + f);
+        if (midi < bass) bass = midi;
     }
 
     // Span penalty
-    if (maxFret > minFret) {
-        score += (uint16_t)(maxFret - minFret) * 5;
+    if (minFret != 255 && maxFret > minFret) {
+        score += (uint16_t)(maxFret - minFret) * FG_W_SPAN;
     }
 
     // Position penalty: higher frets are harder
     if (minFret != 255) {
-        score += minFret;
+        score += (uint16_t)minFret * FG_W_POSITION;
     }
 
-    // Prefer more sounding notes
-    if (mutedCount > 0) {
-        score += (uint16_t)mutedCount * 8;
+    // Prefer root-position voicings
+    if (bass != 255 && bass % 12 != fg.rootPc) {
+        score += FG_W_BASS;
     }
 
     return score;
 }
 
-bool GingoFretboard::fingering(const GingoChord& chord, uint8_t positionIdx,
-                               GingoFingering& output) const {
-    // Get chord notes
-    GingoNote chordNotes[7];
-    uint8_t chordSize = chord.notes(chordNotes, 7);
-    if (chordSize == 0) return false;
+void GingoFretboard::offerFingering_(SearchCtx& ctx) const {
+    if ((ctx.covered & ctx.requiredMask) != ctx.requiredMask) return;
+    if (ctx.muted == numStrings_) return;
+
+    // Exact finger count: notes at the lowest fret share one barre finger,
+    // unless an open string sounds above the lowest barred string.
+    if (ctx.fretted > 0) {
+        bool barre = ctx.atMin >= 2;
+        if (barre) {
+            uint8_t first = 0;
+            while (ctx.frets[first] != ctx.minFret) first++;
+            for (uint8_t s = first + 1; s < numStrings_; s++) {
+                if (ctx.frets[s] == 0) { barre = false; break; }
+            }
+        }
+        uint8_t fingers = (uint8_t)(ctx.fretted - ctx.atMin + (barre ? 1 : ctx.atMin));
+        if (fingers > FG_MAX_FINGERS) return;
+    }
 
-    // Determine the fret window based on positionIdx
-    uint8_t windowStart = positionIdx * 4;
-    uint8_t windowEnd = windowStart + 4;
-    if (windowEnd > numFrets_) windowEnd = numFrets_;
-    if (windowStart > numFrets_) return false;
+    GingoPackedFingering fg;
+    fg.numStrings = numStrings_;
+    fg.capoFret   = capoFret_;
+    fg.rootPc     = ctx.rootPc;
+    fg.formula    = ctx.formula;
+    memcpy(fg.frets, ctx.frets, numStrings_);
+    fg.score = scoreFingering(fg);
+
+    if (ctx.count < ctx.k) {
+        ctx.heap[ctx.count] = fg;
+        fgSiftUp_(ctx.heap, ctx.count);
+        ctx.count++;
+    } else if (fgWorse_(ctx.heap[0], fg)) {
+        ctx.heap[0] = fg;
+        fgSiftDown_(ctx.heap, ctx.count, 0);
+    }
+}
 
-    // Initialize output
-    output.numStrings = numStrings_;
-    output.chordName.set(chord.name());
-    output.baseFret = windowStart;
-    output.capoFret = capoFret_;
-    output.numNotes = 0;
+void GingoFretboard::searchString_(SearchCtx& ctx, uint8_t s) const {
+    if (s == numStrings_) {
+        offerFingering_(ctx);
+        return;
+    }
 
-    // For each string, find the best fret within the window
-    // that matches a chord tone
-    for (uint8_t s = 0; s < numStrings_; s++) {
-        uint8_t baseMidi = openMidi_[s] + capoFret_;
-        bool found = false;
-
-        // Check open string first
-        uint8_t openPc = baseMidi % 12;
-        for (uint8_t n = 0; n < chordSize; n++) {
-            if (chordNotes[n].semitone() == openPc) {
-                output.strings[s].string = s;
-                output.strings[s].action = STRING_OPEN;
-                output.strings[s].fret = 0;
-                output.midiNotes[output.numNotes++] = baseMidi;
-                found = true;
-                break;
+    // Not enough strings left to cover the missing chord tones
+    uint8_t remaining = (uint8_t)(numStrings_ - s);
+    uint8_t missing = fgPopcount_((uint16_t)(ctx.requiredMask & ~ctx.covered));
+    if (missing > remaining) return;
+
+    bool full = (ctx.count == ctx.k);
+    uint8_t basePc = (uint8_t)((openMidi_[s] + capoFret_) % 12);
+    uint32_t cand = ctx.candidates[s];
+
+    for (uint8_t f = 0; cand; f++, cand >>= 1) {
+        if (!(cand & 1u)) continue;
+
+        uint8_t  minF = ctx.minFret, maxF = ctx.maxFret, atMin = ctx.atMin;
+        uint8_t  fretted = ctx.fretted;
+        if (f > 0) {
+            if (minF == 255) { minF = f; maxF = f; atMin = 1; }
+            else if (f < minF) { minF = f; atMin = 1; }
+            else if (f == minF) { atMin++; }
+            if (f > maxF) maxF = f;
+            if (maxF - minF > FG_MAX_SPAN) {
+                if (f > minF) break;   // candidates are ascending
+                continue;
             }
+            fretted++;
+            // Optimistic finger count (barre at minF) only grows deeper down
+            if (fretted - atMin + 1 > FG_MAX_FINGERS) continue;
         }
 
-        if (!found) {
-            // Check frets in window
-            for (uint8_t f = (windowStart > 0 ? windowStart : 1); f <= windowEnd; f++) {
-                uint8_t midi = baseMidi + f;
-                uint8_t pc = midi % 12;
-                for (uint8_t n = 0; n < chordSize; n++) {
-                    if (chordNotes[n].semitone() == pc) {
-                        output.strings[s].string = s;
-                        output.strings[s].action = STRING_FRETTED;
-                        output.strings[s].fret = f;
-                        output.midiNotes[output.numNotes++] = midi;
-                        found = true;
-                        break;
-                    }
-                }
-                if (found) break;
+        // Partial score is a lower bound: span, position and mutes never shrink
+        if (full) {
+            uint16_t bound = (uint16_t)ctx.muted * FG_W_MUTE;
+            if (minF != 255) {
+                bound += (uint16_t)(maxF - minF) * FG_W_SPAN + (uint16_t)minF * FG_W_POSITION;
             }
+            if (bound > ctx.heap[0].score) continue;
         }
 
-        if (!found) {
-            output.strings[s].string = s;
-            output.strings[s].action = STRING_MUTED;
-            output.strings[s].fret = 0;
+        uint8_t  saveMin = ctx.minFret, saveMax = ctx.maxFret, saveAt = ctx.atMin;
+        uint8_t  saveFretted = ctx.fretted;
+        uint16_t saveCovered = ctx.covered;
+
+        ctx.frets[s] = f;
+        ctx.minFret = minF; ctx.maxFret = maxF; ctx.atMin = atMin;
+        ctx.fretted = fretted;
+        ctx.covered |= (uint16_t)(1u << ((basePc + f) % 12));
+
+        searchString_(ctx, (uint8_t)(s + 1));
+
+        ctx.minFret = saveMin; ctx.maxFret = saveMax; ctx.atMin = saveAt;
+        ctx.fretted = saveFretted;
+        ctx.covered = saveCovered;
+        full = (ctx.count == ctx.k);
+    }
+
+    // Mute this string, if the remaining strings can still cover the chord
+    if (missing < remaining) {
+        if (full) {
+            uint16_t bound = (uint16_t)(ctx.muted + 1) * FG_W_MUTE;
+            if (ctx.minFret != 255) {
+                bound += (uint16_t)(ctx.maxFret - ctx.minFret) * FG_W_SPAN
+                       + (uint16_t)ctx.minFret * FG_W_POSITION;
+            }
+            if (bound > ctx.heap[0].score) return;
         }
+        ctx.frets[s] = FG_MUTED;
+        ctx.muted++;
+        searchString_(ctx, (uint8_t)(s + 1));
+        ctx.muted--;
     }
+}
 
-    output.score = scoreFingering(output);
-    return output.numNotes >= chordSize;
+uint8_t GingoFretboard::searchFingerings_(const GingoChord& chord,
+                                          uint8_t fretLo, uint8_t fretHi,
+                                          GingoPackedFingering* heap, uint8_t k) const {
+    GINGODUINO_PROBE(PROBE_FRETBOARD_SEARCH);
+    if (!heap || k == 0 || numStrings_ == 0) return 0;
+    uint8_t fIdx = chord.formulaIndex();
+    if (fIdx == 255) return 0;
+
+    SearchCtx ctx;
+    ctx.rootPc  = chord.root().semitone();
+    ctx.formula = fIdx;
+
+    // Pitch-class mask of the chord
+    uint8_t intervals[7];
+    uint8_t count;
+    data::readChordFormula(fIdx, intervals, &count);
+    uint16_t mask = 0;
+    for (uint8_t i = 0; i < count; i++) {
+        mask |= (uint16_t)(1u << ((ctx.rootPc + intervals[i]) % 12));
+    }
+
+    // More tones than strings: drop the fifth, then the highest extensions
+    uint16_t required = mask;
+    if (fgPopcount_(required) > numStrings_) {
+        required &= (uint16_t)~(1u << ((ctx.rootPc + 7) % 12));
+    }
+    for (uint8_t i = (uint8_t)(count - 1); i > 0 && fgPopcount_(required) > numStrings_; i--) {
+        required &= (uint16_t)~(1u << ((ctx.rootPc + intervals[i]) % 12));
+    }
+    required |= (uint16_t)(1u << ctx.rootPc);
+    ctx.requiredMask = required;
+
+    // Per-string candidate frets: open string plus fretLo..fretHi
+    if (fretHi > numFrets_) fretHi = numFrets_;
+    if (fretLo == 0) fretLo = 1;
+    if (fretLo > fretHi) fretLo = (uint8_t)(fretHi + 1);
+    uint32_t range = 1u;
+    if (fretLo <= fretHi) {
+        range |= ((fretHi >= 31 ? 0xFFFFFFFFUL : (((uint32_t)1 << (fretHi + 1)) - 1))
+                  >> fretLo) << fretLo;
+    }
+    for (uint8_t s = 0; s < numStrings_; s++) {
+        ctx.candidates[s] = fretMask(mask, s) & range;
+    }
+
+    ctx.covered = 0;
+    ctx.minFret = 255;
+    ctx.maxFret = 0;
+    ctx.atMin   = 0;
+    ctx.fretted = 0;
+    ctx.muted   = 0;
+    ctx.heap    = heap;
+    ctx.k       = k;
+    ctx.count   = 0;
+
+    searchString_(ctx, 0);
+
+    // Heap-sort in place: ascending by score
+    for (uint8_t n = ctx.count; n > 1; n--) {
+        GingoPackedFingering t = heap[0]; heap[0] = heap[n - 1]; heap[n - 1] = t;
+        fgSiftDown_(heap, (uint8_t)(n - 1), 0);
+    }
+    return ctx.count;
+}
+
+bool GingoFretboard::fingering(const GingoChord& chord, uint8_t positionIdx,
+                               GingoFingering& output) const {
+    GINGODUINO_PROBE(PROBE_FRETBOARD_FINGERING);
+    // Determine the fret window based on positionIdx
+    uint16_t windowStart = (uint16_t)positionIdx * 4;
+    if (windowStart > numFrets_) return false;
+    uint16_t windowEnd = windowStart + 4;
+    if (windowEnd > numFrets_) windowEnd = numFrets_;
+
+    GingoPackedFingering best;
+#if GINGODUINO_HAS_SHAPE_LIBRARY
+    if (positionIdx == 0 && shape(chord, best)) {
+        unpack_(best, output, chord.name());
+        return true;
+    }
+#endif
+    if (searchFingerings_(chord, (uint8_t)windowStart, (uint8_t)windowEnd, &best, 1) != 1) {
+        return false;
+    }
+    unpack_(best, output, chord.name());
+    return true;
 }
 
 uint8_t GingoFretboard::fingerings(const GingoChord& chord,
                                    GingoFingering* output, uint8_t maxResults) const {
-    uint8_t written = 0;
-    uint8_t maxWindows = (numFrets_ / 4) + 1;
+    if (!output) return 0;
+    GingoPackedFingering packed[GINGODUINO_MAX_FINGERINGS + 4];
+    if (maxResults > GINGODUINO_MAX_FINGERINGS + 4) maxResults = GINGODUINO_MAX_FINGERINGS + 4;
+    uint8_t n = cachedSearch_(chord, packed, maxResults);
+    for (uint8_t i = 0; i < n; i++) {
+        unpack_(packed[i], output[i], chord.name());
+    }
+    return n;
+}
+
+#if GINGODUINO_HAS_SHAPE_LIBRARY
+bool GingoFretboard::shape(const GingoChord& chord, GingoPackedFingering& output) const {
+    return shapeAt_(chord.root().semitone(), chord.formulaIndex(), output);
+}
+
+bool GingoFretboard::shapeAt_(uint8_t rootPc, uint8_t fIdx,
+                              GingoPackedFingering& output) const {
+    if (shapeTable_ == 255) return false;
+    uint8_t slot = 0;
+    while (slot < data::SHAPE_FORMULA_COUNT && pgm_read_byte(&data::SHAPE_FORMULAS[slot]) != fIdx) {
+        slot++;
+    }
+    if (slot == data::SHAPE_FORMULA_COUNT) return false;
 
-    // Generate fingerings for each position window
-    GingoFingering candidates[GINGODUINO_MAX_FINGERINGS + 4];
-    uint8_t candidateCount = 0;
+    // Shapes are stored for the untransposed, capo-free tuning
+    uint8_t rel = (uint8_t)((rootPc + 24 - shapeShift_ - capoFret_ % 12) % 12);
+    const uint8_t* shapes = (const uint8_t*)pgm_read_ptr(&data::SHAPE_TABLES[shapeTable_].shapes);
+    const uint8_t* entry = shapes + ((uint16_t)slot * 12 + rel) * (numStrings_ + 1);
+    if (pgm_read_byte(&entry[0]) == 0xFF) return false;
 
-    for (uint8_t w = 0; w < maxWindows && candidateCount < GINGODUINO_MAX_FINGERINGS + 4; w++) {
-        GingoFingering fg;
-        if (fingering(chord, w, fg)) {
-            candidates[candidateCount++] = fg;
+    for (uint8_t s = 0; s < numStrings_; s++) {
+        uint8_t b = pgm_read_byte(&entry[s]);
+        if (!(b & FG_MUTED) && b > numFrets_) return false;  // capo too high
+        output.frets[s] = b;
+    }
+    output.numStrings = numStrings_;
+    output.capoFret   = capoFret_;
+    output.rootPc     = rootPc;
+    output.formula    = fIdx;
+    output.score      = pgm_read_byte(&entry[numStrings_]);
+    return true;
+}
+
+uint8_t GingoFretboard::shapes(const GingoChord& chord,
+                               GingoPackedFingering* output, uint8_t maxResults) const {
+    if (!output || maxResults == 0) return 0;
+    const uint8_t rootPc = chord.root().semitone();
+    const uint8_t fIdx   = chord.formulaIndex();
+    GingoPackedFingering cand[3];
+    uint8_t n = shapeAt_(rootPc, fIdx, cand[0]) ? 1 : 0;
+
+    // Barre forms: the table shape rooted on open string 0 (E form) or 1
+    // (A form), moved up to the chord root with the index finger barring
+    for (uint8_t s = 0; s < 2 && s < numStrings_; s++) {
+        const uint8_t openPc = (uint8_t)((openMidi_[s] + capoFret_) % 12);
+        const uint8_t shift  = (uint8_t)((rootPc + 12 - openPc) % 12);
+        GingoPackedFingering& fg = cand[n];
+        if (shift == 0 || !shapeAt_(openPc, fIdx, fg) || fg.frets[s] != 0) continue;
+
+        bool movable = true;
+        uint8_t fretted = 0;
+        for (uint8_t i = 0; i < numStrings_ && movable; i++) {
+            if (fg.isMuted(i)) continue;
+            if (i < s || fg.fret(i) + shift > numFrets_) { movable = false; continue; }
+            if (fg.fret(i) > 0) fretted++;
+            fg.frets[i] = (uint8_t)(fg.fret(i) + shift);
         }
+        if (!movable || fretted >= FG_MAX_FINGERS) continue;
+        fg.rootPc = rootPc;
+        fg.score  = scoreFingering(fg);
+
+        bool dup = false;
+        for (uint8_t j = 0; j < n; j++) {
+            if (memcmp(cand[j].frets, fg.frets, numStrings_) == 0) dup = true;
+        }
+        if (!dup) n++;
     }
 
-    // Sort by score (insertion sort, small array)
-    for (uint8_t i = 1; i < candidateCount; i++) {
-        GingoFingering key = candidates[i];
-        int8_t j = (int8_t)i - 1;
-        while (j >= 0 && candidates[j].score > key.score) {
-            candidates[j + 1] = candidates[j];
-            j--;
+    // Best first
+    for (uint8_t i = 1; i < n; i++) {
+        for (uint8_t j = i; j > 0 && fgWorse_(cand[j - 1], cand[j]); j--) {
+            GingoPackedFingering t = cand[j]; cand[j] = cand[j - 1]; cand[j - 1] = t;
         }
-        candidates[j + 1] = key;
     }
+    if (n > maxResults) n = maxResults;
+    for (uint8_t i = 0; i < n; i++) output[i] = cand[i];
+    return n;
+}
+#endif
+
+uint8_t GingoFretboard::fingerings(const GingoChord& chord,
+                                   GingoPackedFingering* output, uint8_t maxResults) const {
+    return cachedSearch_(chord, output, maxResults);
+}
 
-    // Copy best results
-    for (uint8_t i = 0; i < candidateCount && written < maxResults; i++) {
-        output[written++] = candidates[i];
+// ---------------------------------------------------------------------------
+// Fingering cache
+// ---------------------------------------------------------------------------
+
+#if GINGODUINO_HAS_FINGERING_CACHE
+
+void GingoFingeringCache::clear() {
+    for (uint8_t i = 0; i < CAPACITY; i++) entries_[i].lastUse = 0;
+    clock_  = 0;
+    hits_   = 0;
+    misses_ = 0;
+}
+
+uint8_t GingoFingeringCache::size() const {
+    uint8_t n = 0;
+    for (uint8_t i = 0; i < CAPACITY; i++) {
+        if (entries_[i].lastUse != 0) n++;
     }
+    return n;
+}
 
-    return written;
+GingoFingeringCache::Entry* GingoFingeringCache::find_(uint8_t root, uint8_t formula,
+                                                       uint32_t tuning, uint8_t capo) {
+    for (uint8_t i = 0; i < CAPACITY; i++) {
+        Entry& e = entries_[i];
+        if (e.lastUse != 0 && e.root == root && e.formula == formula &&
+            e.tuning == tuning && e.capo == capo) {
+            return &e;
+        }
+    }
+    return nullptr;
+}
+
+GingoFingeringCache::Entry* GingoFingeringCache::victim_() {
+    Entry* v = &entries_[0];
+    for (uint8_t i = 0; i < CAPACITY; i++) {
+        if (entries_[i].lastUse == 0) return &entries_[i];
+        if (entries_[i].lastUse < v->lastUse) v = &entries_[i];
+    }
+    return v;
+}
+
+#endif // GINGODUINO_HAS_FINGERING_CACHE
+
+uint8_t GingoFretboard::cachedSearch_(const GingoChord& chord,
+                                      GingoPackedFingering* output, uint8_t k) const {
+#if GINGODUINO_HAS_FINGERING_CACHE
+    uint8_t fIdx = chord.formulaIndex();
+    if (cache_ && output && k > 0 && fIdx != 255) {
+        typedef GingoFingeringCache::Entry Entry;
+        typedef GingoFingeringCache::Slot  Slot;
+        uint8_t root = chord.root().semitone();
+        Entry* e = cache_->find_(root, fIdx, tuningHash_, capoFret_);
+        if (++cache_->clock_ == 0) cache_->clock_ = 1;
+
+        if (e && (k <= e->count || e->complete)) {
+            cache_->hits_++;
+            e->lastUse = cache_->clock_;
+            uint8_t n = (k < e->count) ? k : e->count;
+            for (uint8_t i = 0; i < n; i++) {
+                const Slot& slot = e->fg[i];
+                GingoPackedFingering& fg = output[i];
+                fg.numStrings = numStrings_;
+                fg.capoFret   = capoFret_;
+                fg.rootPc     = root;
+                fg.formula    = fIdx;
+                fg.score      = slot.score;
+                for (uint8_t s = 0; s < numStrings_; s++) {
+                    uint8_t nib = (uint8_t)((slot.frets[s >> 1] >> ((s & 1) * 4)) & 0x0F);
+                    fg.frets[s] = (nib == 0x0F) ? FG_MUTED
+                                : nib ? (uint8_t)(slot.baseFret + nib - 1) : 0;
+                }
+            }
+            return n;
+        }
+
+        cache_->misses_++;
+        uint8_t n = searchFingerings_(chord, 1, numFrets_, output, k);
+        if (!e) e = cache_->victim_();
+        e->tuning  = tuningHash_;
+        e->lastUse = cache_->clock_;
+        e->root    = root;
+        e->formula = fIdx;
+        e->capo    = capoFret_;
+        e->count   = (n < GINGODUINO_FINGERING_CACHE_DEPTH) ? n : GINGODUINO_FINGERING_CACHE_DEPTH;
+        e->complete = (n < k) && (n <= GINGODUINO_FINGERING_CACHE_DEPTH);
+        for (uint8_t i = 0; i < e->count; i++) {
+            const GingoPackedFingering& fg = output[i];
+            Slot& slot = e->fg[i];
+            slot.baseFret = fg.baseFret();
+            slot.score    = fg.score;
+            memset(slot.frets, 0, sizeof(slot.frets));
+            for (uint8_t s = 0; s < numStrings_; s++) {
+                uint8_t nib = 0x0F;
+                if (!fg.isMuted(s)) {
+                    uint8_t f = fg.fret(s);
+                    nib = f ? (uint8_t)(f - slot.baseFret + 1) : 0;
+                }
+                slot.frets[s >> 1] |= (uint8_t)(nib << ((s & 1) * 4));
+            }
+        }
+        return n;
+    }
+#endif
+    return searchFingerings_(chord, 1, numFrets_, output, k);
 }
 
 // ---------------------------------------------------------------------------
-// Reverse: identify chord from fret positions
+// Progression planning
 // ---------------------------------------------------------------------------
 
-bool GingoFretboard::identify(const uint8_t* stringFrets, uint8_t count,
-                              char* output, uint8_t maxLen) const {
-    GingoNote notes[GINGODUINO_MAX_STRINGS];
-    uint8_t noteCount = 0;
+// Transition weights (same scale as the playability score).
+static const uint16_t FG_W_SHIFT     = 3;    // per fret the hand travels
+static const uint16_t FG_W_LAND      = 2;    // per finger placed on a new fret
+static const uint16_t FG_W_VOICE     = 1;    // per string whose note changes
+
+uint16_t GingoFretboard::transitionCost(const GingoPackedFingering& a,
+                                        const GingoPackedFingering& b) {
+    bool aFretted = false, bFretted = false;
+    uint8_t n = (a.numStrings < b.numStrings) ? a.numStrings : b.numStrings;
+    uint16_t cost = 0;
+
+    for (uint8_t s = 0; s < n; s++) {
+        uint8_t fa = a.frets[s], fb = b.frets[s];
+        bool aHeld = fa != 0 && !(fa & FG_MUTED);
+        bool bHeld = fb != 0 && !(fb & FG_MUTED);
+        if (aHeld) aFretted = true;
+        if (bHeld) {
+            bFretted = true;
+            if (fa != fb) cost += FG_W_LAND;
+        }
+        if (fa != fb) cost += FG_W_VOICE;
+    }
 
+    // Open-only shapes leave the hand free to move
+    if (aFretted && bFretted) {
+        uint8_t ba = a.baseFret(), bb = b.baseFret();
+        uint8_t d = (ba > bb) ? (uint8_t)(ba - bb) : (uint8_t)(bb - ba);
+        cost += (uint16_t)d * FG_W_SHIFT;
+    }
+    return cost;
+}
+
+uint16_t GingoFretboard::transitionCost(const GingoFingering& a, const GingoFingering& b) {
+    return transitionCost(fgPack_(a), fgPack_(b));
+}
+
+uint8_t GingoFretboard::planFingerings(const GingoChord* chords, uint8_t count,
+                                       GingoFingering* output, uint8_t maxResults) const {
+    const uint8_t K = GINGODUINO_PLAN_CANDIDATES;
+    if (!chords || !output) return 0;
+    if (count > maxResults) count = maxResults;
+    if (count > GINGODUINO_MAX_PLAN_CHORDS) count = GINGODUINO_MAX_PLAN_CHORDS;
+    if (count == 0) return 0;
+
+    // Only two candidate layers live at once; back-pointers cover the rest
+    GingoPackedFingering layer[2][K];
+    uint8_t  layerCount[2];
+    uint32_t cost[2][K];
+    uint8_t  back[GINGODUINO_MAX_PLAN_CHORDS][K];
+
+    uint8_t cur = 0;
+    layerCount[cur] = cachedSearch_(chords[0], layer[cur], K);
+    if (layerCount[cur] == 0) return 0;
+    for (uint8_t j = 0; j < layerCount[cur]; j++) {
+        cost[cur][j] = layer[cur][j].score;
+        back[0][j] = 0;
+    }
+
+    for (uint8_t i = 1; i < count; i++) {
+        uint8_t prev = cur;
+        cur ^= 1;
+        layerCount[cur] = cachedSearch_(chords[i], layer[cur], K);
+        if (layerCount[cur] == 0) return 0;
+
+        for (uint8_t j = 0; j < layerCount[cur]; j++) {
+            uint32_t best = 0xFFFFFFFFUL;
+            uint8_t  arg = 0;
+            for (uint8_t p = 0; p < layerCount[prev]; p++) {
+                uint32_t c = cost[prev][p] + transitionCost(layer[prev][p], layer[cur][j]);
+                if (c < best) { best = c; arg = p; }
+            }
+            cost[cur][j] = best + layer[cur][j].score;
+            back[i][j] = arg;
+        }
+    }
+
+    // Trace back the cheapest path, then materialize each chosen candidate
+    uint8_t pick = 0;
+    for (uint8_t j = 1; j < layerCount[cur]; j++) {
+        if (cost[cur][j] < cost[cur][pick]) pick = j;
+    }
+    unpack_(layer[cur][pick], output[count - 1], chords[count - 1].name());
+    GingoPackedFingering* prev = layer[cur ^ 1];
+    for (uint8_t i = (uint8_t)(count - 1); i > 0; i--) {
+        pick = back[i][pick];
+        // Chord count-2 is still in the other layer; earlier ones are
+        // re-searched (the search is deterministic, so ranking is identical)
+        if (i + 1 < count) cachedSearch_(chords[i - 1], prev, K);
+        unpack_(prev[pick], output[i - 1], chords[i - 1].name());
+    }
+    return count;
+}
+
+// ---------------------------------------------------------------------------
+// Reverse: identify chord from fret positions
+// ---------------------------------------------------------------------------
+
+uint8_t GingoFretboard::identify(const uint8_t* stringFrets, uint8_t count,
+                                 ChordMatch* output, uint8_t maxResults) const {
+    if (!stringFrets) return 0;
+    uint16_t mask = 0;
+    uint8_t bass = 255;
     for (uint8_t i = 0; i < count && i < numStrings_; i++) {
-        if (stringFrets[i] == 255) continue;  // muted
-        uint8_t midi = openMidi_[i] + capoFret_ + stringFrets[i];
-        char name[3];
-        data::readChromaticName(midi % 12, name, sizeof(name));
-        notes[noteCount++] = GingoNote(name);
+        if (stringFrets[i] & GingoPackedFingering::MUTED) continue;  // muted
+        uint8_t midi = (uint8_t)(openMidi_[i] + capoFret_ + stringFrets[i]);
+        mask |= (uint16_t)(1u << (midi % 12));
+        if (midi < bass) bass = midi;
     }
+    if (mask == 0) return 0;
+    return GingoChord::identifyMask(mask, (uint8_t)(bass % 12), output, maxResults);
+}
 
-    if (noteCount == 0) {
+bool GingoFretboard::identify(const uint8_t* stringFrets, uint8_t count,
+                              char* output, uint8_t maxLen) const {
+    if (!output || maxLen == 0) return false;
+    ChordMatch best;
+    if (identify(stringFrets, count, &best, 1) == 0) {
         output[0] = '\0';
         return false;
     }
-
-    return GingoChord::identify(notes, noteCount, output, maxLen);
+    uint8_t i = 0;
+    const char* n = best.name.c_str();
+    while (n[i] && i < maxLen - 1) { output[i] = n[i]; i++; }
+    output[i] = '\0';
+    return true;
 }
 
 // ---------------------------------------------------------------------------
@@ -335,6 +979,7 @@ bool GingoFretboard::identify(const uint8_t* stringFrets, uint8_t count,
 void GingoFretboard::setString(uint8_t string, uint8_t midiNote) {
     if (string < numStrings_) {
         openMidi_[string] = midiNote;
+        rebuildIndex_();
     }
 }
 
@@ -350,20 +995,10 @@ uint8_t GingoFretboard::commonChords(const GingoScale& scale,
     uint8_t written = 0;
 
     for (uint8_t i = 0; i < numChords && written < maxResults; i++) {
-        // Try the first few positions and keep the best-scoring fingering
-        GingoFingering best;
-        bool bestValid = false;
-        for (uint8_t pos = 0; pos < 4; pos++) {
-            GingoFingering fg;
-            if (fingering(fieldChords[i], pos, fg)) {
-                if (!bestValid || fg.score < best.score) {
-                    best = fg;
-                    bestValid = true;
-                }
-            }
-        }
-        if (bestValid) {
-            output[written++] = best;
+        // Best-scoring fingering over the first 4 position windows
+        GingoPackedFingering best;
+        if (searchFingerings_(fieldChords[i], 1, 16, &best, 1) == 1) {
+            unpack_(best, output[written++], fieldChords[i].name());
         }
     }
     return written;
@@ -387,13 +1022,24 @@ bool GingoFretboard::isOpenFingering(const GingoFingering& fg) const {
 
 uint8_t GingoFretboard::openFingerings(const GingoChord& chord,
                                        GingoFingering* output, uint8_t maxResults) const {
-    GingoFingering all[GINGODUINO_MAX_FINGERINGS + 4];
-    uint8_t count = fingerings(chord, all, GINGODUINO_MAX_FINGERINGS + 4);
+#if GINGODUINO_HAS_SHAPE_LIBRARY
+    // The best shape in frets 0-4 is also the best open one, if it is open
+    GingoPackedFingering best;
+    if (maxResults == 1 && shape(chord, best)) {
+        unpack_(best, output[0], chord.name());
+        if (isOpenFingering(output[0])) return 1;
+    }
+#endif
+    // Open shapes fret nothing above 4: search that window, not the neck
+    GingoPackedFingering window[GINGODUINO_MAX_FINGERINGS + 4];
+    uint8_t count = searchFingerings_(chord, 1, 4, window, GINGODUINO_MAX_FINGERINGS + 4);
     uint8_t written = 0;
     for (uint8_t i = 0; i < count && written < maxResults; i++) {
-        if (isOpenFingering(all[i])) {
-            output[written++] = all[i];
+        bool hasOpen = false;
+        for (uint8_t s = 0; s < window[i].numStrings; s++) {
+            if (window[i].frets[s] == 0) hasOpen = true;
         }
+        if (hasOpen) unpack_(window[i], output[written++], chord.name());
     }
     return written;
 }
@@ -406,6 +1052,7 @@ GingoFretboard GingoFretboard::capo(uint8_t fret) const {
     GingoFretboard fb = *this;
     fb.capoFret_ = fret;
     fb.numFrets_ = (fret < numFrets_) ? (numFrets_ - fret) : 0;
+    fb.rebuildIndex_();
     return fb;
 }
 
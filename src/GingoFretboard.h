@@ -53,11 +53,112 @@ struct GingoFingering {
     uint16_t score;       ///< lower = better playability
 };
 
+/// A chord fingering packed to one byte per string: bit 7 = muted,
+/// bits 0-6 = fret (0 = open). The same byte convention as identify()
+/// input, so frets can be passed to it directly. The chord name and MIDI
+/// notes are not stored; use chordName() or GingoFretboard::unpack().
+struct GingoPackedFingering {
+    static const uint8_t MUTED = 0x80;
+
+    uint8_t  frets[GINGODUINO_MAX_STRINGS];
+    uint8_t  numStrings;
+    uint8_t  capoFret;    ///< capo position (0 = no capo)
+    uint8_t  rootPc;      ///< chord root pitch class (C = 0)
+    uint8_t  formula;     ///< chord formula index (255 = unknown)
+    uint16_t score;       ///< lower = better playability
+
+    bool    isMuted(uint8_t string) const { return (frets[string] & MUTED) != 0; }
+    uint8_t fret(uint8_t string) const { return (uint8_t)(frets[string] & 0x7F); }
+
+    /// Lowest non-zero fret (0 if nothing is fretted).
+    uint8_t baseFret() const;
+
+    /// Chord name from root and formula, sharp spelling (e.g. "A#7").
+    const char* chordName(char* buf, uint8_t maxLen) const;
+};
+
+#if GINGODUINO_HAS_FINGERING_CACHE
+/// Fixed-size LRU cache for GingoFretboard::fingerings() results.
+///
+/// Attach it with GingoFretboard::setCache(). Entries are keyed by chord
+/// root, chord formula, tuning hash and capo, so one cache can be shared by
+/// several fretboards (and their capo() copies). Each entry keeps the best
+/// GINGODUINO_FINGERING_CACHE_DEPTH fingerings as a base fret plus one
+/// nibble per string, and a score.
+///
+/// Lookups update the cache, so it is not safe to share between threads
+/// or cores; use one cache per task.
+///
+/// Examples:
+///   GingoFingeringCache cache;
+///   auto fb = GingoFretboard::guitar();
+///   fb.setCache(&cache);
+///   fb.fingerings(GingoChord("CM"), fgs, 3);   // miss: runs the search
+///   fb.fingerings(GingoChord("CM"), fgs, 3);   // hit
+class GingoFingeringCache {
+public:
+    /// Number of entries.
+    static const uint8_t CAPACITY = GINGODUINO_FINGERING_CACHE_SIZE;
+
+    GingoFingeringCache() { clear(); }
+
+    /// Drop all entries and reset the counters.
+    void clear();
+
+    /// Number of entries in use.
+    uint8_t size() const;
+
+    /// Lookups answered from the cache.
+    uint32_t hits() const { return hits_; }
+
+    /// Lookups that had to run the search.
+    uint32_t misses() const { return misses_; }
+
+private:
+    friend class GingoFretboard;
+
+    /// Stored fingering: fret nibble per string, 0xF = muted, 0 = open,
+    /// n = baseFret + n - 1.
+    struct Slot {
+        uint8_t  baseFret;
+        uint8_t  frets[(GINGODUINO_MAX_STRINGS + 1) / 2];
+        uint16_t score;
+    };
+
+    struct Entry {
+        uint32_t tuning;      ///< GingoFretboard tuning hash
+        uint32_t lastUse;     ///< LRU clock stamp (0 = empty)
+        uint8_t  root;        ///< chord root pitch class
+        uint8_t  formula;     ///< chord formula index
+        uint8_t  capo;
+        uint8_t  count;       ///< fingerings stored
+        bool     complete;    ///< search found no more than count
+        Slot     fg[GINGODUINO_FINGERING_CACHE_DEPTH];
+    };
+
+    Entry    entries_[CAPACITY];
+    uint32_t clock_;
+    uint32_t hits_;
+    uint32_t misses_;
+
+    /// Entry for a key, or nullptr.
+    Entry* find_(uint8_t root, uint8_t formula, uint32_t tuning, uint8_t capo);
+
+    /// Empty or least recently used entry.
+    Entry* victim_();
+};
+#endif // GINGODUINO_HAS_FINGERING_CACHE
+
 /// Fretted string instrument engine.
 ///
 /// Computes note positions, scale patterns, and chord fingerings
 /// for any fretted string instrument.
 ///
+/// Each instance keeps a position index: for every pitch class, a fret
+/// bitmask per string (bit f = fret f sounds that pitch class). The index
+/// is rebuilt only when the tuning changes (constructor, setString(), capo()),
+/// so position and scale queries reduce to mask ANDs.
+///
 /// Examples:
 ///   auto fb = GingoFretboard::violao();
 ///   fb.numStrings();   // 6
@@ -68,11 +169,17 @@ struct GingoFingering {
 ///   // fg contains open C major shape
 class GingoFretboard {
 public:
+    /// Highest fret covered by the position index. Each string's frets
+    /// are one bit each in a uint32_t mask (frets 0-31), so fret counts
+    /// above this are clamped to it.
+    static const uint8_t MAX_FRETS = 31;
+
     /// Construct from explicit tuning data.
     /// @param name       instrument name
     /// @param openMidi   MIDI notes for each open string (low to high)
     /// @param numStrings number of strings
-    /// @param numFrets   number of frets
+    /// @param numFrets   number of frets; values above MAX_FRETS are
+    ///                   silently clamped (numFrets() reports the result)
     GingoFretboard(const char* name,
                    const uint8_t* openMidi,
                    uint8_t numStrings,
@@ -105,6 +212,25 @@ public:
     /// Factory: DADGAD tuning (D A D G A D).
     static GingoFretboard dadgad(uint8_t numFrets = 19);
 
+    /// Factory: 4-string bass (E A D G).
+    static GingoFretboard bass(uint8_t numFrets = 20);
+
+    /// Factory: 5-string bass (B E A D G).
+    static GingoFretboard bass5(uint8_t numFrets = 24);
+
+    /// Factory: 6-string bass (B E A D G C).
+    static GingoFretboard bass6(uint8_t numFrets = 24);
+
+#if GINGODUINO_MAX_STRINGS >= 7
+    /// Factory: 7-string guitar (B E A D G B E).
+    static GingoFretboard sevenString(uint8_t numFrets = 24);
+#endif
+
+#if GINGODUINO_MAX_STRINGS >= 8
+    /// Factory: 8-string guitar (F# B E A D G B E).
+    static GingoFretboard eightString(uint8_t numFrets = 24);
+#endif
+
     /// Instrument name.
     const char* name() const { return name_.c_str(); }
 
@@ -126,6 +252,10 @@ public:
     /// Get the MIDI number at (string, fret).
     uint8_t midiAt(uint8_t string, uint8_t fret) const;
 
+    /// Bitmask of frets on a string (bit f = fret f) whose pitch class is in
+    /// pcMask (bit p = pitch class p, C = 0). Reads the position index only.
+    uint32_t fretMask(uint16_t pcMask, uint8_t string) const;
+
     /// Find all positions of a given note on the fretboard.
     /// Returns the number of positions written.
     uint8_t positions(const GingoNote& note,
@@ -137,25 +267,98 @@ public:
                            GingoFretPos* output, uint8_t maxPositions,
                            uint8_t fretLo = 0, uint8_t fretHi = 255) const;
 
-    /// Find a single fingering for a chord at a given position index.
+    /// Find the best fingering for a chord within a position window.
+    /// Window N covers frets N*4 .. N*4+4; open strings are always allowed.
     /// Returns true if a valid fingering was found.
     bool fingering(const GingoChord& chord, uint8_t positionIdx,
                    GingoFingering& output) const;
 
-    /// Find multiple fingerings for a chord, sorted by playability score.
-    /// Returns the number of fingerings written.
+    /// Find the best fingerings for a chord over the whole neck, sorted by
+    /// playability score (lower first).
+    ///
+    /// Runs a depth-first branch-and-bound search over strings. Every
+    /// voicing that covers the chord tones within a 4-fret span and at most
+    /// 4 fingers is considered; the top-K heap holds packed fingerings on
+    /// the stack, which are expanded into output at the end.
+    /// Returns the number of fingerings written, at most
+    /// GINGODUINO_MAX_FINGERINGS + 4 (use the packed overload for more).
     uint8_t fingerings(const GingoChord& chord,
                        GingoFingering* output, uint8_t maxResults) const;
 
-    /// Identify a chord from string-fret positions.
-    /// @param stringFrets  array of fret numbers per string (255 = muted)
+#if GINGODUINO_HAS_SHAPE_LIBRARY
+    /// Precomputed position-0 shape (frets 0-4) for a chord, by table
+    /// lookup instead of a search. Covers the standard tunings (guitar,
+    /// drop D, open G, DADGAD, ukulele, cavaquinho, bandolim), transposed
+    /// copies of them and any capo; the shape equals fingering(chord, 0).
+    /// The library keeps one shape per chord, the best one in frets 0-4;
+    /// shapes() derives the barre alternatives from it.
+    /// Returns false if the tuning or chord type is not in the library.
+    bool shape(const GingoChord& chord, GingoPackedFingering& output) const;
+
+    /// Ranked shapes for a chord from the library, best first: the
+    /// position-0 shape plus the E-form and A-form barres, i.e. the table
+    /// shape rooted on open string 0 or 1 moved up to the chord root
+    /// (F -> 133211, Bm -> x24432). Barres need at most 3 fretted strings
+    /// besides the barre and must fit on the neck. No search runs.
+    /// Returns the number of shapes written (at most 3).
+    uint8_t shapes(const GingoChord& chord,
+                   GingoPackedFingering* output, uint8_t maxResults) const;
+#endif
+
+    /// Same search, packed results (one byte per string); output doubles
+    /// as the top-K heap, so maxResults is not capped.
+    uint8_t fingerings(const GingoChord& chord,
+                       GingoPackedFingering* output, uint8_t maxResults) const;
+
+    /// Expand a packed fingering (name, base fret, MIDI notes).
+    void unpack(const GingoPackedFingering& packed, GingoFingering& output) const;
+
+    /// Choose one fingering per chord of a progression, minimizing total
+    /// playability score plus hand movement between consecutive shapes.
+    ///
+    /// Viterbi over the best GINGODUINO_PLAN_CANDIDATES fingerings of each
+    /// chord, with transitionCost() between neighbours. At most
+    /// GINGODUINO_MAX_PLAN_CHORDS chords are planned.
+    /// Returns the number of fingerings written (0 if any chord has none).
+    uint8_t planFingerings(const GingoChord* chords, uint8_t count,
+                           GingoFingering* output, uint8_t maxResults) const;
+
+    /// Cost of moving from fingering a to fingering b (lower = smoother):
+    /// hand shift in frets, fingers that must land on a new fret, and
+    /// voices that change (a note held on the same string costs nothing).
+    static uint16_t transitionCost(const GingoFingering& a, const GingoFingering& b);
+    static uint16_t transitionCost(const GingoPackedFingering& a, const GingoPackedFingering& b);
+
+    /// Identify chords from string-fret positions.
+    ///
+    /// Builds the pitch-class mask and bass note straight from the tuning
+    /// and hands them to GingoChord::identifyMask(), so inversions
+    /// ("CM/E"), doubled tones and omitted fifths resolve.
+    /// @param stringFrets  array of fret numbers per string (bit 7 set = muted,
+    ///                     so 255 and GingoPackedFingering::frets both work)
     /// @param count        number of entries
-    /// @param output       buffer for chord name
-    /// @param maxLen       buffer size
-    /// @return true if a chord was identified
+    /// @param output       ranked candidates, best first
+    /// @param maxResults   capacity of output
+    /// @return number of candidates written
+    uint8_t identify(const uint8_t* stringFrets, uint8_t count,
+                     ChordMatch* output, uint8_t maxResults) const;
+
+    /// Identify a chord from string-fret positions; writes the best
+    /// candidate's name (see above). Returns true if a chord was identified.
     bool identify(const uint8_t* stringFrets, uint8_t count,
                   char* output, uint8_t maxLen) const;
 
+    /// Identify the chord sounded by a packed fingering.
+    bool identify(const GingoPackedFingering& fg, char* output, uint8_t maxLen) const {
+        return identify(fg.frets, fg.numStrings, output, maxLen);
+    }
+
+    /// Ranked candidates for a packed fingering.
+    uint8_t identify(const GingoPackedFingering& fg,
+                     ChordMatch* output, uint8_t maxResults) const {
+        return identify(fg.frets, fg.numStrings, output, maxResults);
+    }
+
     /// Retune a single string to a new MIDI note.
     void setString(uint8_t string, uint8_t midiNote);
 
@@ -170,6 +373,8 @@ public:
     bool isOpenFingering(const GingoFingering& fg) const;
 
     /// Find open-position fingerings for a chord (open strings, frets 1-4).
+    /// A single result comes from the shape library when it has one; more
+    /// results search the frets 1-4 window only.
     /// Returns the number of fingerings written.
     uint8_t openFingerings(const GingoChord& chord,
                            GingoFingering* output, uint8_t maxResults) const;
@@ -177,15 +382,65 @@ public:
     /// Create a new fretboard with a capo at the given fret.
     GingoFretboard capo(uint8_t fret) const;
 
+#if GINGODUINO_HAS_FINGERING_CACHE
+    /// Attach a fingering cache (nullptr detaches). The cache is not owned
+    /// and is shared with fretboards copied from this one.
+    void setCache(GingoFingeringCache* cache) { cache_ = cache; }
+
+    /// The attached cache, or nullptr.
+    GingoFingeringCache* cache() const { return cache_; }
+#endif
+
 private:
     NameStr  name_;
     uint8_t  openMidi_[GINGODUINO_MAX_STRINGS];
     uint8_t  numStrings_;
     uint8_t  numFrets_;
     uint8_t  capoFret_;
+    uint32_t pcIndex_[12][GINGODUINO_MAX_STRINGS];  ///< [pc][string] fret bitmask
+    uint32_t tuningHash_;                            ///< open strings + fret count
+#if GINGODUINO_HAS_SHAPE_LIBRARY
+    uint8_t  shapeTable_;                            ///< SHAPE_TABLES index (255 = none)
+    uint8_t  shapeShift_;                            ///< semitones above that tuning
+#endif
+#if GINGODUINO_HAS_FINGERING_CACHE
+    GingoFingeringCache* cache_;
+#endif
+
+    /// Rebuild pcIndex_ from the current tuning, capo and fret count.
+    void rebuildIndex_();
 
     /// Score a fingering for playability (lower = better).
-    uint16_t scoreFingering(const GingoFingering& fg) const;
+    /// fg.rootPc is used for the bass-note penalty.
+    uint16_t scoreFingering(const GingoPackedFingering& fg) const;
+
+    /// unpack() with an explicit chord name (keeps the caller's spelling).
+    void unpack_(const GingoPackedFingering& p, GingoFingering& output,
+                 const char* chordName) const;
+
+#if GINGODUINO_HAS_SHAPE_LIBRARY
+    /// shape() by root pitch class and formula index.
+    bool shapeAt_(uint8_t rootPc, uint8_t fIdx, GingoPackedFingering& output) const;
+#endif
+
+    /// Search state for the fingering search (defined in the .cpp).
+    struct SearchCtx;
+
+    /// Branch-and-bound search for fingerings with fretted notes in
+    /// [fretLo, fretHi]. Results go to heap (capacity k), sorted by score.
+    uint8_t searchFingerings_(const GingoChord& chord,
+                              uint8_t fretLo, uint8_t fretHi,
+                              GingoPackedFingering* heap, uint8_t k) const;
+
+    /// Recursive step: assign a fret (or mute) to string s.
+    void searchString_(SearchCtx& ctx, uint8_t s) const;
+
+    /// Leaf: validate the full assignment and offer it to the heap.
+    void offerFingering_(SearchCtx& ctx) const;
+
+    /// Full-neck search, answered from the attached cache when possible.
+    uint8_t cachedSearch_(const GingoChord& chord,
+                          GingoPackedFingering* output, uint8_t k) const;
 };
 
 } // namespace gingoduino
@@ -16,9 +16,7 @@ namespace gingoduino {
 uint8_t GingoInterval::labelToSemitones(const char* label) {
     if (!label) return 255;
     for (uint8_t i = 0; i < 24; i++) {
-        char buf[5];
-        data::readPgmStr(buf, data::INTERVAL_TABLE[i].label, sizeof(buf));
-        if (strcmp(label, buf) == 0) return i;
+        if (data::pgmStrcmp(label, data::INTERVAL_TABLE[i].label) == 0) return i;
     }
     return 255;
 }
@@ -42,6 +42,10 @@
 #include "GingoNoteContext.h"
 #include "GingoMonitor.h"
 
+#if GINGODUINO_HAS_TUNING
+#include "GingoTuning.h"
+#endif
+
 namespace gingoduino {
 
 // ===========================================================================
@@ -209,6 +213,39 @@ public:
         return ump;
     }
 
+    // -----------------------------------------------------------------------
+    // Per-note pitch as Registered Per-Note Controller #3 (Pitch 7.25)
+    // -----------------------------------------------------------------------
+
+    /// Generate a Registered Per-Note Controller UMP setting the pitch of
+    /// one note (controller 3, Pitch 7.25: note number in bits 31-25, a
+    /// 25-bit fraction of a semitone below).
+    /// @param midiNoteNum  MIDI note number being retuned (0-127).
+    /// @param pitch725     Absolute pitch, e.g. GingoTuning::pitch725().
+    static GingoUMP perNotePitch(uint8_t midiNoteNum, uint32_t pitch725,
+                                 uint8_t group = 0, uint8_t channel = 0) {
+        GingoUMP ump;
+        ump.wordCount = 2;
+        ump.words[0] = ((uint32_t)0x4 << 28)
+                     | ((uint32_t)(group   & 0xF) << 24)
+                     | ((uint32_t)0x0              << 20)  // opcode: registered per-note ctrl
+                     | ((uint32_t)(channel & 0xF) << 16)
+                     | ((uint32_t)(midiNoteNum & 0x7F) << 8)
+                     | ((uint32_t)0x03);  // controller index 3 = Pitch 7.25
+        ump.words[1] = pitch725;
+        ump.words[2] = 0;
+        ump.words[3] = 0;
+        return ump;
+    }
+
+#if GINGODUINO_HAS_TUNING
+    /// Per-note pitch of midiNoteNum from a tuning table.
+    static GingoUMP perNotePitch(const GingoTuning& tuning, uint8_t midiNoteNum,
+                                 uint8_t group = 0, uint8_t channel = 0) {
+        return perNotePitch(midiNoteNum, tuning.pitch725(midiNoteNum), group, channel);
+    }
+#endif
+
 private:
     // -----------------------------------------------------------------------
     // Internal helpers
@@ -8,6 +8,7 @@
 #if GINGODUINO_HAS_MONITOR
 
 #include "GingoInterval.h"
+#include "GingoProfile.h"
 
 namespace gingoduino {
 
@@ -140,6 +141,7 @@ bool GingoMonitor::deduceFieldFromHeld_(GingoField& out) const {
 // ---------------------------------------------------------------------------
 
 void GingoMonitor::analyse_() {
+    GINGODUINO_PROBE(PROBE_MONITOR_ANALYSE);
     // --- Chord ---
     GingoChord newChord;
     bool newChordValid = buildChordFromHeld_(newChord);
@@ -41,7 +41,8 @@ namespace gingoduino {
 ///
 /// Feed MIDI events via noteOn() / noteOff(). The monitor identifies
 /// the current chord, deduces the most likely harmonic field, and fires
-/// registered callbacks when state changes.
+/// registered callbacks when state changes. Not synchronized: feed each
+/// monitor from one task.
 ///
 /// Examples:
 ///   GingoMonitor mon;
@@ -169,6 +170,14 @@ public:
     /// Number of currently held notes (includes sustained notes).
     uint8_t activeNoteCount() const { return heldCount_; }
 
+    /// Copy the held MIDI note numbers (includes sustained notes), in the
+    /// order they were played. Returns the number written.
+    uint8_t heldNotes(uint8_t* output, uint8_t maxNotes) const {
+        uint8_t n = heldCount_ < maxNotes ? heldCount_ : maxNotes;
+        for (uint8_t i = 0; i < n; i++) output[i] = held_[i];
+        return n;
+    }
+
     /// Whether the sustain pedal is active.
     bool hasSustain() const { return sustainHeld_; }
 
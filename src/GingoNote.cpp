@@ -6,8 +6,38 @@
 #include "GingoNote.h"
 #include "gingoduino_progmem.h"
 
+#if GINGODUINO_HAS_TUNING
+  #include "GingoTuning.h"
+#endif
+
 namespace gingoduino {
 
+// ---------------------------------------------------------------------------
+// Letter arithmetic (C = 0 ... B = 6)
+// ---------------------------------------------------------------------------
+
+static uint8_t letterIndex(char letter) {
+    return (uint8_t)((letter - 'C' + 7) % 7);
+}
+
+static char letterChar(uint8_t index) {
+    return (char)('A' + (index + 2) % 7);
+}
+
+/// Semitone of the natural note on a letter: C D E = 0 2 4, F G A B = 5 7 9 11.
+static uint8_t letterSemitone(uint8_t index) {
+    return (uint8_t)(2 * index - (index > 2 ? 1 : 0));
+}
+
+/// Sharp-based name of a semitone (as in the chromatic table), built from
+/// the letter below it: 1 -> "C#", 5 -> "F". Writes at most 3 bytes.
+static void sharpName(uint8_t semitone, char* out) {
+    const uint8_t index = (uint8_t)((semitone + (semitone > 4 ? 1 : 0)) / 2);
+    out[0] = letterChar(index);
+    out[1] = (semitone != letterSemitone(index)) ? '#' : '\0';
+    out[2] = '\0';
+}
+
 // ---------------------------------------------------------------------------
 // MIDI conversion
 // ---------------------------------------------------------------------------
@@ -51,9 +81,7 @@ uint8_t GingoNote::toSemitone(const char* noteName) {
 
     // Search in chromatic table
     for (uint8_t i = 0; i < 12; i++) {
-        char chromName[3];
-        data::readPgmStr(chromName, data::CHROMATIC_NAMES[i], sizeof(chromName));
-        if (strcmp(natural, chromName) == 0) {
+        if (data::pgmStrcmp(natural, data::CHROMATIC_NAMES[i]) == 0) {
             return i;
         }
     }
@@ -193,6 +221,36 @@ float GingoNote::frequency(int8_t octave, float tuning) const {
     return tuning * power;
 }
 
+#if GINGODUINO_HAS_TUNING
+float GingoNote::frequency(int8_t octave, const GingoTuning& tuning) const {
+    const int16_t midi = (int16_t)(12 * (octave + 1) + semitone_);
+    return (midi >= 0 && midi < 128) ? tuning.frequency((uint8_t)midi) : 0.0f;
+}
+#endif
+
+GingoNote GingoNote::spell(uint8_t semitones, uint8_t letterSteps) const {
+    const uint8_t letter = (uint8_t)((letterIndex(sound_) + letterSteps) % 7);
+    const uint8_t target = (uint8_t)((semitone_ + semitones) % 12);
+    // Accidental in -6..5 semitones from the natural letter
+    const int8_t acc = (int8_t)((target - letterSemitone(letter) + 18) % 12 - 6);
+
+    GingoNote note;
+    char name[4];
+    sharpName(target, name);
+    note.natural_.set(name);
+    note.semitone_ = target;
+    if (acc >= -2 && acc <= 2) {
+        uint8_t pos = 0;
+        name[pos++] = letterChar(letter);
+        for (int8_t i = 0; i < acc; i++) name[pos++] = '#';
+        for (int8_t i = 0; i > acc; i--) name[pos++] = 'b';
+        name[pos] = '\0';
+    }
+    note.name_.set(name);
+    note.sound_ = name[0];
+    return note;
+}
+
 GingoNote GingoNote::transpose(int8_t semitones) const {
     int8_t newIdx = (int8_t)(((int16_t)semitone_ + semitones % 12 + 12) % 12);
     char name[3];
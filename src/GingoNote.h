@@ -11,6 +11,10 @@
 
 namespace gingoduino {
 
+#if GINGODUINO_HAS_TUNING
+class GingoTuning;
+#endif
+
 /// Represents a single musical pitch class (e.g. "C", "Bb", "F#").
 ///
 /// Notes are stored in their original form and can be converted to a
@@ -50,6 +54,12 @@ public:
     /// @param tuning  Reference frequency for A4 in Hz (default 440.0).
     float frequency(int8_t octave = 4, float tuning = 440.0f) const;
 
+#if GINGODUINO_HAS_TUNING
+    /// Frequency in Hz from a tuning table (0 if the table leaves the
+    /// key unmapped).
+    float frequency(int8_t octave, const GingoTuning& tuning) const;
+#endif
+
     /// MIDI note number (C4 = 60).
     uint8_t midiNumber(int8_t octave = 4) const {
         return (uint8_t)(12 * (octave + 1) + semitone_);
@@ -61,6 +71,14 @@ public:
     /// Transpose by a number of semitones (positive = up, negative = down).
     GingoNote transpose(int8_t semitones) const;
 
+    /// The note semitones above this one, written letterSteps letters
+    /// higher, with the accidental that makes up the difference:
+    /// GingoNote("F").spell(5, 3) is "Bb", GingoNote("C").spell(8, 4) is
+    /// "G#", GingoNote("B").spell(9, 6) is "Ab". Falls back to the
+    /// sharp-based name when the letter is more than a double accidental
+    /// away. O(1), no name lookup.
+    GingoNote spell(uint8_t semitones, uint8_t letterSteps) const;
+
     /// Shortest distance on the circle of fifths (0-6).
     uint8_t distance(const GingoNote& other) const;
 
@@ -0,0 +1,221 @@
+// Gingoduino - Music Theory Library for Embedded Systems
+// Implementation of GingoPitch.
+//
+// SPDX-License-Identifier: MIT
+
+#include "GingoPitch.h"
+
+#if GINGODUINO_HAS_PITCH
+
+namespace gingoduino {
+
+// ---------------------------------------------------------------------------
+// Helpers
+// ---------------------------------------------------------------------------
+
+static const uint8_t CONFIRM_HOPS = 2;      // hops a new note must last
+static const uint8_t RELEASE_HOPS = 3;      // unvoiced hops before note-off
+static const float   HOLD_RANGE   = 0.75f;  // semitones a held note absorbs
+
+/// Change of d(tau) over one hop: squared differences of the samples
+/// entering the window (a against a - tau) minus those of the samples
+/// leaving it (c against c - tau). Samples are pre-shifted to 15 bits, so
+/// each term fits in 32 bits; the loop is contiguous and vectorizes.
+static int64_t hopDelta(const int16_t* a, const int16_t* b,
+                        const int16_t* c, const int16_t* e) {
+    int64_t sum = 0;
+    for (uint16_t i = 0; i < GINGODUINO_PITCH_HOP; i++) {
+        const int32_t p = a[i] - b[i];
+        const int32_t q = c[i] - e[i];
+        sum += p * p - q * q;
+    }
+    return sum;
+}
+
+static int64_t sumSquares(const int16_t* a, uint16_t n) {
+    int64_t sum = 0;
+    for (uint16_t i = 0; i < n; i++) sum += (int32_t)a[i] * a[i];
+    return sum;
+}
+
+// ---------------------------------------------------------------------------
+// GingoPitch
+// ---------------------------------------------------------------------------
+
+GingoPitch::GingoPitch(uint32_t sampleRate)
+    : sampleRate_(sampleRate ? sampleRate : 44100), threshold_(0.15f),
+      cb_(nullptr), cbCtx_(nullptr)
+#if GINGODUINO_HAS_MONITOR
+    , monitor_(nullptr), channel_(0)
+#endif
+{
+    setGate(-50.0f);
+    setRange(60.0f, 1500.0f);
+}
+
+void GingoPitch::setRange(float minHz, float maxHz) {
+    if (minHz < 1.0f) minHz = 1.0f;
+    if (maxHz <= minHz) maxHz = minHz * 2.0f;
+    float lagMax = (float)sampleRate_ / minHz + 1.0f;
+    float lagMin = (float)sampleRate_ / maxHz;
+    lagMax_ = lagMax > MAX_LAG ? MAX_LAG : (uint16_t)lagMax;
+    lagMin_ = lagMin < 2.0f ? 2 : (uint16_t)lagMin;
+    if (lagMin_ + 2 > lagMax_) lagMin_ = lagMax_ > 4 ? lagMax_ - 2 : 2;
+    reset();
+}
+
+void GingoPitch::setGate(float dbfs) {
+    // Samples are kept >> 1, so full scale is 16384
+    const float rms = powf(10.0f, dbfs / 20.0f) * 16384.0f;
+    gate_ = (int64_t)(rms * rms * WINDOW);
+}
+
+void GingoPitch::reset() {
+    memset(x_, 0, sizeof(x_));
+    memset(diff_, 0, sizeof(diff_));
+    energy_ = 0;
+    frame_ = 0;
+    fill_ = 0;
+    frequency_ = 0.0f;
+    clarity_ = 0.0f;
+    voiced_ = false;
+    note_ = 0xFF;
+    cents_ = 0;
+    candidate_ = 0xFF;
+    candidateHops_ = 0;
+    silentHops_ = 0;
+}
+
+void GingoPitch::process(const int16_t* samples, uint16_t count, uint8_t stride) {
+    if (!samples || stride == 0) return;
+    int16_t* in = x_ + (HISTORY - HOP);
+    for (uint16_t i = 0; i < count; i++) {
+        in[fill_++] = (int16_t)(samples[(uint32_t)i * stride] >> 1);
+        frame_++;
+        if (fill_ == HOP) hop_();
+    }
+}
+
+// A full hop of new samples sits at the end of the history.
+void GingoPitch::hop_() {
+    const int16_t* in  = x_ + (HISTORY - HOP);
+    const int16_t* out = x_ + (HISTORY - HOP - WINDOW);   // leaving the window
+
+    energy_ += sumSquares(in, HOP) - sumSquares(out, HOP);
+    for (uint16_t tau = 1; tau <= lagMax_; tau++) {
+        diff_[tau] += hopDelta(in, in - tau, out, out - tau);
+    }
+
+    track_(detect_());
+
+    memmove(x_, x_ + HOP, (HISTORY - HOP) * sizeof(int16_t));
+    fill_ = 0;
+}
+
+// Period in samples from the cumulative mean normalized difference, or 0
+// when the window is below the gate or has no dip under the threshold.
+float GingoPitch::detect_() {
+    clarity_ = 0.0f;
+    if (energy_ < gate_) return 0.0f;
+
+    int64_t cum = 0;
+    float cPrev2 = 1.0f, cPrev = 1.0f, best = 1.0f;
+    bool below = false;
+    for (uint16_t tau = 1; tau <= lagMax_; tau++) {
+        cum += diff_[tau];
+        const float c = cum > 0 ? (float)diff_[tau] * tau / (float)cum : 1.0f;
+        if (below && c >= cPrev) {
+            // Local minimum at tau - 1: refine between its neighbours
+            const float denom = cPrev2 - 2.0f * cPrev + c;
+            const float shift = denom > 0.0f ? 0.5f * (cPrev2 - c) / denom : 0.0f;
+            clarity_ = 1.0f - cPrev;
+            return (float)(tau - 1) + shift;
+        }
+        if (!below && tau >= lagMin_ && c < threshold_) below = true;
+        if (tau >= lagMin_ && c < best) best = c;
+        cPrev2 = cPrev;
+        cPrev = c;
+    }
+    if (below) {
+        clarity_ = 1.0f - cPrev;
+        return (float)lagMax_;
+    }
+    clarity_ = 1.0f - best;
+    return 0.0f;
+}
+
+// Note state machine: confirm new notes, hold through small deviations,
+// release after silence.
+void GingoPitch::track_(float period) {
+    if (period <= 0.0f) {
+        voiced_ = false;
+        candidateHops_ = 0;
+        if (note_ != 0xFF && ++silentHops_ >= RELEASE_HOPS) {
+            const uint8_t off = note_;
+            note_ = 0xFF;
+            emit_(PITCH_NOTE_OFF, off, 0);
+        }
+        return;
+    }
+
+    voiced_ = true;
+    silentHops_ = 0;
+    frequency_ = (float)sampleRate_ / period;
+    const float midi = 69.0f + 12.0f * log2f(frequency_ / 440.0f);
+
+    if (note_ != 0xFF && fabsf(midi - note_) < HOLD_RANGE) {
+        cents_ = (int8_t)lroundf((midi - note_) * 100.0f);
+        candidateHops_ = 0;
+        return;
+    }
+    const long nearest = lroundf(midi);
+    if (nearest < 0 || nearest > 127) {
+        voiced_ = false;
+        return;
+    }
+    const uint8_t n = (uint8_t)nearest;
+    cents_ = (int8_t)lroundf((midi - n) * 100.0f);
+    if (n == candidate_) {
+        candidateHops_++;
+    } else {
+        candidate_ = n;
+        candidateHops_ = 1;
+    }
+    if (candidateHops_ < CONFIRM_HOPS) return;
+
+    if (note_ != 0xFF) emit_(PITCH_NOTE_OFF, note_, 0);
+    note_ = n;
+    candidateHops_ = 0;
+    emit_(PITCH_NOTE_ON, n, velocity_());
+}
+
+// -60..0 dBFS window level mapped to velocity 1..127.
+uint8_t GingoPitch::velocity_() const {
+    const float rms = sqrtf((float)energy_ / WINDOW) / 16384.0f;
+    const float db = rms > 0.0f ? 20.0f * log10f(rms) : -120.0f;
+    const float v = 127.0f + db * (126.0f / 60.0f);
+    return v < 1.0f ? 1 : v > 127.0f ? 127 : (uint8_t)v;
+}
+
+void GingoPitch::emit_(PitchEventType type, uint8_t midiNum, uint8_t velocity) {
+    GingoPitchEvent e;
+    e.type = type;
+    e.midiNum = midiNum;
+    e.velocity = velocity;
+    e.cents = type == PITCH_NOTE_ON ? cents_ : 0;
+    e.frequency = type == PITCH_NOTE_ON ? frequency_ : 0.0f;
+    e.frame = frame_;
+
+#if GINGODUINO_HAS_MONITOR
+    if (monitor_) {
+        if (type == PITCH_NOTE_ON) monitor_->noteOn(channel_, midiNum, velocity);
+        else                       monitor_->noteOff(channel_, midiNum);
+    }
+#endif
+    if (fn_)      fn_(e);
+    else if (cb_) cb_(e, cbCtx_);
+}
+
+} // namespace gingoduino
+
+#endif // GINGODUINO_HAS_PITCH
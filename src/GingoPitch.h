@@ -0,0 +1,185 @@
+// Gingoduino - Music Theory Library for Embedded Systems
+// GingoPitch: streaming monophonic pitch detector for audio input.
+//
+// Turns int16 audio (guitar, voice, a single synth line) into note-on /
+// note-off events with the cents deviation of the played pitch, so audio
+// input can drive a GingoMonitor the same way MIDI does.
+//
+//   GingoPitch pitch(48000);
+//   pitch.setMonitor(&monitor);          // noteOn/noteOff forwarded
+//   pitch.process(block, 256);           // from the I2S / ADC callback
+//   pitch.cents();                       // deviation of the held note
+//
+// SPDX-License-Identifier: MIT
+
+#ifndef GINGO_PITCH_H
+#define GINGO_PITCH_H
+
+#include "gingoduino_config.h"
+
+#if GINGODUINO_HAS_PITCH
+
+#include "gingoduino_types.h"
+
+#if GINGODUINO_HAS_MONITOR
+  #include "GingoMonitor.h"
+#endif
+
+#include <functional>
+
+namespace gingoduino {
+
+/// Kind of pitch event.
+enum PitchEventType : uint8_t {
+    PITCH_NOTE_ON  = 0,
+    PITCH_NOTE_OFF = 1
+};
+
+/// A note starting or ending in the audio.
+struct GingoPitchEvent {
+    PitchEventType type;
+    uint8_t        midiNum;     ///< detected note
+    uint8_t        velocity;    ///< from the window level (note-on only)
+    int8_t         cents;       ///< deviation from midiNum, -50..+50
+    float          frequency;   ///< Hz at the event (0 for note-off)
+    uint32_t       frame;       ///< input sample index where it was decided
+};
+
+/// Streaming YIN pitch detector.
+///
+/// Audio is analysed every GINGODUINO_PITCH_HOP samples over a window of
+/// GINGODUINO_PITCH_WINDOW samples. The YIN difference function is kept
+/// up to date incrementally: each hop adds the terms of the new samples
+/// and removes those of the samples leaving the window, one contiguous
+/// integer loop per lag, so a hop costs O(hop x lag range) rather than
+/// O(window x lag range). The cumulative mean normalized difference is
+/// then scanned for the first dip under the threshold and refined by
+/// parabolic interpolation.
+///
+/// A note is reported once the same note has been seen on two hops in a
+/// row, and released after three unvoiced hops or when another note takes
+/// over. Latency is therefore about one window plus two hops.
+///
+/// State is about 2 x (window + lag + hop) bytes of audio history plus
+/// 8 bytes per lag (about 12.5 KB with the defaults); use one detector
+/// per input.
+///
+/// Examples:
+///   GingoPitch pitch(44100);
+///   pitch.setRange(70.0f, 1200.0f);      // guitar
+///   pitch.onPitch([](const GingoPitchEvent& e, void*) {
+///       if (e.type == PITCH_NOTE_ON) Serial.println(e.midiNum);
+///   });
+///   pitch.process(samples, count);
+class GingoPitch {
+public:
+    static const uint16_t WINDOW  = GINGODUINO_PITCH_WINDOW;
+    static const uint16_t MAX_LAG = GINGODUINO_PITCH_MAX_LAG;
+    static const uint16_t HOP     = GINGODUINO_PITCH_HOP;
+
+    /// Called on every note-on and note-off.
+    typedef void (*PitchCallback)(const GingoPitchEvent& event, void* ctx);
+
+    /// Range 60-1500 Hz (clamped to MAX_LAG), threshold 0.15, gate -50 dBFS.
+    explicit GingoPitch(uint32_t sampleRate = 44100);
+
+    uint32_t sampleRate() const { return sampleRate_; }
+
+    /// Lowest and highest frequency searched. The lowest is raised if its
+    /// period is longer than MAX_LAG samples. Resets the detector.
+    void setRange(float minHz, float maxHz);
+    float minFrequency() const { return (float)sampleRate_ / lagMax_; }
+    float maxFrequency() const { return (float)sampleRate_ / lagMin_; }
+
+    /// YIN threshold on the normalized difference (lower = stricter).
+    void setThreshold(float threshold) { threshold_ = threshold; }
+
+    /// Window RMS below which the input counts as silence, in dBFS.
+    void setGate(float dbfs);
+
+    /// Forward note-on/off to a monitor on the given channel (nullptr to
+    /// detach).
+#if GINGODUINO_HAS_MONITOR
+    void setMonitor(GingoMonitor* monitor, uint8_t channel = 0) {
+        monitor_ = monitor;
+        channel_ = channel;
+    }
+#endif
+
+    /// Register a callback for note-on/off. Pass ctx=nullptr if no user
+    /// data is needed.
+    void onPitch(PitchCallback cb, void* ctx = nullptr) {
+        cb_ = cb;
+        cbCtx_ = ctx;
+    }
+
+    /// Register a callback with lambda capture support (takes precedence).
+    void onPitch(std::function<void(const GingoPitchEvent&)> fn) { fn_ = fn; }
+
+    /// Feed count samples. With stride > 1 every stride-th sample is read
+    /// (one channel of interleaved audio).
+    void process(const int16_t* samples, uint16_t count, uint8_t stride = 1);
+
+    /// Clear the history and release the current note (without events).
+    void reset();
+
+    /// Pitch found on the last hop.
+    bool voiced() const { return voiced_; }
+
+    /// Frequency on the last voiced hop, in Hz (0 before the first one).
+    float frequency() const { return frequency_; }
+
+    /// 1 - normalized difference at the detected period (1 = pure tone).
+    float clarity() const { return clarity_; }
+
+    /// Note currently on, or 0xFF.
+    uint8_t note() const { return note_; }
+
+    /// Deviation of the last voiced hop from note() (or from the nearest
+    /// note when none is on), in cents.
+    int8_t cents() const { return cents_; }
+
+    /// Samples consumed so far.
+    uint32_t frames() const { return frame_; }
+
+private:
+    static const uint16_t HISTORY = WINDOW + MAX_LAG + HOP;
+
+    int16_t  x_[HISTORY];            ///< history, newest last, samples >> 1
+    int64_t  diff_[MAX_LAG + 1];     ///< YIN difference d(tau) over the window
+    int64_t  energy_;                ///< sum of squares over the window
+    uint32_t sampleRate_;
+    uint32_t frame_;
+    uint16_t fill_;                  ///< new samples waiting for the hop
+    uint16_t lagMin_;
+    uint16_t lagMax_;
+    float    threshold_;
+    int64_t  gate_;                  ///< energy threshold for the window
+    float    frequency_;
+    float    clarity_;
+    bool     voiced_;
+    uint8_t  note_;
+    int8_t   cents_;
+    uint8_t  candidate_;             ///< note seen on the last hop
+    uint8_t  candidateHops_;
+    uint8_t  silentHops_;
+
+    PitchCallback cb_;
+    void*         cbCtx_;
+    std::function<void(const GingoPitchEvent&)> fn_;
+#if GINGODUINO_HAS_MONITOR
+    GingoMonitor* monitor_;
+    uint8_t       channel_;
+#endif
+
+    void  hop_();
+    float detect_();
+    void  track_(float period);
+    void  emit_(PitchEventType type, uint8_t midiNum, uint8_t velocity);
+    uint8_t velocity_() const;
+};
+
+} // namespace gingoduino
+
+#endif // GINGODUINO_HAS_PITCH
+#endif // GINGO_PITCH_H
@@ -0,0 +1,91 @@
+// Gingoduino - Music Theory Library for Embedded Systems
+// GingoProfile: probe table and binary dump.
+//
+// SPDX-License-Identifier: MIT
+
+#include "GingoProfile.h"
+
+#if GINGODUINO_PROFILE
+
+#include <string.h>
+
+namespace gingoduino {
+namespace GingoProfile {
+
+static GingoProbeStats probeTable_[PROBE_COUNT];
+static CycleCounter    counter_ = nullptr;
+
+static const char* const PROBE_NAMES[PROBE_COUNT] = {
+    "chord.identify",
+    "chord.identifyMask",
+    "field.deduce",
+    "monitor.analyse",
+    "tree.hasEdge",
+    "tree.findBranch",
+    "fretboard.fingering",
+    "fretboard.search",
+    "pgm.readStr",
+};
+
+void setCounter(CycleCounter c) { counter_ = c; }
+
+CycleCounter counter() { return counter_; }
+
+void reset() { memset(probeTable_, 0, sizeof(probeTable_)); }
+
+const GingoProbeStats& stats(uint8_t probe) {
+    static const GingoProbeStats EMPTY = { 0, 0, 0 };
+    return (probe < PROBE_COUNT) ? probeTable_[probe] : EMPTY;
+}
+
+const char* probeName(uint8_t probe) {
+    return (probe < PROBE_COUNT) ? PROBE_NAMES[probe] : "";
+}
+
+void record(uint8_t probe, uint32_t cycles) {
+    if (probe >= PROBE_COUNT) return;
+    GingoProbeStats& s = probeTable_[probe];
+    s.count++;
+    s.total += cycles;
+    if (cycles > s.max) s.max = cycles;
+}
+
+static uint8_t* putU32_(uint8_t* p, uint32_t v) {
+    p[0] = (uint8_t)(v);
+    p[1] = (uint8_t)(v >> 8);
+    p[2] = (uint8_t)(v >> 16);
+    p[3] = (uint8_t)(v >> 24);
+    return p + 4;
+}
+
+uint16_t dump(uint8_t* buf, uint16_t maxLen) {
+    if (!buf) return 0;
+    uint8_t records = 0;
+    for (uint8_t i = 0; i < PROBE_COUNT; i++) {
+        if (probeTable_[i].count) records++;
+    }
+    const uint16_t len = (uint16_t)(6 + 13 * records);
+    if (maxLen < len) return 0;
+
+    uint8_t* p = buf;
+    *p++ = 'G';
+    *p++ = 'P';
+    *p++ = DUMP_VERSION;
+    *p++ = (uint8_t)GINGODUINO_TIER;
+    *p++ = PROBE_COUNT;
+    *p++ = records;
+    for (uint8_t i = 0; i < PROBE_COUNT; i++) {
+        const GingoProbeStats& s = probeTable_[i];
+        if (!s.count) continue;
+        *p++ = i;
+        p = putU32_(p, s.count);
+        p = putU32_(p, s.total);
+        p = putU32_(p, s.max);
+    }
+    return len;
+}
+
+} // namespace GingoProfile
+} // namespace gingoduino
+
+#endif // GINGODUINO_PROFILE
@@ -0,0 +1,119 @@
+// Gingoduino - Music Theory Library for Embedded Systems
+// GingoProfile: opt-in hot-path probes.
+//
+// Build with GINGODUINO_PROFILE=1 and register a cycle counter; each probe
+// then accumulates call count, total and max cycles (inclusive of nested
+// probes) into a static table. With GINGODUINO_PROFILE 0 (the default)
+// every probe expands to nothing.
+//
+//   static uint32_t cycles() { return ESP.getCycleCount(); }
+//
+//   GingoProfile::setCounter(cycles);
+//   ... run the sketch ...
+//   uint8_t buf[GingoProfile::DUMP_MAX];
+//   Serial.write(buf, GingoProfile::dump(buf, sizeof(buf)));
+//
+// Dumps from two builds can be compared on the host with
+// extras/tools/profile_diff.cpp. The table is not synchronized: probe from
+// one core or task at a time.
+//
+// SPDX-License-Identifier: MIT
+
+#ifndef GINGO_PROFILE_H
+#define GINGO_PROFILE_H
+
+#include "gingoduino_config.h"
+
+#if GINGODUINO_PROFILE
+
+#include <stdint.h>
+
+namespace gingoduino {
+
+/// Probe identifiers. Values are stored in dumps: append new probes at the
+/// end and never renumber.
+enum ProfileProbe : uint8_t {
+    PROBE_CHORD_IDENTIFY      = 0,  ///< GingoChord::identify
+    PROBE_CHORD_IDENTIFY_MASK = 1,  ///< GingoChord::identifyMask
+    PROBE_FIELD_DEDUCE        = 2,  ///< GingoField::deduce
+    PROBE_MONITOR_ANALYSE     = 3,  ///< GingoMonitor::analyse_ (every note event)
+    PROBE_TREE_HAS_EDGE       = 4,  ///< GingoTree::hasEdge
+    PROBE_TREE_FIND_BRANCH    = 5,  ///< GingoTree::findBranch
+    PROBE_FRETBOARD_FINGERING = 6,  ///< GingoFretboard::fingering
+    PROBE_FRETBOARD_SEARCH    = 7,  ///< GingoFretboard fingering search (uncached)
+    PROBE_PGM_STR             = 8,  ///< data::readPgmStr
+    PROBE_COUNT               = 9
+};
+
+/// Accumulated figures for one probe.
+struct GingoProbeStats {
+    uint32_t count;   ///< calls
+    uint32_t total;   ///< cycles, summed (wraps after 2^32)
+    uint32_t max;     ///< cycles, longest call
+};
+
+namespace GingoProfile {
+
+/// Returns a free-running cycle (or microsecond) count.
+typedef uint32_t (*CycleCounter)();
+
+/// Dump format version, bumped when the layout changes.
+static const uint8_t DUMP_VERSION = 1;
+
+/// Largest dump: 6-byte header plus 13 bytes per probe.
+static const uint16_t DUMP_MAX = 6 + 13 * PROBE_COUNT;
+
+/// Set the counter read at probe entry and exit. Without one, probes only
+/// count calls.
+void setCounter(CycleCounter counter);
+
+/// The registered counter (nullptr if none).
+CycleCounter counter();
+
+/// Clear every probe.
+void reset();
+
+/// Figures for a probe (all zero for an unknown id).
+const GingoProbeStats& stats(uint8_t probe);
+
+/// Short probe name ("chord.identify", ...), or "" for an unknown id.
+const char* probeName(uint8_t probe);
+
+/// Write the table in compact binary, little-endian:
+///   'G' 'P' version tier probeCount recordCount
+///   recordCount x { id u8, count u32, total u32, max u32 }
+/// Only probes that ran are written. Returns bytes written, or 0 if
+/// maxLen is too small.
+uint16_t dump(uint8_t* buf, uint16_t maxLen);
+
+/// Add one call of the given length. Used by the probes.
+void record(uint8_t probe, uint32_t cycles);
+
+/// Scoped probe: reads the counter on construction and records on exit.
+class Scope {
+public:
+    explicit Scope(uint8_t probe)
+        : probe_(probe), start_(counter() ? counter()() : 0) {}
+    ~Scope() {
+        CycleCounter c = counter();
+        record(probe_, c ? (uint32_t)(c() - start_) : 0);
+    }
+private:
+    uint8_t  probe_;
+    uint32_t start_;
+    Scope(const Scope&);
+    Scope& operator=(const Scope&);
+};
+
+} // namespace GingoProfile
+} // namespace gingoduino
+
+#define GINGODUINO_PROBE(probe) \
+    ::gingoduino::GingoProfile::Scope gingoProbeScope_(::gingoduino::probe)
+
+#else
+
+#define GINGODUINO_PROBE(probe) ((void)0)
+
+#endif // GINGODUINO_PROFILE
+#endif // GINGO_PROFILE_H
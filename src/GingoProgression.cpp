@@ -65,11 +65,10 @@ static void sortRoutes(ProgressionRoute* arr, uint8_t n) {
     }
 }
 
-// Read a schema from PROGMEM
+// Read a schema's branches from PROGMEM. The name stays in flash: callers
+// copy it only for the schema they keep.
 static void readSchema(const data::ProgSchema* pgmSchema,
-                       char* name, uint8_t nameMax,
                        uint8_t* branches, uint8_t* count, uint8_t* ctx) {
-    data::readPgmStr(name, pgmSchema->name, nameMax);
     *count = pgm_read_byte(&pgmSchema->count);
     *ctx = pgm_read_byte(&pgmSchema->ctx);
     for (uint8_t i = 0; i < *count; i++) {
@@ -127,9 +126,8 @@ bool GingoProgression::identify(const char* const* branches, uint8_t count,
         uint8_t schemaScoreVal = 0;
 
         for (uint8_t s = 0; s < schemaCount; s++) {
-            char sName[24];
             uint8_t sBranches[8], sCount, sCtx;
-            readSchema(&schemas[s], sName, sizeof(sName), sBranches, &sCount, &sCtx);
+            readSchema(&schemas[s], sBranches, &sCount, &sCtx);
 
             // Context must match
             if (sCtx != t.context()) continue;
@@ -142,7 +140,7 @@ bool GingoProgression::identify(const char* const* branches, uint8_t count,
                 }
                 if (exact) {
                     schemaScoreVal = 100;
-                    memcpy(bestSchemaName, sName, sizeof(bestSchemaName));
+                    data::readPgmStr(bestSchemaName, schemas[s].name, sizeof(bestSchemaName));
                     break;
                 }
             }
@@ -152,7 +150,7 @@ bool GingoProgression::identify(const char* const* branches, uint8_t count,
                 uint8_t ss = (uint8_t)((uint16_t)inputLen * 100 / sCount);
                 if (ss > schemaScoreVal) {
                     schemaScoreVal = ss;
-                    memcpy(bestSchemaName, sName, sizeof(bestSchemaName));
+                    data::readPgmStr(bestSchemaName, schemas[s].name, sizeof(bestSchemaName));
                 }
             }
         }
@@ -210,9 +208,8 @@ uint8_t GingoProgression::deduce(const char* const* branches, uint8_t count,
         bool hasSchemaMatch = false;
 
         for (uint8_t s = 0; s < schemaCount && candCount < 24; s++) {
-            char sName[24];
             uint8_t sBranches[8], sCount, sCtx;
-            readSchema(&schemas[s], sName, sizeof(sName), sBranches, &sCount, &sCtx);
+            readSchema(&schemas[s], sBranches, &sCount, &sCtx);
 
             if (sCtx != t.context()) continue;
 
@@ -241,7 +238,7 @@ uint8_t GingoProgression::deduce(const char* const* branches, uint8_t count,
                 hasSchemaMatch = true;
                 ProgressionMatch& m = candidates[candCount++];
                 m.traditionId = trad;
-                memcpy(m.schema, sName, sizeof(m.schema));
+                data::readPgmStr(m.schema, schemas[s].name, sizeof(m.schema));
                 m.matched = validTrans;
                 m.total = totalTrans;
                 m.scoreNum = (transScore > schemaScore) ? transScore : schemaScore;
@@ -321,9 +318,8 @@ uint8_t GingoProgression::predict(const char* const* branches, uint8_t count,
             char matchedSchema[24] = "";
 
             for (uint8_t s = 0; s < schemaCount; s++) {
-                char sName[24];
                 uint8_t sBranches[8], sCount, sCtx;
-                readSchema(&schemas[s], sName, sizeof(sName), sBranches, &sCount, &sCtx);
+                readSchema(&schemas[s], sBranches, &sCount, &sCtx);
 
                 if (sCtx != t.context()) continue;
 
@@ -332,7 +328,7 @@ uint8_t GingoProgression::predict(const char* const* branches, uint8_t count,
                     uint8_t c = (uint8_t)((uint16_t)candLen * 100 / sCount);
                     if (c > confidence) {
                         confidence = c;
-                        memcpy(matchedSchema, sName, sizeof(matchedSchema));
+                        data::readPgmStr(matchedSchema, schemas[s].name, sizeof(matchedSchema));
                     }
                 }
 
@@ -341,7 +337,7 @@ uint8_t GingoProgression::predict(const char* const* branches, uint8_t count,
                     uint8_t c = (uint8_t)((uint16_t)candLen * 80 / sCount);
                     if (c > confidence) {
                         confidence = c;
-                        memcpy(matchedSchema, sName, sizeof(matchedSchema));
+                        data::readPgmStr(matchedSchema, schemas[s].name, sizeof(matchedSchema));
                     }
                 }
             }
@@ -174,6 +174,40 @@ uint8_t GingoScale::notes(GingoNote* output, uint8_t maxNotes) const {
     return written;
 }
 
+/// Letters above the tonic for an offset in a scale that is not
+/// heptatonic (see formalNotes()).
+static uint8_t offsetSteps(uint8_t offset, uint16_t mask) {
+    // Offsets outside the major scale borrow a neighbouring letter
+    if (offset == 1 || offset == 3 || offset == 6 || offset == 8 || offset == 10) {
+        offset = (mask & (1 << (offset + 1))) ? offset - 1 : offset + 1;
+    }
+    return offset <= 4 ? offset / 2 : (offset + 1) / 2;
+}
+
+uint8_t GingoScale::formalNotes(GingoNote* output, uint8_t maxNotes) const {
+    if (!output) return 0;
+    const uint16_t mask = computeMask12();
+    // A pentatonic keeps the letters of the mode it is taken from
+    const uint16_t letters = pentatonic_
+        ? GingoScale(tonic_.name(), parent_, modeNumber_).computeMask12() : mask;
+    uint8_t count = 0;
+    for (uint8_t i = 0; i < 12; i++) {
+        if (letters & (1 << i)) count++;
+    }
+    const bool heptatonic = count == 7;
+
+    uint8_t written = 0;
+    uint8_t rank = 0;
+    for (uint8_t i = 0; i < 12 && written < maxNotes; i++) {
+        if (mask & (1 << i)) {
+            const uint8_t steps = heptatonic ? rank : offsetSteps(i, mask);
+            output[written++] = tonic_.spell(i, steps);
+        }
+        if (letters & (1 << i)) rank++;
+    }
+    return written;
+}
+
 GingoNote GingoScale::degree(uint8_t n) const {
     uint16_t mask = computeMask12();
     uint8_t rootSt = tonic_.semitone();
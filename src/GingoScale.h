@@ -55,6 +55,15 @@ public:
     /// Returns the number of notes written.
     uint8_t notes(GingoNote* output, uint8_t maxNotes) const;
 
+    /// Fill output array with scale notes spelled by letter from the
+    /// tonic: seven-note scales (and pentatonics taken from them) use each
+    /// letter once, so F major has Bb and Gb major has Cb. Other scales
+    /// spell natural steps by their letter and the rest as the flat of
+    /// the next letter, or the sharp of the previous one when the next
+    /// letter is already in the scale.
+    /// Returns the number of notes written.
+    uint8_t formalNotes(GingoNote* output, uint8_t maxNotes) const;
+
     /// Get the note at a specific scale degree (1-indexed).
     GingoNote degree(uint8_t n) const;
 
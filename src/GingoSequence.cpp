@@ -32,9 +32,12 @@ void GingoSequence::clear() {
     count_ = 0;
 }
 
+// Returned for out-of-range indexes. Built before main(), so at() never
+// runs a lazy initializer and is safe to call from several threads.
+static const GingoEvent SEQUENCE_FALLBACK;
+
 const GingoEvent& GingoSequence::at(uint8_t index) const {
-    static const GingoEvent fallback;
-    if (index >= count_) return fallback;
+    if (index >= count_) return SEQUENCE_FALLBACK;
     return events_[index];
 }
 
@@ -0,0 +1,444 @@
+// Gingoduino - Music Theory Library for Embedded Systems
+// Implementation of GingoSynth and GingoSequencePlayer.
+//
+// SPDX-License-Identifier: MIT
+
+#include "GingoSynth.h"
+
+#if GINGODUINO_HAS_SYNTH
+
+#if GINGODUINO_SYNTH_ESP_DSP
+#include <dsps_add.h>
+#endif
+
+namespace gingoduino {
+
+// ---------------------------------------------------------------------------
+// Helpers
+// ---------------------------------------------------------------------------
+
+static const float   SYNTH_PI  = 3.14159265358979f;
+static const int32_t LEVEL_ONE = 1L << 30;                   // Q30 full level
+static const uint8_t PHASE_SHIFT = 32 - GINGODUINO_SYNTH_TABLE_BITS;
+
+/// 12-TET frequency of a MIDI note, A4 = 440 Hz.
+static float equalFrequency(uint8_t midiNum) {
+    return 440.0f * powf(2.0f, ((int)midiNum - 69) / 12.0f);
+}
+
+/// Phase increment (2^32 per cycle) for a frequency at a sample rate.
+static uint32_t phaseInc(float freq, uint32_t sampleRate) {
+    const float inc = freq / (float)sampleRate * 4294967296.0f;
+    return inc >= 4294967295.0f ? 0xFFFFFFFFUL : (uint32_t)inc;
+}
+
+/// Frames for a time in seconds (at least 1, so every stage advances).
+static uint32_t stageFrames(float seconds, uint32_t sampleRate) {
+    const float f = seconds * (float)sampleRate;
+    return f < 1.0f ? 1 : (uint32_t)f;
+}
+
+/// Per-frame Q30 step covering distance in frames (never 0 unless
+/// distance is).
+static int32_t stageStep(int32_t distance, uint32_t frames) {
+    int32_t step = distance / (int32_t)(frames > 0x7FFFFFFFUL ? 0x7FFFFFFFUL : frames);
+    if (step == 0 && distance != 0) step = distance > 0 ? 1 : -1;
+    return step;
+}
+
+/// One period of a waveform at x (radians), before normalization.
+static float waveSample(SynthWaveform wave, float x) {
+    if (wave == WAVE_SINE) return sinf(x);
+    float s = 0.0f;
+    for (uint8_t k = 1; k <= GINGODUINO_SYNTH_HARMONICS; k++) {
+        switch (wave) {
+            case WAVE_SAW:
+                s += sinf(k * x) / k * ((k & 1) ? 1.0f : -1.0f);
+                break;
+            case WAVE_SQUARE:
+                if (k & 1) s += sinf(k * x) / k;
+                break;
+            default:   // triangle
+                if (k & 1) s += sinf(k * x) / (float)(k * k) * ((k & 2) ? -1.0f : 1.0f);
+                break;
+        }
+    }
+    return s;
+}
+
+/// Interpolated wavetable oscillator times a Q16.16 gain ramp; returns
+/// the phase after frames. The restrict pointers let compilers vectorize
+/// the loop (with gathers where the target has them).
+static uint32_t oscillator(const int16_t* __restrict table, int16_t* __restrict out,
+                           uint16_t frames, uint32_t phase, uint32_t inc,
+                           int32_t g, int32_t dg) {
+    for (uint16_t i = 0; i < frames; i++) {
+        const uint32_t idx = phase >> PHASE_SHIFT;
+        const int32_t frac = (int32_t)((phase >> (PHASE_SHIFT - 15)) & 0x7FFF);
+        const int32_t a = table[idx];
+        const int32_t s = a + (((table[idx + 1] - a) * frac) >> 15);
+        out[i] = (int16_t)((s * (g >> 16)) >> 15);
+        g += dg;
+        phase += inc;
+    }
+    return phase;
+}
+
+/// mix += add, saturating at 16 bits.
+static void mixSaturate(int16_t* mix, const int16_t* add, uint16_t frames) {
+#if GINGODUINO_SYNTH_ESP_DSP
+    dsps_add_s16(mix, add, mix, frames, 1, 1, 1, 0);
+#else
+    for (uint16_t i = 0; i < frames; i++) {
+        int32_t s = (int32_t)mix[i] + add[i];
+        if (s > 32767)  s = 32767;
+        if (s < -32768) s = -32768;
+        mix[i] = (int16_t)s;
+    }
+#endif
+}
+
+static void putLE16(uint8_t* p, uint16_t v) {
+    p[0] = (uint8_t)v;
+    p[1] = (uint8_t)(v >> 8);
+}
+
+static void putLE32(uint8_t* p, uint32_t v) {
+    p[0] = (uint8_t)v;
+    p[1] = (uint8_t)(v >> 8);
+    p[2] = (uint8_t)(v >> 16);
+    p[3] = (uint8_t)(v >> 24);
+}
+
+// ---------------------------------------------------------------------------
+// GingoSynth
+// ---------------------------------------------------------------------------
+
+GingoSynth::GingoSynth(uint32_t sampleRate)
+    : sampleRate_(sampleRate ? sampleRate : 44100), clock_(0), wave_(WAVE_SINE)
+#if GINGODUINO_HAS_TUNING
+    , tuning_(nullptr)
+#endif
+{
+    env_.attack = 0.005f;
+    env_.decay = 0.1f;
+    env_.sustain = 0.7f;
+    env_.release = 0.2f;
+    setGain(0.25f);
+    setWaveform(WAVE_SINE);
+    reset();
+}
+
+void GingoSynth::setWaveform(SynthWaveform wave) {
+    wave_ = wave;
+    // Normalize to the peak so every shape reaches full scale
+    float peak = 0.0f;
+    for (uint16_t i = 0; i < TABLE_SIZE; i++) {
+        const float s = fabsf(waveSample(wave, 2.0f * SYNTH_PI * (float)i / (float)TABLE_SIZE));
+        if (s > peak) peak = s;
+    }
+    const float scale = peak > 0.0f ? 32767.0f / peak : 0.0f;
+    for (uint16_t i = 0; i < TABLE_SIZE; i++) {
+        const float s = waveSample(wave, 2.0f * SYNTH_PI * (float)i / (float)TABLE_SIZE) * scale;
+        table_[i] = (int16_t)(s < 0.0f ? s - 0.5f : s + 0.5f);
+    }
+    table_[TABLE_SIZE] = table_[0];
+}
+
+void GingoSynth::setEnvelope(const GingoEnvelope& env) {
+    env_ = env;
+    if (env_.sustain < 0.0f) env_.sustain = 0.0f;
+    if (env_.sustain > 1.0f) env_.sustain = 1.0f;
+}
+
+void GingoSynth::setGain(float gain) {
+    if (gain < 0.0f) gain = 0.0f;
+    if (gain > 1.0f) gain = 1.0f;
+    gain_ = gain;
+    gainQ15_ = (int16_t)(gain * 32767.0f + 0.5f);
+}
+
+#if GINGODUINO_HAS_TUNING
+void GingoSynth::setTuning(const GingoTuning* tuning) {
+    tuning_ = tuning;
+    for (uint8_t i = 0; i < VOICES; i++) {
+        if (stage_[i] == STAGE_IDLE) continue;
+        const float freq = tuning_ ? tuning_->frequency(note_[i]) : equalFrequency(note_[i]);
+        if (freq > 0.0f) inc_[i] = phaseInc(freq, sampleRate_);
+    }
+}
+#endif
+
+void GingoSynth::reset() {
+    for (uint8_t i = 0; i < VOICES; i++) {
+        stage_[i] = STAGE_IDLE;
+        level_[i] = 0;
+        step_[i] = 0;
+        note_[i] = 0xFF;
+        age_[i] = 0;
+    }
+}
+
+uint8_t GingoSynth::allocate_(uint8_t midiNum) {
+    // Retrigger: the same note keeps its voice (and phase)
+    for (uint8_t i = 0; i < VOICES; i++) {
+        if (stage_[i] != STAGE_IDLE && note_[i] == midiNum) return i;
+    }
+    for (uint8_t i = 0; i < VOICES; i++) {
+        if (stage_[i] == STAGE_IDLE) return i;
+    }
+    // Steal: quietest releasing voice, else the oldest
+    uint8_t best = 0xFF;
+    for (uint8_t i = 0; i < VOICES; i++) {
+        if (stage_[i] != STAGE_RELEASE) continue;
+        if (best == 0xFF || level_[i] < level_[best]) best = i;
+    }
+    if (best != 0xFF) return best;
+    best = 0;
+    for (uint8_t i = 1; i < VOICES; i++) {
+        if (age_[i] < age_[best]) best = i;
+    }
+    return best;
+}
+
+void GingoSynth::noteOn(uint8_t midiNum, uint8_t velocity) {
+    if (midiNum > 127) return;
+    if (velocity == 0) {
+        noteOff(midiNum);
+        return;
+    }
+#if GINGODUINO_HAS_TUNING
+    const float freq = tuning_ ? tuning_->frequency(midiNum) : equalFrequency(midiNum);
+    if (freq <= 0.0f) return;
+#else
+    const float freq = equalFrequency(midiNum);
+#endif
+    const uint8_t v = allocate_(midiNum);
+    if (note_[v] != midiNum || stage_[v] == STAGE_IDLE) {
+        phase_[v] = 0;
+        level_[v] = 0;
+    }
+    note_[v] = midiNum;
+    inc_[v] = phaseInc(freq, sampleRate_);
+    amp_[v] = (int16_t)((uint32_t)(velocity & 0x7F) * 32767 / 127);
+    sustain_[v] = (int32_t)(env_.sustain * (float)LEVEL_ONE);
+    releaseFrames_[v] = stageFrames(env_.release, sampleRate_);
+    age_[v] = ++clock_;
+    stage_[v] = STAGE_ATTACK;
+    step_[v] = stageStep(LEVEL_ONE - level_[v], stageFrames(env_.attack, sampleRate_));
+    if (step_[v] == 0) step_[v] = 1;
+}
+
+void GingoSynth::release_(uint8_t v) {
+    if (stage_[v] == STAGE_IDLE || stage_[v] == STAGE_RELEASE) return;
+    stage_[v] = STAGE_RELEASE;
+    step_[v] = stageStep(-level_[v], releaseFrames_[v]);
+    if (step_[v] == 0) step_[v] = -1;
+}
+
+void GingoSynth::noteOff(uint8_t midiNum) {
+    for (uint8_t i = 0; i < VOICES; i++) {
+        if (note_[i] == midiNum) release_(i);
+    }
+}
+
+void GingoSynth::allNotesOff() {
+    for (uint8_t i = 0; i < VOICES; i++) release_(i);
+}
+
+uint8_t GingoSynth::activeVoices() const {
+    uint8_t n = 0;
+    for (uint8_t i = 0; i < VOICES; i++) {
+        if (stage_[i] != STAGE_IDLE) n++;
+    }
+    return n;
+}
+
+// Envelope level times velocity times output gain, Q15.
+int16_t GingoSynth::voiceGain_(uint8_t v) const {
+    const int32_t env = level_[v] >> 15;
+    return (int16_t)((((env * amp_[v]) >> 15) * gainQ15_) >> 15);
+}
+
+// Advance one voice's envelope by frames, crossing stage ends on the way.
+void GingoSynth::advance_(uint8_t v, uint16_t frames) {
+    uint32_t left = frames;
+    while (left > 0) {
+        const Stage st = stage_[v];
+        if (st == STAGE_IDLE || st == STAGE_SUSTAIN) return;
+        const int32_t target = (st == STAGE_ATTACK) ? LEVEL_ONE
+                             : (st == STAGE_DECAY)  ? sustain_[v] : 0;
+        const int32_t step = step_[v];
+        const int32_t dist = target - level_[v];
+        uint32_t need = 0;
+        if ((step > 0 && dist > 0) || (step < 0 && dist < 0)) {
+            const uint32_t a = (uint32_t)(dist < 0 ? -dist : dist);
+            const uint32_t b = (uint32_t)(step < 0 ? -step : step);
+            need = (a + b - 1) / b;
+        }
+        if (need > left) {
+            level_[v] += step * (int32_t)left;
+            return;
+        }
+        level_[v] = target;
+        left -= need;
+        if (st == STAGE_ATTACK) {
+            stage_[v] = STAGE_DECAY;
+            step_[v] = stageStep(sustain_[v] - LEVEL_ONE, stageFrames(env_.decay, sampleRate_));
+            if (step_[v] == 0) stage_[v] = STAGE_SUSTAIN;
+        } else if (st == STAGE_DECAY) {
+            stage_[v] = STAGE_SUSTAIN;
+            step_[v] = 0;
+        } else {
+            stage_[v] = STAGE_IDLE;
+            step_[v] = 0;
+            level_[v] = 0;
+        }
+    }
+}
+
+// One voice into out: table lookup with linear interpolation, gain ramped
+// from g0 to g1 across the block. Integer only, no branches.
+void GingoSynth::renderVoice_(uint8_t v, int16_t* out, uint16_t frames, int16_t g0, int16_t g1) {
+    const int32_t dg = (((int32_t)g1 - g0) * 65536) / (int32_t)frames;
+    phase_[v] = oscillator(table_, out, frames, phase_[v], inc_[v], (int32_t)g0 * 65536, dg);
+}
+
+void GingoSynth::render(int16_t* out, uint16_t frames, uint8_t channels) {
+    if (!out || channels == 0) return;
+    // Mixed over the whole block even when fewer frames are rendered: the
+    // constant trip count lets -O2 vectorize it, and the tail is unused
+    alignas(16) int16_t mix[BLOCK];
+    alignas(16) int16_t voice[BLOCK] = {};
+
+    while (frames > 0) {
+        const uint16_t n = frames < BLOCK ? frames : BLOCK;
+        memset(mix, 0, sizeof(mix));
+        for (uint8_t v = 0; v < VOICES; v++) {
+            if (stage_[v] == STAGE_IDLE) continue;
+            const int16_t g0 = voiceGain_(v);
+            advance_(v, n);
+            renderVoice_(v, voice, n, g0, voiceGain_(v));
+            mixSaturate(mix, voice, BLOCK);
+        }
+        if (channels == 1) {
+            memcpy(out, mix, n * sizeof(int16_t));
+            out += n;
+        } else {
+            for (uint16_t i = 0; i < n; i++) {
+                for (uint8_t c = 0; c < channels; c++) out[c] = mix[i];
+                out += channels;
+            }
+        }
+        frames -= n;
+    }
+}
+
+uint8_t GingoSynth::wavHeader(uint8_t* buf, uint8_t maxLen, uint32_t frames, uint8_t channels) const {
+    if (!buf || maxLen < WAV_HEADER_SIZE || channels == 0) return 0;
+    const uint32_t dataBytes = frames * channels * 2;
+    memcpy(buf, "RIFF", 4);
+    putLE32(buf + 4, 36 + dataBytes);
+    memcpy(buf + 8, "WAVEfmt ", 8);
+    putLE32(buf + 16, 16);                              // fmt chunk size
+    putLE16(buf + 20, 1);                               // PCM
+    putLE16(buf + 22, channels);
+    putLE32(buf + 24, sampleRate_);
+    putLE32(buf + 28, sampleRate_ * channels * 2);      // byte rate
+    putLE16(buf + 32, (uint16_t)(channels * 2));        // block align
+    putLE16(buf + 34, 16);                              // bits per sample
+    memcpy(buf + 36, "data", 4);
+    putLE32(buf + 40, dataBytes);
+    return WAV_HEADER_SIZE;
+}
+
+// ---------------------------------------------------------------------------
+// GingoSequencePlayer
+// ---------------------------------------------------------------------------
+
+#if GINGODUINO_HAS_SEQUENCE
+
+GingoSequencePlayer::GingoSequencePlayer(const GingoSequence& seq, GingoSynth& synth)
+    : seq_(seq), synth_(synth)
+{
+    rewind();
+}
+
+uint32_t GingoSequencePlayer::eventFrames_(uint8_t index) const {
+    const float seconds = seq_.tempo().seconds(seq_.at(index).duration());
+    return (uint32_t)(seconds * (float)synth_.sampleRate() + 0.5f);
+}
+
+uint32_t GingoSequencePlayer::tailFrames_() const {
+    return (uint32_t)(synth_.envelope().release * (float)synth_.sampleRate()) + GingoSynth::BLOCK;
+}
+
+uint32_t GingoSequencePlayer::totalFrames() const {
+    uint32_t total = 0;
+    for (uint8_t i = 0; i < seq_.size(); i++) total += eventFrames_(i);
+    return total + tailFrames_();
+}
+
+void GingoSequencePlayer::rewind() {
+    synth_.reset();
+    pos_ = 0;
+    eventEnd_ = 0;
+    tailEnd_ = 0;
+    next_ = 0;
+    heldCount_ = 0;
+}
+
+bool GingoSequencePlayer::done() const {
+    return next_ >= seq_.size() && pos_ >= eventEnd_ && pos_ >= tailEnd_ && tailEnd_ > 0;
+}
+
+void GingoSequencePlayer::releaseHeld_() {
+    for (uint8_t i = 0; i < heldCount_; i++) synth_.noteOff(held_[i]);
+    heldCount_ = 0;
+}
+
+void GingoSequencePlayer::startEvent_(uint8_t index) {
+    const GingoEvent& e = seq_.at(index);
+    eventEnd_ = pos_ + eventFrames_(index);
+    if (e.type() == EVENT_NOTE) {
+        held_[0] = e.midiNumber();
+        heldCount_ = 1;
+    } else if (e.type() == EVENT_CHORD) {
+        GingoInterval iv[GINGODUINO_MAX_CHORD_NOTES];
+        const uint8_t n = e.chord().intervals(iv, GINGODUINO_MAX_CHORD_NOTES);
+        const uint8_t root = e.midiNumber();
+        for (uint8_t i = 0; i < n; i++) {
+            const uint16_t m = (uint16_t)root + iv[i].semitones();
+            if (m <= 127) held_[heldCount_++] = (uint8_t)m;
+        }
+    }
+    for (uint8_t i = 0; i < heldCount_; i++) synth_.noteOn(held_[i], e.velocity());
+}
+
+uint16_t GingoSequencePlayer::render(int16_t* out, uint16_t frames, uint8_t channels) {
+    uint16_t written = 0;
+    while (written < frames) {
+        if (pos_ >= eventEnd_) {
+            releaseHeld_();
+            if (next_ < seq_.size()) {
+                startEvent_(next_++);
+                continue;
+            }
+            if (tailEnd_ == 0) tailEnd_ = pos_ + tailFrames_();
+            if (pos_ >= tailEnd_) break;
+        }
+        const uint32_t until = (pos_ < eventEnd_) ? eventEnd_ : tailEnd_;
+        uint32_t n = until - pos_;
+        if (n > (uint32_t)(frames - written)) n = frames - written;
+        synth_.render(out + (uint32_t)written * channels, (uint16_t)n, channels);
+        written = (uint16_t)(written + n);
+        pos_ += n;
+    }
+    return written;
+}
+
+#endif // GINGODUINO_HAS_SEQUENCE
+
+} // namespace gingoduino
+
+#endif // GINGODUINO_HAS_SYNTH
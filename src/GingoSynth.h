@@ -0,0 +1,223 @@
+// Gingoduino - Music Theory Library for Embedded Systems
+// GingoSynth: block-based polyphonic synth core and sequence player.
+//
+// Platform neutral: the synth fills caller buffers with 16-bit PCM and
+// knows nothing about the output. On the host the blocks go to a WAV file
+// (wavHeader() writes the RIFF header); on ESP32 they go to an I2S channel
+// (see examples/SequenceSynth).
+//
+//   GingoSynth synth(44100);
+//   synth.setWaveform(WAVE_TRIANGLE);
+//   GingoSequencePlayer player(seq, synth);
+//   int16_t buf[256];
+//   uint16_t n;
+//   while ((n = player.render(buf, 128, 2)) > 0) sink(buf, n * 2);
+//
+// SPDX-License-Identifier: MIT
+
+#ifndef GINGO_SYNTH_H
+#define GINGO_SYNTH_H
+
+#include "gingoduino_config.h"
+
+#if GINGODUINO_HAS_SYNTH
+
+#include "gingoduino_types.h"
+
+#if GINGODUINO_HAS_SEQUENCE
+#include "GingoSequence.h"
+#endif
+
+#if GINGODUINO_HAS_TUNING
+#include "GingoTuning.h"
+#endif
+
+namespace gingoduino {
+
+/// Oscillator wavetable shapes. Saw, square and triangle are summed from
+/// GINGODUINO_SYNTH_HARMONICS partials, so they are band-limited up to
+/// that partial.
+enum SynthWaveform : uint8_t {
+    WAVE_SINE     = 0,
+    WAVE_TRIANGLE = 1,
+    WAVE_SAW      = 2,
+    WAVE_SQUARE   = 3
+};
+
+/// Linear ADSR envelope. Times in seconds, sustain level 0..1.
+struct GingoEnvelope {
+    float attack;
+    float decay;
+    float sustain;
+    float release;
+};
+
+/// Polyphonic wavetable synth with one ADSR per voice.
+///
+/// Voices are allocated per note: a note already sounding is retriggered,
+/// otherwise a free voice is used, otherwise the quietest releasing voice,
+/// otherwise the oldest voice is stolen.
+///
+/// The engine is fixed point: Q15 wavetable and gains, 32-bit phase
+/// accumulators and Q30 envelope levels. Voice state is kept as one array
+/// per field, and audio is computed in blocks of GINGODUINO_SYNTH_BLOCK
+/// frames, one voice at a time: the envelope advances once per block and
+/// is ramped across it, so the per-frame loops are plain integer array
+/// code that compilers vectorize. Voices are summed with saturating 16-bit
+/// adds (esp-dsp dsps_add_s16 on ESP32-S3, see GINGODUINO_SYNTH_ESP_DSP).
+///
+/// All state is per instance (about 1 KB with the defaults); use one
+/// synth per task.
+///
+/// Examples:
+///   GingoSynth synth(44100);
+///   synth.noteOn(60, 100);
+///   int16_t pcm[64];
+///   synth.render(pcm, 64);            // mono
+///   synth.noteOff(60);
+class GingoSynth {
+public:
+    static const uint8_t  VOICES     = GINGODUINO_SYNTH_VOICES;
+    static const uint16_t TABLE_SIZE = 1u << GINGODUINO_SYNTH_TABLE_BITS;
+    static const uint8_t  BLOCK      = GINGODUINO_SYNTH_BLOCK;
+
+    /// Size of the header written by wavHeader().
+    static const uint8_t  WAV_HEADER_SIZE = 44;
+
+    /// Sine wave, envelope { 5 ms, 100 ms, 0.7, 200 ms }, gain 0.25.
+    explicit GingoSynth(uint32_t sampleRate = 44100);
+
+    uint32_t sampleRate() const { return sampleRate_; }
+
+    /// Select the oscillator shape (rebuilds the wavetable).
+    void setWaveform(SynthWaveform wave);
+    SynthWaveform waveform() const { return wave_; }
+
+    /// Envelope for notes started from now on.
+    void setEnvelope(const GingoEnvelope& env);
+    const GingoEnvelope& envelope() const { return env_; }
+
+    /// Per-voice output gain, 0..1 (1.0 = one full-scale voice). The mix
+    /// saturates at full scale.
+    void setGain(float gain);
+    float gain() const { return gain_; }
+
+#if GINGODUINO_HAS_TUNING
+    /// Tuning table for note frequencies (nullptr = 12-TET, A4 = 440 Hz).
+    /// The table is not copied and must outlive the synth; sounding voices
+    /// are retuned. Notes the table leaves unmapped are ignored.
+    void setTuning(const GingoTuning* tuning);
+    const GingoTuning* tuning() const { return tuning_; }
+#endif
+
+    /// Start a note (velocity 0 releases it, like MIDI).
+    void noteOn(uint8_t midiNum, uint8_t velocity = 100);
+
+    /// Release every voice playing midiNum.
+    void noteOff(uint8_t midiNum);
+
+    /// Release every voice.
+    void allNotesOff();
+
+    /// Silence every voice immediately.
+    void reset();
+
+    /// Voices not yet silent (attack through end of release).
+    uint8_t activeVoices() const;
+
+    /// Render frames of 16-bit PCM into out. With channels > 1 each frame
+    /// is repeated on every channel (interleaved), so out must hold
+    /// frames * channels samples.
+    void render(int16_t* out, uint16_t frames, uint8_t channels = 1);
+
+    /// Write a 44-byte PCM WAV header for frames of 16-bit audio at this
+    /// sample rate. Returns WAV_HEADER_SIZE, or 0 if maxLen is too small.
+    uint8_t wavHeader(uint8_t* buf, uint8_t maxLen, uint32_t frames, uint8_t channels = 1) const;
+
+private:
+    enum Stage : uint8_t { STAGE_IDLE, STAGE_ATTACK, STAGE_DECAY, STAGE_SUSTAIN, STAGE_RELEASE };
+
+    // Voice state, one array per field
+    uint32_t phase_[VOICES];          ///< wavetable position, 32-bit fixed point
+    uint32_t inc_[VOICES];            ///< phase increment per frame
+    int32_t  level_[VOICES];          ///< envelope level, Q30
+    int32_t  step_[VOICES];           ///< level change per frame in this stage, Q30
+    int32_t  sustain_[VOICES];        ///< sustain level for this note, Q30
+    uint32_t releaseFrames_[VOICES];  ///< release length for this note
+    uint32_t age_[VOICES];            ///< noteOn stamp for stealing
+    int16_t  amp_[VOICES];            ///< velocity scale, Q15
+    uint8_t  note_[VOICES];
+    Stage    stage_[VOICES];
+
+    int16_t       table_[TABLE_SIZE + 1];   // Q15, + guard sample for interpolation
+    GingoEnvelope env_;
+    float         gain_;
+    int16_t       gainQ15_;
+    uint32_t      sampleRate_;
+    uint32_t      clock_;
+    SynthWaveform wave_;
+#if GINGODUINO_HAS_TUNING
+    const GingoTuning* tuning_;
+#endif
+
+    uint8_t allocate_(uint8_t midiNum);
+    void    release_(uint8_t v);
+    int16_t voiceGain_(uint8_t v) const;
+    void    advance_(uint8_t v, uint16_t frames);
+    void    renderVoice_(uint8_t v, int16_t* out, uint16_t frames, int16_t g0, int16_t g1);
+};
+
+#if GINGODUINO_HAS_SEQUENCE
+/// Plays a GingoSequence into a GingoSynth, block by block.
+///
+/// Event times come from the sequence tempo (GingoTempo::seconds() per
+/// event, rounded to whole frames). Each note or chord sounds for its full
+/// duration and then releases; chords are voiced upward from the root at
+/// the event octave. After the last event the release tail is rendered
+/// until every voice is silent.
+///
+/// Examples:
+///   GingoSequencePlayer player(seq, synth);
+///   uint32_t frames = player.totalFrames();   // for the WAV header
+///   while ((n = player.render(buf, 256)) > 0) fwrite(buf, 2, n, f);
+class GingoSequencePlayer {
+public:
+    GingoSequencePlayer(const GingoSequence& seq, GingoSynth& synth);
+
+    /// Render up to frames frames; returns the number written (less than
+    /// frames only at the end, 0 once done()).
+    uint16_t render(int16_t* out, uint16_t frames, uint8_t channels = 1);
+
+    /// Every event played and every voice silent.
+    bool done() const;
+
+    /// Frames render() produces from the start, release tail included.
+    uint32_t totalFrames() const;
+
+    /// Frames rendered so far.
+    uint32_t position() const { return pos_; }
+
+    /// Back to the first event (the synth is reset).
+    void rewind();
+
+private:
+    const GingoSequence& seq_;
+    GingoSynth&          synth_;
+    uint32_t pos_;
+    uint32_t eventEnd_;      ///< frame where the current event ends
+    uint32_t tailEnd_;       ///< frame where the release tail is cut
+    uint8_t  next_;          ///< next event index
+    uint8_t  held_[GINGODUINO_MAX_CHORD_NOTES];
+    uint8_t  heldCount_;
+
+    uint32_t eventFrames_(uint8_t index) const;
+    uint32_t tailFrames_() const;
+    void     startEvent_(uint8_t index);
+    void     releaseHeld_();
+};
+#endif // GINGODUINO_HAS_SEQUENCE
+
+} // namespace gingoduino
+
+#endif // GINGODUINO_HAS_SYNTH
+#endif // GINGO_SYNTH_H
@@ -65,9 +65,7 @@ void GingoTempo::bpmToMarking(float bpm, char* buf, uint8_t maxLen) {
 
 float GingoTempo::markingToBpm(const char* marking) {
     for (uint8_t i = 0; i < data::TEMPO_MARKINGS_SIZE; i++) {
-        char buf[14];
-        data::readPgmStr(buf, data::TEMPO_MARKINGS[i].name, sizeof(buf));
-        if (strcmp(marking, buf) == 0) {
+        if (data::pgmStrcmp(marking, data::TEMPO_MARKINGS[i].name) == 0) {
             return (float)pgm_read_byte(&data::TEMPO_MARKINGS[i].bpm_mid);
         }
     }
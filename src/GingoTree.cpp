@@ -31,12 +31,11 @@ GingoTree::GingoTree(const char* tonic, ScaleType type, uint8_t traditionId)
 // ---------------------------------------------------------------------------
 
 uint8_t GingoTree::findBranch(const char* name) {
+    GINGODUINO_PROBE(PROBE_TREE_FIND_BRANCH);
     if (!name) return 0xFF;
     for (uint8_t i = 0; i < PROG_BRANCH_COUNT; i++) {
         const char* ptr = (const char*)pgm_read_ptr(&data::PROG_BRANCH_NAMES[i]);
-        char buf[24];
-        data::readPgmStr(buf, ptr, sizeof(buf));
-        if (strcmp(name, buf) == 0) return i;
+        if (data::pgmStrcmp(name, ptr) == 0) return i;
     }
     return 0xFF;
 }
@@ -46,6 +45,7 @@ uint8_t GingoTree::findBranch(const char* name) {
 // ---------------------------------------------------------------------------
 
 bool GingoTree::hasEdge(uint8_t originId, uint8_t targetId) const {
+    GINGODUINO_PROBE(PROBE_TREE_HAS_EDGE);
     // Read edge table pointer and count from PROGMEM
     const data::ProgEdge* edges;
     uint8_t edgeCount;
@@ -270,6 +270,226 @@ bool GingoTree::resolve(const char* branch, char* chordName, uint8_t maxLen) con
     return false;
 }
 
+// ---------------------------------------------------------------------------
+// Melody harmonization
+// ---------------------------------------------------------------------------
+
+#if GINGODUINO_HAS_SEQUENCE
+
+// Costs, in units where a step whose whole melody misses the chord costs
+// HM_W_MISS.
+static const uint16_t HM_W_MISS  = 16;   // melody outside the chord, full step
+static const uint16_t HM_W_STAY  = 1;    // holding the chord
+static const uint16_t HM_W_JUMP  = 12;   // a move that is not a tree edge
+static const uint16_t HM_W_COLOR = 1;    // chromatic branch (no scale degree)
+static const uint16_t HM_W_TONIC = 4;    // starting or ending away from the tonic
+
+// Duration resolution: divisible by 2, 3 and 5 so dots and tuplets stay exact
+static const uint32_t HM_TICKS_WHOLE = 1920;
+
+static uint32_t harmonyTicks(const GingoDuration& d) {
+    if (d.numerator() <= 0 || d.denominator() <= 0) return 0;
+    return (uint32_t)d.numerator() * HM_TICKS_WHOLE / (uint32_t)d.denominator();
+}
+
+// Walks a monophonic (or block-chord) timeline one step at a time
+struct HarmonyCursor {
+    const GingoSequence* seq;
+    uint32_t stepTicks;
+    uint8_t  event;      // first event not yet finished
+    uint32_t start;      // its start tick
+};
+
+static void harmonyAddPcs(const GingoEvent& e, uint16_t amount, uint16_t* weights) {
+    if (e.type() == EVENT_NOTE) {
+        weights[e.note().semitone()] += amount;
+    } else if (e.type() == EVENT_CHORD) {
+        GingoNote notes[GINGODUINO_MAX_CHORD_NOTES];
+        const uint8_t n = e.chord().notes(notes, GINGODUINO_MAX_CHORD_NOTES);
+        for (uint8_t i = 0; i < n; i++) weights[notes[i].semitone()] += amount;
+    }
+}
+
+static void harmonySequenceWeights(void* src, uint16_t step, uint16_t* weights) {
+    HarmonyCursor& c = *(HarmonyCursor*)src;
+    const uint32_t from = (uint32_t)step * c.stepTicks;
+    const uint32_t to = from + c.stepTicks;
+    // Scale to 8 units per step so the sums fit 16 bits
+    const uint32_t unit = c.stepTicks / 8 ? c.stepTicks / 8 : 1;
+    while (c.event < c.seq->size() && c.start < to) {
+        const GingoEvent& e = c.seq->at(c.event);
+        const uint32_t end = c.start + harmonyTicks(e.duration());
+        if (end > from) {
+            const uint32_t a = c.start > from ? c.start : from;
+            const uint32_t b = end < to ? end : to;
+            uint32_t amount = (b - a + unit / 2) / unit;
+            if (c.start <= from) amount += 4;     // sounding on the step's first tick
+            harmonyAddPcs(e, (uint16_t)(amount ? amount : 1), weights);
+        }
+        if (end > to) break;
+        c.start = end;
+        c.event++;
+    }
+}
+
+static void harmonyMaskWeights(void* src, uint16_t step, uint16_t* weights) {
+    const uint16_t mask = ((const uint16_t*)src)[step];
+    for (uint8_t pc = 0; pc < 12; pc++) weights[pc] = (mask >> pc) & 1;
+}
+
+uint16_t GingoTree::harmonize(const GingoSequence& melody, const GingoDuration& step,
+                              HarmonyStep* output, uint16_t maxResults,
+                              HarmonyCostFn cost, void* ctx) const {
+    const uint32_t stepTicks = harmonyTicks(step);
+    if (stepTicks == 0) return 0;
+    uint32_t total = 0;
+    for (uint8_t i = 0; i < melody.size(); i++) total += harmonyTicks(melody.at(i).duration());
+    const uint32_t steps = (total + stepTicks - 1) / stepTicks;
+    if (steps == 0) return 0;
+
+    HarmonyCursor cursor = { &melody, stepTicks, 0, 0 };
+    return harmonize_(harmonySequenceWeights, &cursor,
+                      (uint16_t)(steps < maxResults ? steps : maxResults), output, cost, ctx);
+}
+
+uint16_t GingoTree::harmonize(const uint16_t* masks, uint16_t count,
+                              HarmonyStep* output, uint16_t maxResults,
+                              HarmonyCostFn cost, void* ctx) const {
+    if (!masks) return 0;
+    return harmonize_(harmonyMaskWeights, (void*)masks,
+                      count < maxResults ? count : maxResults, output, cost, ctx);
+}
+
+uint16_t GingoTree::harmonize_(StepWeights fill, void* src, uint16_t count,
+                               HarmonyStep* output, HarmonyCostFn cost, void* ctx) const {
+    const uint8_t B = GINGODUINO_HARMONY_BEAM;
+    if (!output || count == 0) return 0;
+    if (count > GINGODUINO_MAX_HARMONY_STEPS) count = GINGODUINO_MAX_HARMONY_STEPS;
+
+    // States: every branch of this tree's edge table that resolves to a chord
+    const data::ProgEdgeTable* tablePtr = &data::PROG_EDGE_TABLES[traditionId_][ctx_];
+    const data::ProgEdge* edges = (const data::ProgEdge*)pgm_read_ptr(&tablePtr->edges);
+    const uint8_t edgeCount = pgm_read_byte(&tablePtr->count);
+
+    uint64_t adj[PROG_BRANCH_COUNT];     // PROG_BRANCH_COUNT <= 64
+    uint64_t present = 0;
+    memset(adj, 0, sizeof(adj));
+    for (uint8_t i = 0; i < edgeCount; i++) {
+        const uint8_t o = pgm_read_byte(&edges[i].origin);
+        const uint8_t t = pgm_read_byte(&edges[i].target);
+        if (o >= PROG_BRANCH_COUNT || t >= PROG_BRANCH_COUNT) continue;
+        adj[o] |= (uint64_t)1 << t;
+        present |= ((uint64_t)1 << o) | ((uint64_t)1 << t);
+    }
+
+    uint8_t  stId[PROG_BRANCH_COUNT];
+    uint16_t stMask[PROG_BRANCH_COUNT];
+    uint16_t stBase[PROG_BRANCH_COUNT];  // colour, plus the tonic cost at the ends
+    uint8_t  states = 0;
+    const uint8_t tonic = findBranch(ctx_ == PROG_CTX_MINOR ? "Im" : "I");
+    for (uint8_t id = 0; id < PROG_BRANCH_COUNT; id++) {
+        if (!(present & ((uint64_t)1 << id))) continue;
+        char name[16], chordName[12];
+        data::readPgmStr(name, (const char*)pgm_read_ptr(&data::PROG_BRANCH_NAMES[id]), sizeof(name));
+        if (!resolve(name, chordName, sizeof(chordName))) continue;
+        GingoNote notes[GINGODUINO_MAX_CHORD_NOTES];
+        const uint8_t n = GingoChord(chordName).notes(notes, GINGODUINO_MAX_CHORD_NOTES);
+        if (n == 0) continue;
+        uint16_t mask = 0;
+        for (uint8_t k = 0; k < n; k++) mask |= (uint16_t)(1u << notes[k].semitone());
+        stId[states] = id;
+        stMask[states] = mask;
+        stBase[states] = pgm_read_byte(&data::BRANCH_DEGREE[id].degree) == 0xFF ? HM_W_COLOR : 0;
+        states++;
+    }
+    if (states == 0) return 0;
+    const uint8_t K = states < B ? states : B;
+
+    // Beam layers: state index and back-pointer per kept path
+    uint8_t  beamState[GINGODUINO_MAX_HARMONY_STEPS][B];
+    uint8_t  back[GINGODUINO_MAX_HARMONY_STEPS][B];
+    uint16_t heard[GINGODUINO_MAX_HARMONY_STEPS];   // pitch classes per step
+    uint32_t layerCost[2][B];
+    uint8_t  cur = 0;
+
+    for (uint16_t i = 0; i < count; i++) {
+        uint16_t w[12] = { 0 };
+        fill(src, i, w);
+        uint32_t total = 0;
+        uint16_t pcs = 0;
+        for (uint8_t pc = 0; pc < 12; pc++) {
+            total += w[pc];
+            if (w[pc]) pcs |= (uint16_t)(1u << pc);
+        }
+        heard[i] = pcs;
+
+        const uint8_t prev = cur;
+        cur = (uint8_t)(i & 1);
+        uint8_t kept = 0;
+        for (uint8_t s = 0; s < states; s++) {
+            // Emission: weighted share of the melody outside the chord
+            uint32_t miss = 0;
+            const uint16_t out = pcs & (uint16_t)~stMask[s];
+            for (uint8_t pc = 0; out && pc < 12; pc++) {
+                if (out & (1u << pc)) miss += w[pc];
+            }
+            uint32_t c = stBase[s] + (total ? (miss * HM_W_MISS + total / 2) / total : 0);
+
+            // Transition: cheapest kept path into this chord
+            uint8_t arg = 0;
+            if (i == 0) {
+                if (stId[s] != tonic) c += HM_W_TONIC;
+            } else {
+                uint32_t best = 0xFFFFFFFFUL;
+                for (uint8_t p = 0; p < K; p++) {
+                    const uint8_t from = stId[beamState[i - 1][p]];
+                    uint32_t t;
+                    if (cost) t = cost(from, stId[s], ctx);
+                    else if (from == stId[s]) t = HM_W_STAY;
+                    else t = (adj[from] & ((uint64_t)1 << stId[s])) ? 0 : HM_W_JUMP;
+                    t += layerCost[prev][p];
+                    if (t < best) { best = t; arg = p; }
+                }
+                c += best;
+            }
+            if (i + 1 == count && stId[s] != tonic) c += HM_W_TONIC;
+
+            // Keep the K cheapest, in order (ties keep the earlier state)
+            uint8_t at = kept;
+            while (at > 0 && c < layerCost[cur][at - 1]) at--;
+            if (at >= K) continue;
+            const uint8_t last = kept < K ? kept : (uint8_t)(K - 1);
+            for (uint8_t k = last; k > at; k--) {
+                layerCost[cur][k] = layerCost[cur][k - 1];
+                beamState[i][k] = beamState[i][k - 1];
+                back[i][k] = back[i][k - 1];
+            }
+            layerCost[cur][at] = c;
+            beamState[i][at] = s;
+            back[i][at] = arg;
+            if (kept < K) kept++;
+        }
+    }
+
+    // The cheapest path is first in the last layer; trace it back
+    uint8_t pick = 0;
+    for (uint16_t i = count; i-- > 0;) {
+        const uint8_t s = beamState[i][pick];
+        HarmonyStep& h = output[i];
+        h.branchId = stId[s];
+        data::readPgmStr(h.branch, (const char*)pgm_read_ptr(&data::PROG_BRANCH_NAMES[stId[s]]),
+                         sizeof(h.branch));
+        if (!resolve(h.branch, h.chord, sizeof(h.chord))) h.chord[0] = '\0';
+        uint16_t out = heard[i] & (uint16_t)~stMask[s];
+        h.misses = 0;
+        for (; out; out &= (uint16_t)(out - 1)) h.misses++;
+        pick = back[i][pick];
+    }
+    return count;
+}
+
+#endif // GINGODUINO_HAS_SEQUENCE
+
 const char* GingoTree::traditionName(char* buf, uint8_t maxLen) const {
     const char* ptr = (const char*)pgm_read_ptr(&data::PROG_TRADITION_NAMES[traditionId_]);
     data::readPgmStr(buf, ptr, maxLen);
@@ -14,8 +14,27 @@
 #include "GingoNote.h"
 #include "GingoField.h"
 
+#if GINGODUINO_HAS_SEQUENCE
+  #include "GingoSequence.h"
+#endif
+
 namespace gingoduino {
 
+#if GINGODUINO_HAS_SEQUENCE
+/// One step of GingoTree::harmonize(): the chosen branch and its chord.
+struct HarmonyStep {
+    char    branch[16];   // branch name, e.g. "V7 / V"
+    char    chord[12];    // the chord it resolves to in the tree's key, e.g. "D7"
+    uint8_t branchId;     // findBranch() id
+    uint8_t misses;       // melody pitch classes of the step outside the chord
+};
+
+/// Transition cost for harmonize(), replacing the tree's own: cost of
+/// going from one branch id to another (the same id = holding the chord).
+/// Lower is better; n-gram weights from a corpus fit here.
+typedef uint16_t (*HarmonyCostFn)(uint8_t fromBranch, uint8_t toBranch, void* ctx);
+#endif
+
 /// Represents a directed harmonic graph (tree) for a specific tradition
 /// and scale context (major or minor).
 ///
@@ -26,6 +45,7 @@ namespace gingoduino {
 ///   GingoTree t("C", SCALE_MAJOR, 0);  // harmonic_tree, C major
 ///   t.isValid("I", "V7");              // true
 ///   t.isValid("I", "IVm");             // false
+///   t.harmonize(melody, GingoDuration("half"), steps, 32);
 class GingoTree {
 public:
     /// Construct a tree for a tonic, scale type, and tradition.
@@ -63,6 +83,36 @@ public:
     /// Find the branch ID for a branch name string. Returns 0xFF if not found.
     static uint8_t findBranch(const char* name);
 
+#if GINGODUINO_HAS_SEQUENCE
+    /// Suggest one chord per step of a melody.
+    ///
+    /// Viterbi over the branches of this tree: a chord costs the share of
+    /// the step's melody (by duration, the note on the step's first tick
+    /// counting extra) that falls outside it; moving along a tree edge is
+    /// free, holding a chord is cheap and any other move is expensive, so
+    /// the result follows the tree wherever the melody allows. The best
+    /// GINGODUINO_HARMONY_BEAM paths are kept per step, with their
+    /// back-pointers on the stack (2 x beam bytes per step), so at most
+    /// GINGODUINO_MAX_HARMONY_STEPS steps are harmonized.
+    ///
+    /// @param melody      note events (chord events count all their notes)
+    /// @param step        harmonic rhythm: GingoDuration("quarter") for a
+    ///                    chord per beat, GingoDuration(4, 4) per 4/4 bar
+    /// @param output      one entry per step
+    /// @param maxResults  capacity of output
+    /// @param cost        optional transition cost replacing the tree's
+    /// @return number of steps written
+    uint16_t harmonize(const GingoSequence& melody, const GingoDuration& step,
+                       HarmonyStep* output, uint16_t maxResults,
+                       HarmonyCostFn cost = nullptr, void* ctx = nullptr) const;
+
+    /// Same, from one pitch-class mask per step (bit p = pitch class p
+    /// sounds, all equally weighted; 0 = rest).
+    uint16_t harmonize(const uint16_t* masks, uint16_t count,
+                       HarmonyStep* output, uint16_t maxResults,
+                       HarmonyCostFn cost = nullptr, void* ctx = nullptr) const;
+#endif
+
 private:
     GingoField field_;
     uint8_t    traditionId_;
@@ -70,6 +120,14 @@ private:
 
     /// Check if edge (origin_id, target_id) exists in the edge table.
     bool hasEdge(uint8_t originId, uint8_t targetId) const;
+
+#if GINGODUINO_HAS_SEQUENCE
+    /// Fills the 12 pitch-class weights of each step, in step order.
+    typedef void (*StepWeights)(void* src, uint16_t step, uint16_t* weights);
+
+    uint16_t harmonize_(StepWeights fill, void* src, uint16_t count,
+                        HarmonyStep* output, HarmonyCostFn cost, void* ctx) const;
+#endif
 };
 
 } // namespace gingoduino
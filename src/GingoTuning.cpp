@@ -0,0 +1,282 @@
+// Gingoduino - Music Theory Library for Embedded Systems
+// Implementation of GingoTuning.
+//
+// SPDX-License-Identifier: MIT
+
+#include "GingoTuning.h"
+
+#if GINGODUINO_HAS_TUNING
+
+#include <stdlib.h>
+
+namespace gingoduino {
+
+// ---------------------------------------------------------------------------
+// Presets: cents of steps 1-11 above the tonic (the period is 1200)
+// ---------------------------------------------------------------------------
+
+static const float TUNING_PRESET_CENTS[6][11] PROGMEM = {
+    // 12-TET
+    { 100.0f, 200.0f, 300.0f, 400.0f, 500.0f, 600.0f, 700.0f, 800.0f, 900.0f, 1000.0f, 1100.0f },
+    // 5-limit just: 16/15 9/8 6/5 5/4 4/3 45/32 3/2 8/5 5/3 9/5 15/8
+    { 111.731f, 203.910f, 315.641f, 386.314f, 498.045f, 590.224f, 701.955f, 813.686f,
+      884.359f, 1017.596f, 1088.269f },
+    // Pythagorean: 256/243 9/8 32/27 81/64 4/3 729/512 3/2 128/81 27/16 16/9 243/128
+    { 90.225f, 203.910f, 294.135f, 407.820f, 498.045f, 611.730f, 701.955f, 792.180f,
+      905.865f, 996.090f, 1109.775f },
+    // Quarter-comma meantone, Eb to G#
+    { 76.049f, 193.157f, 310.265f, 386.314f, 503.422f, 579.471f, 696.578f, 772.627f,
+      889.735f, 1006.843f, 1082.892f },
+    // Werckmeister III
+    { 90.225f, 192.180f, 294.135f, 390.225f, 498.045f, 588.270f, 696.090f, 792.180f,
+      888.270f, 996.090f, 1092.180f },
+    // Maqam Rast: 3rd and 7th steps 50 cents flat
+    { 100.0f, 200.0f, 300.0f, 350.0f, 500.0f, 600.0f, 700.0f, 800.0f, 900.0f, 1000.0f, 1050.0f },
+};
+
+static const char TN_EQUAL[]        PROGMEM = "12-TET";
+static const char TN_JUST[]         PROGMEM = "5-limit just";
+static const char TN_PYTHAGOREAN[]  PROGMEM = "Pythagorean";
+static const char TN_MEANTONE[]     PROGMEM = "1/4-comma meantone";
+static const char TN_WERCKMEISTER[] PROGMEM = "Werckmeister III";
+static const char TN_RAST[]         PROGMEM = "Maqam Rast";
+
+static const char* const TUNING_PRESET_NAMES[6] PROGMEM = {
+    TN_EQUAL, TN_JUST, TN_PYTHAGOREAN, TN_MEANTONE, TN_WERCKMEISTER, TN_RAST
+};
+
+// ---------------------------------------------------------------------------
+// Helpers
+// ---------------------------------------------------------------------------
+
+static int16_t floorDiv(int16_t a, int16_t b) {
+    int16_t q = a / b;
+    return (int16_t)((a % b != 0 && (a < 0) != (b < 0)) ? q - 1 : q);
+}
+
+/// Cents of a scale degree of any size: whole periods plus the step.
+static float degreeCents(const float* cents, uint8_t count, int16_t degree) {
+    const int16_t periods = floorDiv(degree, count);
+    const int16_t step = (int16_t)(degree - periods * count);
+    return periods * cents[count - 1] + (step ? cents[step - 1] : 0.0f);
+}
+
+static bool isBlank(const char* s) {
+    while (*s == ' ' || *s == '\t') s++;
+    return *s == '\0';
+}
+
+/// Next line of Scala text that is not a comment, without its line end.
+/// Lines longer than the buffer are cut. False at the end of the text.
+static bool scalaLine(const char*& p, char* buf, uint8_t size) {
+    while (*p) {
+        const char* start = p;
+        while (*p && *p != '\n') p++;
+        const char* end = p;
+        if (*p) p++;
+        if (*start == '!') continue;
+        uint8_t n = 0;
+        for (const char* c = start; c < end && n + 1 < size; c++) {
+            if (*c != '\r') buf[n++] = *c;
+        }
+        buf[n] = '\0';
+        return true;
+    }
+    return false;
+}
+
+/// Next non-blank, non-comment line.
+static bool scalaValueLine(const char*& p, char* buf, uint8_t size) {
+    while (scalaLine(p, buf, size)) {
+        if (!isBlank(buf)) return true;
+    }
+    return false;
+}
+
+/// A .scl pitch: cents if it has a dot, otherwise a ratio "n/d" or "n".
+static bool scalaPitch(const char* s, float& cents) {
+    while (*s == ' ' || *s == '\t') s++;
+    bool dot = false;
+    for (const char* t = s; *t && *t != ' ' && *t != '\t'; t++) {
+        if (*t == '.') dot = true;
+    }
+    char* end;
+    if (dot) {
+        cents = (float)strtod(s, &end);
+        return end != s;
+    }
+    if (*s < '0' || *s > '9') return false;
+    const unsigned long num = strtoul(s, &end, 10);
+    unsigned long den = 1;
+    if (*end == '/') {
+        const char* d = end + 1;
+        if (*d < '0' || *d > '9') return false;
+        den = strtoul(d, &end, 10);
+    }
+    if (num == 0 || den == 0) return false;
+    cents = (float)(1200.0 * log((double)num / (double)den) / log(2.0));
+    return true;
+}
+
+/// Fractional MIDI pitch of a frequency (A4 = 440 Hz is 69).
+static double hzToPitch(float hz) {
+    return 69.0 + 12.0 * log((double)hz / 440.0) / log(2.0);
+}
+
+/// A .kbm integer line.
+static bool scalaInt(const char* s, long lo, long hi, long& value) {
+    char* end;
+    value = strtol(s, &end, 10);
+    return end != s && value >= lo && value <= hi;
+}
+
+// ---------------------------------------------------------------------------
+// GingoTuning
+// ---------------------------------------------------------------------------
+
+GingoTuning::GingoTuning() {
+    setEqual(440.0f);
+}
+
+GingoTuning::GingoTuning(TuningPreset preset, uint8_t tonic, float a4) {
+    setEqual(440.0f);
+    setPreset(preset, tonic, a4);
+}
+
+void GingoTuning::setEqual(float a4) {
+    setPreset(TUNING_EQUAL, 0, a4);
+}
+
+void GingoTuning::setPreset(TuningPreset preset, uint8_t tonic, float a4) {
+    if ((uint8_t)preset > TUNING_MAQAM_RAST || a4 <= 0.0f) return;
+    float cents[12];
+    for (uint8_t i = 0; i < 11; i++) cents[i] = pgm_read_float(&TUNING_PRESET_CENTS[preset][i]);
+    cents[11] = 1200.0f;
+    const uint8_t middle = (uint8_t)(60 + tonic % 12);
+    const double refPitch = middle + 12.0 * log((double)a4 / 440.0) / log(2.0);
+    if (build_(cents, 12, nullptr, 0, 0, 127, middle, middle, refPitch, 0)) {
+        description_.setFromPROGMEM((const char*)pgm_read_ptr(&TUNING_PRESET_NAMES[preset]));
+    }
+}
+
+bool GingoTuning::setScale(const float* cents, uint8_t count, uint8_t middleKey,
+                           uint8_t refKey, float refHz) {
+    if (refHz <= 0.0f) return false;
+    if (!build_(cents, count, nullptr, 0, 0, 127, middleKey, refKey, hzToPitch(refHz), 0)) return false;
+    description_.clear();
+    return true;
+}
+
+bool GingoTuning::loadScala(const char* scl, const char* kbm) {
+    if (!scl) return false;
+    char line[64];
+
+    // .scl: description, degree count, one pitch per degree
+    const char* p = scl;
+    if (!scalaLine(p, line, sizeof(line))) return false;
+    FixedStr<31> description(line);
+    long count;
+    if (!scalaValueLine(p, line, sizeof(line)) || !scalaInt(line, 1, MAX_DEGREES, count)) return false;
+    float cents[MAX_DEGREES];
+    for (uint8_t i = 0; i < count; i++) {
+        if (!scalaValueLine(p, line, sizeof(line)) || !scalaPitch(line, cents[i])) return false;
+    }
+
+    // .kbm: size, first, last, middle, reference key, frequency, octave
+    // degree, then one degree (or "x") per key of the pattern
+    long mapSize = 0, first = 0, last = 127, middle = 60, refKey = 60, octave = 0;
+    float refHz = 261.6256f;
+    int16_t map[128];
+    if (kbm) {
+        p = kbm;
+        long* const ints[] = { &mapSize, &first, &last, &middle, &refKey };
+        const long limits[] = { 128, 127, 127, 127, 127 };
+        for (uint8_t i = 0; i < 5; i++) {
+            if (!scalaValueLine(p, line, sizeof(line)) || !scalaInt(line, 0, limits[i], *ints[i])) return false;
+        }
+        if (!scalaValueLine(p, line, sizeof(line))) return false;
+        char* end;
+        refHz = (float)strtod(line, &end);
+        if (end == line || refHz <= 0.0f) return false;
+        if (!scalaValueLine(p, line, sizeof(line)) || !scalaInt(line, 0, 32767, octave)) return false;
+        for (uint8_t i = 0; i < mapSize; i++) {
+            // Missing entries at the end read as unmapped
+            long degree = -1;
+            if (scalaValueLine(p, line, sizeof(line))) {
+                const char* s = line;
+                while (*s == ' ' || *s == '\t') s++;
+                if (*s != 'x' && !scalaInt(s, 0, 32767, degree)) return false;
+            }
+            map[i] = (int16_t)degree;
+        }
+    }
+
+    if (!build_(cents, (uint8_t)count, map, (uint8_t)mapSize, (uint8_t)first, (uint8_t)last,
+                (uint8_t)middle, (uint8_t)refKey, hzToPitch(refHz),
+                (uint8_t)(octave > 255 ? 0 : octave))) {
+        return false;
+    }
+    description_ = description;
+    return true;
+}
+
+float GingoTuning::cents(uint8_t midiNum) const {
+    const float f = frequency(midiNum);
+    if (f <= 0.0f) return 0.0f;
+    return 1200.0f * log2f(f / 440.0f) - 100.0f * ((int)midiNum - 69);
+}
+
+// Validate, then fill both tables. Nothing is written when it fails.
+bool GingoTuning::build_(const float* cents, uint8_t count, const int16_t* map, uint8_t mapSize,
+                         uint8_t first, uint8_t last, uint8_t middle, uint8_t refKey,
+                         double refPitch, uint8_t octaveDegree) {
+    if (!cents || count == 0 || cents[count - 1] <= 0.0f) return false;
+    if (first > last || last > 127 || middle > 127 || refKey > 127) return false;
+    if (mapSize && !map) return false;
+    if (octaveDegree == 0) octaveDegree = count;
+    const float patternCents = degreeCents(cents, count, octaveDegree);
+    if (mapSize && patternCents <= 0.0f) return false;
+
+    // Cents of a key above the tonic key, false if the mapping skips it
+    struct Mapper {
+        const float* cents; uint8_t count; const int16_t* map; uint8_t mapSize;
+        uint8_t middle; float patternCents;
+        bool at(uint8_t key, float& out) const {
+            const int16_t d = (int16_t)((int)key - middle);
+            if (mapSize == 0) {
+                out = degreeCents(cents, count, d);
+                return true;
+            }
+            const int16_t rep = floorDiv(d, mapSize);
+            const int16_t degree = map[d - rep * mapSize];
+            if (degree < 0) return false;
+            out = rep * patternCents + degreeCents(cents, count, degree);
+            return true;
+        }
+    };
+    const Mapper m = { cents, count, map, mapSize, middle, patternCents };
+    float refCents;
+    if (!m.at(refKey, refCents)) return false;
+
+    for (uint8_t k = 0; k < 128; k++) {
+        double pitch = k;
+        float c;
+        if (k < first || k > last) {
+            freq_[k] = 440.0f * powf(2.0f, ((int)k - 69) / 12.0f);
+        } else if (!m.at(k, c)) {
+            freq_[k] = 0.0f;
+        } else {
+            pitch = refPitch + (c - refCents) / 100.0;
+            freq_[k] = (float)(440.0 * pow(2.0, (pitch - 69.0) / 12.0));
+        }
+        if (pitch < 0.0) pitch = 0.0;
+        const double units = pitch * 33554432.0 + 0.5;   // 2^25 per semitone
+        pitch_[k] = units >= 4294967295.0 ? 0xFFFFFFFFUL : (uint32_t)units;
+    }
+    degrees_ = count;
+    return true;
+}
+
+} // namespace gingoduino
+
+#endif // GINGODUINO_HAS_TUNING
@@ -0,0 +1,124 @@
+// Gingoduino - Music Theory Library for Embedded Systems
+// GingoTuning: per-note tuning table for alternate tuning systems.
+//
+// Holds the frequency and the MIDI 2.0 per-note pitch (7.25 fixed point)
+// of all 128 MIDI notes, built from a preset (just, Pythagorean, meantone,
+// Werckmeister III, maqam Rast) or parsed from Scala .scl / .kbm text.
+// GingoNote / GingoEvent frequency queries, GingoSynth and the GingoMIDI2
+// per-note pitch encoder read the table, so retuning is a table swap.
+//
+//   GingoTuning just(TUNING_JUST, 2);        // 5-limit just on D
+//   just.frequency(66);                      // F#4, a pure third over D
+//   synth.setTuning(&just);
+//
+// SPDX-License-Identifier: MIT
+
+#ifndef GINGO_TUNING_H
+#define GINGO_TUNING_H
+
+#include "gingoduino_config.h"
+
+#if GINGODUINO_HAS_TUNING
+
+#include "gingoduino_types.h"
+
+namespace gingoduino {
+
+/// Built-in 12-note tunings, listed from the tonic.
+enum TuningPreset : uint8_t {
+    TUNING_EQUAL        = 0,   ///< 12-tone equal temperament
+    TUNING_JUST         = 1,   ///< 5-limit just intonation (major, 16/15 ... 15/8)
+    TUNING_PYTHAGOREAN  = 2,   ///< pure fifths, wolf between the 5th and 11th steps
+    TUNING_MEANTONE     = 3,   ///< quarter-comma meantone, pure major thirds
+    TUNING_WERCKMEISTER = 4,   ///< Werckmeister III well temperament
+    TUNING_MAQAM_RAST   = 5    ///< 3rd and 7th steps a quarter tone flat (Rast, Bayati a tone up)
+};
+
+/// Frequency and MIDI 2.0 pitch of every MIDI note.
+///
+/// A tuning is a list of degrees in cents above the tonic, the last one
+/// being the period (1200 for an octave), laid out over the keyboard by a
+/// mapping: which key plays the tonic, which key sounds at a reference
+/// frequency, and optionally which degree each key of a repeating pattern
+/// plays. This is the Scala model; presets use the linear mapping with
+/// the tonic key at its 12-TET frequency.
+///
+/// Keys a .kbm mapping marks "x" are unmapped: frequency() returns 0,
+/// mapped() false, and the synth ignores them. Keys outside the mapped
+/// range keep 12-TET at A4 = 440 Hz.
+///
+/// The table is 1 KB; pass it around by pointer or reference.
+///
+/// Examples:
+///   GingoTuning t;                             // 12-TET, A4 = 440
+///   t.setPreset(TUNING_MEANTONE, 0, 415.0f);   // meantone on C, A4 = 415
+///   t.loadScala(sclText, kbmText);             // false on a parse error
+///   t.pitch725(64);                            // MIDI 2.0 pitch of E4
+class GingoTuning {
+public:
+    static const uint8_t MAX_DEGREES = GINGODUINO_TUNING_MAX_DEGREES;
+
+    /// 12-TET with A4 = 440 Hz.
+    GingoTuning();
+
+    /// A preset on a tonic pitch class (C = 0); the tonic keys sound at
+    /// their 12-TET frequency for the given A4.
+    explicit GingoTuning(TuningPreset preset, uint8_t tonic = 0, float a4 = 440.0f);
+
+    /// 12-TET with another A4.
+    void setEqual(float a4 = 440.0f);
+
+    /// Replace the table with a preset (see the constructor).
+    void setPreset(TuningPreset preset, uint8_t tonic = 0, float a4 = 440.0f);
+
+    /// Degrees in cents above the tonic, the last one being the period,
+    /// mapped linearly with the tonic on middleKey and refKey sounding at
+    /// refHz. False (table unchanged) if the degrees are not usable.
+    bool setScale(const float* cents, uint8_t count, uint8_t middleKey = 60,
+                  uint8_t refKey = 60, float refHz = 261.6256f);
+
+    /// Parse Scala text: a .scl scale and an optional .kbm keyboard
+    /// mapping (nullptr = linear, 1/1 on middle C at 261.6256 Hz). Both
+    /// are NUL-terminated buffers; "!" lines are comments. False (table
+    /// unchanged) on a malformed file or more than MAX_DEGREES degrees.
+    bool loadScala(const char* scl, const char* kbm = nullptr);
+
+    /// Frequency of a MIDI note in Hz (0 for unmapped keys).
+    float frequency(uint8_t midiNum) const {
+        return midiNum < 128 ? freq_[midiNum] : 0.0f;
+    }
+
+    /// MIDI 2.0 per-note pitch (registered per-note controller 3): note
+    /// number in the top 7 bits, 25-bit fraction. Unmapped keys hold the
+    /// 12-TET value.
+    uint32_t pitch725(uint8_t midiNum) const {
+        return midiNum < 128 ? pitch_[midiNum] : 0;
+    }
+
+    /// Deviation from 12-TET at A4 = 440 Hz, in cents (0 for unmapped).
+    float cents(uint8_t midiNum) const;
+
+    /// Whether a key sounds (not marked "x" by the mapping).
+    bool mapped(uint8_t midiNum) const { return frequency(midiNum) > 0.0f; }
+
+    /// Degrees per period (12 for the presets).
+    uint8_t degrees() const { return degrees_; }
+
+    /// Scala description line, or the preset name.
+    const char* description() const { return description_.c_str(); }
+
+private:
+    float          freq_[128];
+    uint32_t       pitch_[128];
+    FixedStr<31>   description_;
+    uint8_t        degrees_;
+
+    bool build_(const float* cents, uint8_t count, const int16_t* map, uint8_t mapSize,
+                uint8_t first, uint8_t last, uint8_t middle, uint8_t refKey,
+                double refPitch, uint8_t octaveDegree);
+};
+
+} // namespace gingoduino
+
+#endif // GINGODUINO_HAS_TUNING
+#endif // GINGO_TUNING_H
@@ -75,10 +75,36 @@
 #if GINGODUINO_HAS_MIDI1
   #include "GingoMIDI1.h"
 #endif
+#if GINGODUINO_HAS_ARP
+  #include "GingoArpeggiator.h"
+#endif
 
 // Tier 3: MIDI2 UMP / MIDI-CI (needs Sequence)
 #if GINGODUINO_HAS_MIDI2
   #include "GingoMIDI2.h"
 #endif
 
+// Tier 2+: tuning tables
+#if GINGODUINO_HAS_TUNING
+  #include "GingoTuning.h"
+#endif
+
+// Tier 3: block-based synth and sequence player
+#if GINGODUINO_HAS_SYNTH
+  #include "GingoSynth.h"
+#endif
+
+// Tier 3: pitch detection from audio input
+#if GINGODUINO_HAS_PITCH
+  #include "GingoPitch.h"
+#endif
+
+// Tier 3: chromagram, chords and key from audio input
+#if GINGODUINO_HAS_CHROMA
+  #include "GingoChroma.h"
+#endif
+
+// Opt-in profiling probes (GINGODUINO_PROFILE=1)
+#include "GingoProfile.h"
+
 #endif // GINGODUINO_H
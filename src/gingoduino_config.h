@@ -74,12 +74,12 @@
   #define GINGODUINO_HAS_MONITOR  0
 #endif
 
-// GingoMIDI1: raw MIDI byte parser (Tier 2+, needs Monitor)
+// GingoMIDI1: MIDI 1.0 byte output (Tier 3, serializes GingoEvent)
 // GingoMIDI2: UMP Flex Data + MIDI-CI generator (Tier 3, needs Sequence)
 #if GINGODUINO_HAS_SEQUENCE
   #define GINGODUINO_HAS_MIDI1  1
   #define GINGODUINO_HAS_MIDI2  1
-#elif GINGODUINO_HAS_FIELD
+#elif GINGODUINO_HAS_EVENT
   #define GINGODUINO_HAS_MIDI1  1
   #define GINGODUINO_HAS_MIDI2  0
 #else
@@ -87,6 +87,41 @@
   #define GINGODUINO_HAS_MIDI2  0
 #endif
 
+// GingoArpeggiator: tick-clocked arpeggiator fed by GingoMonitor (Tier 2+)
+#if GINGODUINO_HAS_MONITOR
+  #define GINGODUINO_HAS_ARP  1
+#else
+  #define GINGODUINO_HAS_ARP  0
+#endif
+
+// GingoTuning: per-note tuning tables, presets and Scala files (Tier 2+)
+#if GINGODUINO_TIER >= 2
+  #define GINGODUINO_HAS_TUNING  1
+#else
+  #define GINGODUINO_HAS_TUNING  0
+#endif
+
+// GingoSynth: block-based wavetable synth and sequence player (Tier 3)
+#if GINGODUINO_TIER >= 3
+  #define GINGODUINO_HAS_SYNTH  1
+#else
+  #define GINGODUINO_HAS_SYNTH  0
+#endif
+
+// GingoPitch: streaming monophonic pitch detector for audio input (Tier 3)
+#if GINGODUINO_TIER >= 3
+  #define GINGODUINO_HAS_PITCH  1
+#else
+  #define GINGODUINO_HAS_PITCH  0
+#endif
+
+// GingoChroma: streaming chromagram with chord and key matching (Tier 3)
+#if GINGODUINO_TIER >= 3
+  #define GINGODUINO_HAS_CHROMA  1
+#else
+  #define GINGODUINO_HAS_CHROMA  0
+#endif
+
 // ---------------------------------------------------------------------------
 // PROGMEM portability
 // ---------------------------------------------------------------------------
@@ -130,6 +165,27 @@
   #endif
 #endif
 
+// Flash is ordinary addressable memory everywhere except AVR (separate
+// address space) and ESP8266 (aligned 32-bit reads only). With 1 the
+// data:: table helpers compare and measure table strings in place through
+// plain pointers; with 0 they go through the *_P / pgm_read routines.
+#ifndef GINGODUINO_PGM_DIRECT
+  #if defined(__AVR__) || defined(ESP8266)
+    #define GINGODUINO_PGM_DIRECT  0
+  #else
+    #define GINGODUINO_PGM_DIRECT  1
+  #endif
+#endif
+
+// ---------------------------------------------------------------------------
+// Profiling probes (GingoProfile.h). Off by default: probes compile to
+// nothing unless GINGODUINO_PROFILE is 1.
+// ---------------------------------------------------------------------------
+
+#ifndef GINGODUINO_PROFILE
+  #define GINGODUINO_PROFILE  0
+#endif
+
 // ---------------------------------------------------------------------------
 // Configurable limits
 // ---------------------------------------------------------------------------
@@ -148,9 +204,57 @@
   #endif
 #endif
 
+#if GINGODUINO_HAS_TREE && GINGODUINO_HAS_SEQUENCE
+  // GingoTree::harmonize(): paths kept per step and steps per call.
+  // Working memory is 2 x beam x steps bytes of back-pointers.
+  #ifndef GINGODUINO_HARMONY_BEAM
+    #define GINGODUINO_HARMONY_BEAM       8
+  #endif
+  #ifndef GINGODUINO_MAX_HARMONY_STEPS
+    #define GINGODUINO_MAX_HARMONY_STEPS  256
+  #endif
+  #if GINGODUINO_HARMONY_BEAM < 1 || GINGODUINO_HARMONY_BEAM > 64
+    #error "GINGODUINO_HARMONY_BEAM must be between 1 and 64"
+  #endif
+  #if GINGODUINO_MAX_HARMONY_STEPS < 1 || GINGODUINO_MAX_HARMONY_STEPS > 4096
+    #error "GINGODUINO_MAX_HARMONY_STEPS must be between 1 and 4096"
+  #endif
+#endif
+
+#if GINGODUINO_HAS_COMPARISON
+  // GingoChordComparison::matrix() from chords: profiles built on the stack.
+  #ifndef GINGODUINO_MAX_MATRIX_CHORDS
+    #define GINGODUINO_MAX_MATRIX_CHORDS  16
+  #endif
+  // GingoChordComparison::matrix() over profiles: columns gathered per tile
+  // into one array per field for the branch-free kernels (0 = per-pair
+  // dimension() calls only). About 18 bytes of stack per column.
+  #ifndef GINGODUINO_MATRIX_TILE
+    #define GINGODUINO_MATRIX_TILE  64
+  #endif
+  #if GINGODUINO_MATRIX_TILE > 255
+    #error "GINGODUINO_MATRIX_TILE must be 255 or less"
+  #endif
+  // GingoChordComparison::voiceLeading(): voices per voicing.
+  #ifndef GINGODUINO_MAX_VOICES
+    #define GINGODUINO_MAX_VOICES  8
+  #endif
+#endif
+
 #if GINGODUINO_HAS_FRETBOARD
+  // Up to 12 strings (7/8-string guitars, extended basses, 10/12-string
+  // instruments). Tier 3 defaults to 8: each extra string costs 4 bytes per
+  // GingoFingering and 50 per GingoFretboard (its pitch-class index), so
+  // raise it only for 10- and 12-string boards.
   #ifndef GINGODUINO_MAX_STRINGS
-    #define GINGODUINO_MAX_STRINGS         6
+    #if GINGODUINO_TIER >= 3
+      #define GINGODUINO_MAX_STRINGS       8
+    #else
+      #define GINGODUINO_MAX_STRINGS       6
+    #endif
+  #endif
+  #if GINGODUINO_MAX_STRINGS > 12
+    #error "GINGODUINO_MAX_STRINGS must be 12 or less"
   #endif
   #ifndef GINGODUINO_MAX_FRET_POSITIONS
     #define GINGODUINO_MAX_FRET_POSITIONS  48
@@ -158,6 +262,132 @@
   #ifndef GINGODUINO_MAX_FINGERINGS
     #define GINGODUINO_MAX_FINGERINGS      5
   #endif
+  // planFingerings(): candidates per chord (K) and chords per call.
+  // Working memory is K x chords bytes of back-pointers plus 2 x K fingerings.
+  #ifndef GINGODUINO_PLAN_CANDIDATES
+    #define GINGODUINO_PLAN_CANDIDATES     4
+  #endif
+  #ifndef GINGODUINO_MAX_PLAN_CHORDS
+    #define GINGODUINO_MAX_PLAN_CHORDS     64
+  #endif
+  // GingoFingeringCache: entries per cache (0 = compiled out) and
+  // fingerings kept per entry.
+  #ifndef GINGODUINO_FINGERING_CACHE_SIZE
+    #if defined(ESP8266)
+      #define GINGODUINO_FINGERING_CACHE_SIZE   0
+    #else
+      #define GINGODUINO_FINGERING_CACHE_SIZE   8
+    #endif
+  #endif
+  #ifndef GINGODUINO_FINGERING_CACHE_DEPTH
+    #define GINGODUINO_FINGERING_CACHE_DEPTH    GINGODUINO_MAX_FINGERINGS
+  #endif
+  #if GINGODUINO_FINGERING_CACHE_SIZE > 0
+    #define GINGODUINO_HAS_FINGERING_CACHE  1
+  #else
+    #define GINGODUINO_HAS_FINGERING_CACHE  0
+  #endif
+  // Precomputed position-0 shapes for the standard tunings
+  // (gingoduino_shapes.h, about 6 KB of flash). Define as 0 to drop them.
+  #ifndef GINGODUINO_HAS_SHAPE_LIBRARY
+    #define GINGODUINO_HAS_SHAPE_LIBRARY    1
+  #endif
+#else
+  #define GINGODUINO_HAS_FINGERING_CACHE    0
+  #define GINGODUINO_HAS_SHAPE_LIBRARY      0
+#endif
+
+#if GINGODUINO_HAS_ARP
+  // GingoArpeggiator: longest pattern (held notes x octaves, plus the way
+  // back for up-down) and clock ticks per quarter note (24 = MIDI clock).
+  #ifndef GINGODUINO_ARP_MAX_STEPS
+    #define GINGODUINO_ARP_MAX_STEPS  64
+  #endif
+  #ifndef GINGODUINO_ARP_PPQN
+    #define GINGODUINO_ARP_PPQN       96
+  #endif
+  #if GINGODUINO_ARP_MAX_STEPS < 1 || GINGODUINO_ARP_MAX_STEPS > 255
+    #error "GINGODUINO_ARP_MAX_STEPS must be between 1 and 255"
+  #endif
+  #if GINGODUINO_ARP_PPQN < 1 || GINGODUINO_ARP_PPQN > 960
+    #error "GINGODUINO_ARP_PPQN must be between 1 and 960"
+  #endif
+#endif
+
+#if GINGODUINO_HAS_TUNING
+  // GingoTuning: most degrees a Scala scale may have (loadScala() keeps
+  // them on the stack, 4 bytes each).
+  #ifndef GINGODUINO_TUNING_MAX_DEGREES
+    #define GINGODUINO_TUNING_MAX_DEGREES  128
+  #endif
+  #if GINGODUINO_TUNING_MAX_DEGREES < 1 || GINGODUINO_TUNING_MAX_DEGREES > 255
+    #error "GINGODUINO_TUNING_MAX_DEGREES must be between 1 and 255"
+  #endif
+#endif
+
+#if GINGODUINO_HAS_SYNTH
+  // GingoSynth: voices, wavetable size (2^bits samples), frames per
+  // internal block, and partials summed for saw/square/triangle.
+  #ifndef GINGODUINO_SYNTH_VOICES
+    #define GINGODUINO_SYNTH_VOICES        8
+  #endif
+  #ifndef GINGODUINO_SYNTH_TABLE_BITS
+    #define GINGODUINO_SYNTH_TABLE_BITS    8
+  #endif
+  #ifndef GINGODUINO_SYNTH_BLOCK
+    #define GINGODUINO_SYNTH_BLOCK         32
+  #endif
+  #ifndef GINGODUINO_SYNTH_HARMONICS
+    #define GINGODUINO_SYNTH_HARMONICS     16
+  #endif
+  #if GINGODUINO_SYNTH_TABLE_BITS > 16
+    #error "GINGODUINO_SYNTH_TABLE_BITS must be 16 or less"
+  #endif
+  // Mix voices with the esp-dsp vector routines (ESP32-S3 PIE), when the
+  // esp-dsp component is available. 0 uses the portable loops.
+  #ifndef GINGODUINO_SYNTH_ESP_DSP
+    #if defined(CONFIG_IDF_TARGET_ESP32S3) && defined(__has_include)
+      #if __has_include(<dsps_add.h>)
+        #define GINGODUINO_SYNTH_ESP_DSP   1
+      #endif
+    #endif
+  #endif
+  #ifndef GINGODUINO_SYNTH_ESP_DSP
+    #define GINGODUINO_SYNTH_ESP_DSP       0
+  #endif
+#endif
+
+#if GINGODUINO_HAS_PITCH
+  // GingoPitch: analysis window and longest period searched (samples),
+  // and samples between detections. State is about
+  // 2 x (window + lag + hop) + 8 x lag bytes.
+  #ifndef GINGODUINO_PITCH_WINDOW
+    #define GINGODUINO_PITCH_WINDOW        1024
+  #endif
+  #ifndef GINGODUINO_PITCH_MAX_LAG
+    #define GINGODUINO_PITCH_MAX_LAG       1024
+  #endif
+  #ifndef GINGODUINO_PITCH_HOP
+    #define GINGODUINO_PITCH_HOP           128
+  #endif
+#endif
+
+#if GINGODUINO_HAS_CHROMA
+  // GingoChroma: FFT length (power of two) and samples between analyses.
+  // State is about 8 x FFT bytes.
+  #ifndef GINGODUINO_CHROMA_FFT
+    #define GINGODUINO_CHROMA_FFT          4096
+  #endif
+  #ifndef GINGODUINO_CHROMA_HOP
+    #define GINGODUINO_CHROMA_HOP          2048
+  #endif
+  #if GINGODUINO_CHROMA_FFT < 64 || GINGODUINO_CHROMA_FFT > 16384 || \
+      (GINGODUINO_CHROMA_FFT & (GINGODUINO_CHROMA_FFT - 1)) != 0
+    #error "GINGODUINO_CHROMA_FFT must be a power of two from 64 to 16384"
+  #endif
+  #if GINGODUINO_CHROMA_HOP < 1 || GINGODUINO_CHROMA_HOP > GINGODUINO_CHROMA_FFT
+    #error "GINGODUINO_CHROMA_HOP must be between 1 and GINGODUINO_CHROMA_FFT"
+  #endif
 #endif
 
 #endif // GINGODUINO_CONFIG_H
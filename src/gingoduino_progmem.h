@@ -7,6 +7,7 @@
 #define GINGODUINO_PROGMEM_H
 
 #include "gingoduino_config.h"
+#include "GingoProfile.h"
 
 namespace gingoduino {
 namespace data {
@@ -101,6 +102,14 @@ static const IntervalData INTERVAL_TABLE[24] PROGMEM = {
     /* 23*/ {"bI",  "ma14", 14, 2},
 };
 
+// Letters above the root for a chord tone at each INTERVAL_TABLE index,
+// as chord symbols spell it (6 = b5, 8 = #5, 15 = #9, 18 = #11). The
+// diminished seventh (9 beside a b5) is adjusted in code.
+static const uint8_t CHORD_TONE_STEPS[24] PROGMEM = {
+    0, 1, 1, 2, 2, 3, 4, 4, 4, 5, 6, 6,
+    0, 1, 1, 1, 2, 3, 3, 4, 5, 5, 6, 6
+};
+
 // ===================================================================
 // 4. SCALE MASKS - 10 scale types x 24-bit bitmask
 // ===================================================================
@@ -215,6 +224,135 @@ static const ChordFormula CHORD_FORMULAS[42] PROGMEM = {
     /* 41 (b13)   */ {{0, 4, 7, 20, 0, 0, 0}, 4},
 };
 
+static const uint8_t CHORD_FORMULA_COUNT = 42;
+
+// Pitch-class masks of CHORD_FORMULAS (bit n = n semitones above the root,
+// compound intervals folded into the octave). Lookup index for mask-based
+// identification; formulas that fold to the same mask (add9/add2, ...) keep
+// the lower index first.
+static const uint16_t CHORD_FORMULA_MASKS[42] PROGMEM = {
+    /*  0 M       */ 0x091,
+    /*  1 7M      */ 0x891,
+    /*  2 6       */ 0x291,
+    /*  3 6(9)    */ 0x295,
+    /*  4 M9      */ 0x895,
+    /*  5 m       */ 0x089,
+    /*  6 m7      */ 0x489,
+    /*  7 m6      */ 0x289,
+    /*  8 m11     */ 0x4A9,
+    /*  9 mM7     */ 0x889,
+    /* 10 7       */ 0x491,
+    /* 11 9       */ 0x495,
+    /* 12 11      */ 0x4B5,
+    /* 13 dim     */ 0x049,
+    /* 14 dim7    */ 0x249,
+    /* 15 m7(b5)  */ 0x449,
+    /* 16 aug     */ 0x111,
+    /* 17 7#5     */ 0x511,
+    /* 18 7(b5)   */ 0x451,
+    /* 19 13      */ 0x6B5,
+    /* 20 13(#11) */ 0x6D5,
+    /* 21 7+5     */ 0x511,
+    /* 22 7+9     */ 0x499,
+    /* 23 7(b9)   */ 0x493,
+    /* 24 7(#11)  */ 0x4D1,
+    /* 25 5       */ 0x081,
+    /* 26 add9    */ 0x095,
+    /* 27 add2    */ 0x095,
+    /* 28 add11   */ 0x0B1,
+    /* 29 add4    */ 0x0B1,
+    /* 30 sus2    */ 0x085,
+    /* 31 sus4    */ 0x0A1,
+    /* 32 sus7    */ 0x4A1,
+    /* 33 sus9    */ 0x0A5,
+    /* 34 m13     */ 0x6AD,
+    /* 35 maj13   */ 0xAD5,
+    /* 36 sus     */ 0x0A1,
+    /* 37 m9      */ 0x48D,
+    /* 38 M7#5    */ 0x911,
+    /* 39 m7(11)  */ 0x4A9,
+    /* 40 (b9)    */ 0x093,
+    /* 41 (b13)   */ 0x191,
+};
+
+// Mask lookup for GingoChord::identifyMask(), sorted by mask then formula
+// for binary search. One entry per distinct formula mask (the lowest index
+// of formulas folding together) with rank 0, plus the mask without the
+// fifth (rank 2) for formulas of four or more tones that contain one.
+// Derived from CHORD_FORMULA_MASKS; the native tests rebuild and compare it.
+struct ChordMaskEntry {
+    uint16_t mask;      // pitch-class mask relative to the root
+    uint8_t  formula;   // index into CHORD_FORMULAS
+    uint8_t  rank;      // 0 = full formula, 2 = fifth omitted
+};
+
+static const uint8_t CHORD_MASK_INDEX_COUNT = 62;
+
+static const ChordMaskEntry CHORD_MASK_INDEX[62] PROGMEM = {
+    {0x013, 40, 2},  // (b9) no 5th
+    {0x015, 26, 2},  // add9 no 5th
+    {0x025, 33, 2},  // sus9 no 5th
+    {0x031, 28, 2},  // add11 no 5th
+    {0x049, 13, 0},  // dim
+    {0x081, 25, 0},  // 5
+    {0x085, 30, 0},  // sus2
+    {0x089,  5, 0},  // m
+    {0x091,  0, 0},  // M
+    {0x093, 40, 0},  // (b9)
+    {0x095, 26, 0},  // add9
+    {0x0A1, 31, 0},  // sus4
+    {0x0A5, 33, 0},  // sus9
+    {0x0B1, 28, 0},  // add11
+    {0x111, 16, 0},  // aug
+    {0x111, 41, 2},  // (b13) no 5th
+    {0x191, 41, 0},  // (b13)
+    {0x209,  7, 2},  // m6 no 5th
+    {0x211,  2, 2},  // 6 no 5th
+    {0x215,  3, 2},  // 6(9) no 5th
+    {0x249, 14, 0},  // dim7
+    {0x289,  7, 0},  // m6
+    {0x291,  2, 0},  // 6
+    {0x295,  3, 0},  // 6(9)
+    {0x409,  6, 2},  // m7 no 5th
+    {0x40D, 37, 2},  // m9 no 5th
+    {0x411, 10, 2},  // 7 no 5th
+    {0x413, 23, 2},  // 7(b9) no 5th
+    {0x415, 11, 2},  // 9 no 5th
+    {0x419, 22, 2},  // 7+9 no 5th
+    {0x421, 32, 2},  // sus7 no 5th
+    {0x429,  8, 2},  // m11 no 5th
+    {0x435, 12, 2},  // 11 no 5th
+    {0x449, 15, 0},  // m7(b5)
+    {0x451, 18, 0},  // 7(b5)
+    {0x451, 24, 2},  // 7(#11) no 5th
+    {0x489,  6, 0},  // m7
+    {0x48D, 37, 0},  // m9
+    {0x491, 10, 0},  // 7
+    {0x493, 23, 0},  // 7(b9)
+    {0x495, 11, 0},  // 9
+    {0x499, 22, 0},  // 7+9
+    {0x4A1, 32, 0},  // sus7
+    {0x4A9,  8, 0},  // m11
+    {0x4B5, 12, 0},  // 11
+    {0x4D1, 24, 0},  // 7(#11)
+    {0x511, 17, 0},  // 7#5
+    {0x62D, 34, 2},  // m13 no 5th
+    {0x635, 19, 2},  // 13 no 5th
+    {0x655, 20, 2},  // 13(#11) no 5th
+    {0x6AD, 34, 0},  // m13
+    {0x6B5, 19, 0},  // 13
+    {0x6D5, 20, 0},  // 13(#11)
+    {0x809,  9, 2},  // mM7 no 5th
+    {0x811,  1, 2},  // 7M no 5th
+    {0x815,  4, 2},  // M9 no 5th
+    {0x889,  9, 0},  // mM7
+    {0x891,  1, 0},  // 7M
+    {0x895,  4, 0},  // M9
+    {0x911, 38, 0},  // M7#5
+    {0xA55, 35, 2},  // maj13 no 5th
+    {0xAD5, 35, 0},  // maj13
+};
+
 // ===================================================================
 // 5b. CHORD TYPE ALIASES - sorted for binary search
 // ===================================================================
@@ -287,6 +425,19 @@ static const ChordTypeAlias CHORD_TYPE_MAP[] PROGMEM = {
 
 static const uint8_t CHORD_TYPE_MAP_SIZE = sizeof(CHORD_TYPE_MAP) / sizeof(CHORD_TYPE_MAP[0]);
 
+// Canonical alias per formula index: the CHORD_TYPE_MAP entry of the
+// shortest alias containing a letter or digit (first in table order on
+// ties). Update together with CHORD_TYPE_MAP; the native tests check it.
+static const uint8_t CHORD_CANONICAL_ALIAS[CHORD_FORMULA_COUNT] PROGMEM = {
+     22,  20,   9,  10,  26,  35,  // 0-5
+     39,  38,  36,  42,  11,  19,  // 6-11
+      5,  32,  33,  41,  31,  12,  // 12-17
+     15,   6,   7,  17,  18,  16,  // 18-23
+     13,   8,   0,  28,  27,  29,  // 24-29
+     53,  54,  55,  56,  37,  23,  // 30-35
+     52,  43,   4,  40,   2,   1,  // 36-41
+};
+
 // ===================================================================
 // 6. TEMPO MARKINGS
 // ===================================================================
@@ -549,6 +700,21 @@ static const uint8_t TUNING_OPEN_G[6] PROGMEM = { 38, 43, 50, 55, 59, 62 };
 // DADGAD - D2 A2 D3 G3 A3 D4
 static const uint8_t TUNING_DADGAD[6] PROGMEM = { 38, 45, 50, 55, 57, 62 };
 
+// Bass - E1 A1 D2 G2
+static const uint8_t TUNING_BASS[4] PROGMEM = { 28, 33, 38, 43 };
+
+// 5-string bass - B0 E1 A1 D2 G2
+static const uint8_t TUNING_BASS5[5] PROGMEM = { 23, 28, 33, 38, 43 };
+
+// 6-string bass - B0 E1 A1 D2 G2 C3
+static const uint8_t TUNING_BASS6[6] PROGMEM = { 23, 28, 33, 38, 43, 48 };
+
+// 7-string guitar - B1 E2 A2 D3 G3 B3 E4
+static const uint8_t TUNING_SEVEN_STRING[7] PROGMEM = { 35, 40, 45, 50, 55, 59, 64 };
+
+// 8-string guitar - F#1 B1 E2 A2 D3 G3 B3 E4
+static const uint8_t TUNING_EIGHT_STRING[8] PROGMEM = { 30, 35, 40, 45, 50, 55, 59, 64 };
+
 #endif // GINGODUINO_HAS_FRETBOARD
 
 // ===================================================================
@@ -931,27 +1097,52 @@ static const BranchDegreeInfo BRANCH_DEGREE[PROG_BRANCH_COUNT] PROGMEM = {
 
 // ===================================================================
 // PROGMEM read helpers
+//
+// Table strings are compared and measured in place (pgmStrcmp,
+// pgmStrlen); readPgmStr copies only when the caller needs the text.
+// GINGODUINO_PGM_DIRECT selects plain pointer access or the *_P routines.
 // ===================================================================
 
 /// Read a PROGMEM string into a buffer
 inline void readPgmStr(char* dest, const char* pgmSrc, uint8_t maxLen) {
+    GINGODUINO_PROBE(PROBE_PGM_STR);
     uint8_t i = 0;
     char c;
+#if GINGODUINO_PGM_DIRECT
+    while (i < maxLen - 1 && (c = pgmSrc[i]) != '\0') {
+#else
     while (i < maxLen - 1 && (c = (char)pgm_read_byte(pgmSrc + i)) != '\0') {
+#endif
         dest[i++] = c;
     }
     dest[i] = '\0';
 }
 
+/// strcmp(ram, pgm) without copying the table string
+inline int pgmStrcmp(const char* ram, const char* pgm) {
+#if GINGODUINO_PGM_DIRECT
+    return strcmp(ram, pgm);
+#else
+    return strcmp_P(ram, pgm);
+#endif
+}
+
+/// strlen of a PROGMEM string
+inline uint8_t pgmStrlen(const char* pgm) {
+#if GINGODUINO_PGM_DIRECT
+    return (uint8_t)strlen(pgm);
+#else
+    return (uint8_t)strlen_P(pgm);
+#endif
+}
+
 /// Binary search in sorted PROGMEM EnharmonicEntry array
 inline int8_t findEnharmonic(const char* input) {
     int8_t lo = 0;
     int8_t hi = (int8_t)(ENHARMONIC_MAP_SIZE - 1);
     while (lo <= hi) {
         int8_t mid = (lo + hi) / 2;
-        char buf[5];
-        readPgmStr(buf, ENHARMONIC_MAP[mid].input, sizeof(buf));
-        int cmp = strcmp(input, buf);
+        int cmp = pgmStrcmp(input, ENHARMONIC_MAP[mid].input);
         if (cmp == 0) return mid;
         if (cmp < 0) hi = mid - 1;
         else lo = mid + 1;
@@ -965,9 +1156,7 @@ inline int8_t findChordType(const char* typeName) {
     int8_t hi = (int8_t)(CHORD_TYPE_MAP_SIZE - 1);
     while (lo <= hi) {
         int8_t mid = (lo + hi) / 2;
-        char buf[10];
-        readPgmStr(buf, CHORD_TYPE_MAP[mid].name, sizeof(buf));
-        int cmp = strcmp(typeName, buf);
+        int cmp = pgmStrcmp(typeName, CHORD_TYPE_MAP[mid].name);
         if (cmp == 0) return mid;
         if (cmp < 0) hi = mid - 1;
         else lo = mid + 1;
@@ -983,6 +1172,15 @@ inline void readChordFormula(uint8_t idx, uint8_t* intervals, uint8_t* count) {
     }
 }
 
+/// Canonical type name for a formula index: the shortest alias that
+/// contains a letter or digit (e.g. "M", "m7", "7M"). Empty if none fits.
+inline void readCanonicalChordType(uint8_t formulaIdx, char* dest, uint8_t maxLen) {
+    dest[0] = '\0';
+    if (formulaIdx >= CHORD_FORMULA_COUNT) return;
+    const char* alias = CHORD_TYPE_MAP[pgm_read_byte(&CHORD_CANONICAL_ALIAS[formulaIdx])].name;
+    if (pgmStrlen(alias) < maxLen) readPgmStr(dest, alias, maxLen);
+}
+
 /// Read chromatic note name from PROGMEM
 inline void readChromaticName(uint8_t semitone, char* dest, uint8_t maxLen) {
     readPgmStr(dest, CHROMATIC_NAMES[semitone % 12], maxLen);
@@ -0,0 +1,1163 @@
+// Gingoduino - Music Theory Library for Embedded Systems
+// Precomputed position-0 chord shapes per tuning.
+// Generated by extras/tools/gen_shapes.cpp - do not edit.
+//
+// SPDX-License-Identifier: MIT
+
+#ifndef GINGODUINO_SHAPES_H
+#define GINGODUINO_SHAPES_H
+
+#include "gingoduino_progmem.h"
+
+#if GINGODUINO_HAS_SHAPE_LIBRARY
+
+namespace gingoduino {
+namespace data {
+
+// Chord formulas covered, in table order.
+static const uint8_t SHAPE_FORMULA_COUNT = 12;
+static const uint8_t SHAPE_FORMULAS[12] PROGMEM = { 0, 5, 10, 6, 1, 2, 7, 14, 15, 16, 30, 31 };  // M m 7 m7 7M 6 m6 dim7 m7(b5) aug sus2 sus4
+
+// Each table: [formula][root pitch class][numStrings frets + score].
+// Fret bytes use the GingoPackedFingering convention (0x80 = muted);
+// 0xFF in the first byte marks a chord with no shape in frets 0-4.
+// One shape per chord, the best in frets 0-4. GingoFretboard::shapes()
+// moves the shapes rooted on the two lowest strings up the neck as
+// E-form and A-form barres.
+
+static const uint8_t SHAPES_VIOLAO[1008] PROGMEM = {
+    // M
+    0x80, 0x03, 0x02, 0x00, 0x01, 0x00,  20,  // CM
+    0x80, 0x04, 0x03, 0x01, 0x02, 0x01,  25,  // C#M
+    0x80, 0x80, 0x00, 0x02, 0x03, 0x02,  25,  // DM
+    0x80, 0x80, 0x01, 0x03, 0x04, 0x03,  33,  // D#M
+    0x00, 0x02, 0x02, 0x01, 0x00, 0x00,   7,  // EM
+    0x01, 0x03, 0x03, 0x02, 0x01, 0x01,  12,  // FM
+    0x02, 0x04, 0x04, 0x03, 0x02, 0x02,  14,  // F#M
+    0x03, 0x02, 0x00, 0x00, 0x00, 0x03,   9,  // GM
+    0x04, 0x03, 0x01, 0x01, 0x01, 0x04,  17,  // G#M
+    0x80, 0x00, 0x02, 0x02, 0x02, 0x00,  12,  // AM
+    0x80, 0x01, 0x00, 0x03, 0x03, 0x01,  20,  // A#M
+    0x80, 0x02, 0x04, 0x04, 0x04, 0x02,  22,  // BM
+    // m
+    0x80, 0x03, 0x01, 0x00, 0x01, 0x03,  20,  // Cm
+    0x80, 0x04, 0x02, 0x01, 0x02, 0x00,  25,  // C#m
+    0x80, 0x80, 0x00, 0x02, 0x03, 0x01,  28,  // Dm
+    0x80, 0x80, 0x01, 0x03, 0x04, 0x02,  33,  // D#m
+    0x00, 0x02, 0x02, 0x00, 0x00, 0x00,   4,  // Em
+    0x01, 0x03, 0x03, 0x01, 0x01, 0x01,  12,  // Fm
+    0x02, 0x00, 0x80, 0x02, 0x02, 0x02,  12,  // F#m
+    0x03, 0x01, 0x00, 0x00, 0x03, 0x03,  12,  // Gm
+    0x04, 0x80, 0x80, 0x04, 0x04, 0x04,  24,  // G#m
+    0x80, 0x00, 0x02, 0x02, 0x01, 0x00,  15,  // Am
+    0x80, 0x01, 0x03, 0x03, 0x02, 0x01,  20,  // A#m
+    0x80, 0x02, 0x00, 0x80, 0x00, 0x02,  20,  // Bm
+    // 7
+    0x80, 0x03, 0x02, 0x03, 0x80, 0x03,  25,  // C7
+    0x80, 0x04, 0x03, 0x04, 0x00, 0x04,  19,  // C#7
+    0x80, 0x80, 0x00, 0x02, 0x01, 0x02,  23,  // D7
+    0x80, 0x80, 0x01, 0x03, 0x02, 0x03,  28,  // D#7
+    0x00, 0x02, 0x00, 0x01, 0x00, 0x00,   7,  // E7
+    0x01, 0x00, 0x01, 0x80, 0x01, 0x01,  10,  // F7
+    0x02, 0x04, 0x02, 0x03, 0x02, 0x02,  14,  // F#7
+    0x03, 0x02, 0x00, 0x00, 0x00, 0x01,  12,  // G7
+    0x04, 0x03, 0x01, 0x01, 0x01, 0x02,  17,  // G#7
+    0x80, 0x00, 0x02, 0x00, 0x02, 0x00,  12,  // A7
+    0x80, 0x01, 0x00, 0x01, 0x80, 0x01,  18,  // A#7
+    0x80, 0x02, 0x01, 0x02, 0x00, 0x02,  15,  // B7
+    // m7
+    0x80, 0x03, 0x01, 0x03, 0x01, 0x03,  20,  // Cm7
+    0x80, 0x04, 0x02, 0x04, 0x00, 0x04,  22,  // C#m7
+    0x80, 0x80, 0x00, 0x02, 0x01, 0x01,  23,  // Dm7
+    0x80, 0x80, 0x01, 0x03, 0x02, 0x02,  28,  // D#m7
+    0x00, 0x02, 0x00, 0x00, 0x00, 0x00,   4,  // Em7
+    0x01, 0x80, 0x01, 0x01, 0x01, 0x01,  10,  // Fm7
+    0x02, 0x00, 0x02, 0x02, 0x02, 0x00,   4,  // F#m7
+    0x03, 0x01, 0x00, 0x00, 0x03, 0x01,  12,  // Gm7
+    0x04, 0x80, 0x04, 0x04, 0x04, 0x04,  16,  // G#m7
+    0x80, 0x00, 0x02, 0x00, 0x01, 0x00,  15,  // Am7
+    0x80, 0x01, 0x03, 0x01, 0x02, 0x01,  20,  // A#m7
+    0x80, 0x02, 0x00, 0x02, 0x00, 0x02,  12,  // Bm7
+    // 7M
+    0x80, 0x03, 0x02, 0x00, 0x00, 0x00,  17,  // C7M
+    0x80, 0x04, 0x03, 0x01, 0x01, 0x01,  25,  // C#7M
+    0x80, 0x80, 0x00, 0x02, 0x02, 0x02,  20,  // D7M
+    0x80, 0x80, 0x01, 0x03, 0x03, 0x03,  28,  // D#7M
+    0x00, 0x02, 0x01, 0x01, 0x00, 0x00,   7,  // E7M
+    0x01, 0x00, 0x02, 0x02, 0x01, 0x00,   7,  // F7M
+    0x02, 0x04, 0x03, 0x03, 0x02, 0x02,  14,  // F#7M
+    0x03, 0x02, 0x00, 0x00, 0x00, 0x02,   9,  // G7M
+    0x04, 0x03, 0x01, 0x01, 0x01, 0x03,  17,  // G#7M
+    0x80, 0x00, 0x02, 0x01, 0x02, 0x00,  15,  // A7M
+    0x80, 0x01, 0x00, 0x02, 0x03, 0x01,  20,  // A#7M
+    0x80, 0x02, 0x01, 0x03, 0x00, 0x02,  20,  // B7M
+    // 6
+    0x80, 0x03, 0x02, 0x02, 0x80, 0x03,  25,  // C6
+    0x80, 0x04, 0x03, 0x03, 0x80, 0x04,  27,  // C#6
+    0x80, 0x80, 0x00, 0x02, 0x00, 0x02,  20,  // D6
+    0x80, 0x80, 0x01, 0x03, 0x01, 0x03,  28,  // D#6
+    0x00, 0x02, 0x02, 0x01, 0x02, 0x00,   7,  // E6
+    0x01, 0x00, 0x00, 0x02, 0x01, 0x01,   7,  // F6
+    0x02, 0x01, 0x01, 0x80, 0x02, 0x02,  15,  // F#6
+    0x03, 0x02, 0x00, 0x00, 0x00, 0x00,   9,  // G6
+    0x04, 0x03, 0x01, 0x01, 0x01, 0x01,  17,  // G#6
+    0x80, 0x00, 0x02, 0x02, 0x02, 0x02,  12,  // A6
+    0x80, 0x01, 0x00, 0x00, 0x80, 0x01,  18,  // A#6
+    0x80, 0x02, 0x01, 0x01, 0x00, 0x02,  15,  // B6
+    // m6
+    0x80, 0x03, 0x01, 0x02, 0x01, 0x03,  20,  // Cm6
+    0x80, 0x04, 0x02, 0x03, 0x02, 0x04,  22,  // C#m6
+    0x80, 0x80, 0x00, 0x02, 0x00, 0x01,  23,  // Dm6
+    0x80, 0x80, 0x01, 0x03, 0x01, 0x02,  28,  // D#m6
+    0x00, 0x02, 0x02, 0x00, 0x02, 0x00,   4,  // Em6
+    0x01, 0x80, 0x00, 0x01, 0x01, 0x01,  10,  // Fm6
+    0x02, 0x04, 0x04, 0x02, 0x04, 0x02,  14,  // F#m6
+    0x03, 0x01, 0x00, 0x00, 0x03, 0x00,  12,  // Gm6
+    0x04, 0x02, 0x01, 0x01, 0x04, 0x01,  17,  // G#m6
+    0x80, 0x00, 0x02, 0x02, 0x01, 0x02,  15,  // Am6
+    0x80, 0x01, 0x03, 0x00, 0x02, 0x01,  20,  // A#m6
+    0x80, 0x02, 0x00, 0x01, 0x00, 0x02,  15,  // Bm6
+    // dim7
+    0x80, 0x03, 0x01, 0x02, 0x01, 0x02,  20,  // Cdim7
+    0x80, 0x04, 0x02, 0x03, 0x02, 0x03,  22,  // C#dim7
+    0x80, 0x80, 0x00, 0x01, 0x00, 0x01,  18,  // Ddim7
+    0x80, 0x80, 0x01, 0x02, 0x01, 0x02,  23,  // D#dim7
+    0x00, 0x01, 0x02, 0x00, 0x02, 0x00,   7,  // Edim7
+    0x01, 0x02, 0x00, 0x01, 0x00, 0x01,   7,  // Fdim7
+    0x02, 0x00, 0x01, 0x02, 0x01, 0x02,   7,  // F#dim7
+    0x03, 0x01, 0x02, 0x00, 0x02, 0x00,  12,  // Gdim7
+    0x04, 0x02, 0x00, 0x01, 0x00, 0x01,  17,  // G#dim7
+    0x80, 0x00, 0x01, 0x02, 0x01, 0x02,  15,  // Adim7
+    0x80, 0x01, 0x02, 0x00, 0x02, 0x00,  15,  // A#dim7
+    0x80, 0x02, 0x00, 0x01, 0x00, 0x01,  15,  // Bdim7
+    // m7(b5)
+    0x80, 0x03, 0x01, 0x03, 0x01, 0x02,  20,  // Cm7(b5)
+    0x80, 0x04, 0x02, 0x00, 0x00, 0x00,  22,  // C#m7(b5)
+    0x80, 0x80, 0x00, 0x01, 0x01, 0x01,  18,  // Dm7(b5)
+    0x80, 0x80, 0x01, 0x02, 0x02, 0x02,  23,  // D#m7(b5)
+    0x00, 0x01, 0x00, 0x00, 0x80, 0x00,  10,  // Em7(b5)
+    0x01, 0x80, 0x01, 0x01, 0x00, 0x01,  10,  // Fm7(b5)
+    0x02, 0x00, 0x02, 0x02, 0x01, 0x00,   7,  // F#m7(b5)
+    0x03, 0x04, 0x03, 0x03, 0x80, 0x03,  19,  // Gm7(b5)
+    0x04, 0x02, 0x00, 0x04, 0x00, 0x02,  14,  // G#m7(b5)
+    0x80, 0x00, 0x01, 0x00, 0x01, 0x80,  18,  // Am7(b5)
+    0x80, 0x01, 0x02, 0x01, 0x02, 0x00,  15,  // A#m7(b5)
+    0x80, 0x02, 0x00, 0x02, 0x00, 0x01,  15,  // Bm7(b5)
+    // aug
+    0x80, 0x03, 0x02, 0x01, 0x01, 0x00,  20,  // Caug
+    0x80, 0x04, 0x03, 0x02, 0x02, 0x80,  30,  // C#aug
+    0x80, 0x80, 0x00, 0x03, 0x03, 0x02,  25,  // Daug
+    0x80, 0x80, 0x01, 0x00, 0x00, 0x80,  26,  // D#aug
+    0x00, 0x03, 0x02, 0x01, 0x01, 0x00,  12,  // Eaug
+    0x01, 0x00, 0x80, 0x02, 0x02, 0x01,  15,  // Faug
+    0x02, 0x80, 0x00, 0x03, 0x03, 0x02,  17,  // F#aug
+    0x03, 0x02, 0x01, 0x00, 0x00, 0x03,  12,  // Gaug
+    0x04, 0x03, 0x02, 0x01, 0x01, 0x80,  25,  // G#aug
+    0x80, 0x00, 0x03, 0x02, 0x02, 0x01,  20,  // Aaug
+    0x80, 0x01, 0x00, 0x03, 0x03, 0x02,  20,  // A#aug
+    0x80, 0x02, 0x01, 0x00, 0x00, 0x03,  20,  // Baug
+    // sus2
+    0x80, 0x03, 0x00, 0x00, 0x03, 0x03,  14,  // Csus2
+    0x80, 0x04, 0x01, 0x01, 0x02, 0x04,  25,  // C#sus2
+    0x80, 0x80, 0x00, 0x02, 0x03, 0x00,  25,  // Dsus2
+    0x80, 0x80, 0x01, 0x03, 0x04, 0x01,  33,  // D#sus2
+    0x00, 0x02, 0x02, 0x80, 0x00, 0x02,  12,  // Esus2
+    0x01, 0x80, 0x80, 0x00, 0x01, 0x01,  18,  // Fsus2
+    0x02, 0x04, 0x04, 0x80, 0x02, 0x04,  22,  // F#sus2
+    0x03, 0x00, 0x00, 0x00, 0x03, 0x03,   6,  // Gsus2
+    0x04, 0x01, 0x01, 0x01, 0x04, 0x04,  17,  // G#sus2
+    0x80, 0x00, 0x02, 0x02, 0x00, 0x00,  12,  // Asus2
+    0x80, 0x01, 0x03, 0x03, 0x01, 0x01,  20,  // A#sus2
+    0x80, 0x02, 0x04, 0x04, 0x02, 0x02,  22,  // Bsus2
+    // sus4
+    0x80, 0x03, 0x03, 0x00, 0x01, 0x01,  20,  // Csus4
+    0x80, 0x04, 0x04, 0x80, 0x02, 0x04,  30,  // C#sus4
+    0x80, 0x80, 0x00, 0x02, 0x03, 0x03,  25,  // Dsus4
+    0x80, 0x80, 0x01, 0x03, 0x04, 0x04,  33,  // D#sus4
+    0x00, 0x00, 0x02, 0x02, 0x00, 0x00,   4,  // Esus4
+    0x01, 0x01, 0x03, 0x03, 0x01, 0x01,  12,  // Fsus4
+    0x02, 0x02, 0x04, 0x04, 0x02, 0x02,  14,  // F#sus4
+    0x03, 0x03, 0x00, 0x00, 0x03, 0x03,   6,  // Gsus4
+    0x04, 0x04, 0x80, 0x80, 0x04, 0x04,  24,  // G#sus4
+    0x80, 0x00, 0x00, 0x02, 0x03, 0x00,  17,  // Asus4
+    0x80, 0x01, 0x01, 0x03, 0x04, 0x01,  25,  // A#sus4
+    0x80, 0x02, 0x02, 0x80, 0x00, 0x02,  20,  // Bsus4
+};
+
+static const uint8_t SHAPES_DROP_D[1008] PROGMEM = {
+    // M
+    0x80, 0x03, 0x02, 0x00, 0x01, 0x00,  20,  // CM
+    0x80, 0x04, 0x03, 0x01, 0x02, 0x01,  25,  // C#M
+    0x00, 0x00, 0x00, 0x02, 0x03, 0x02,   9,  // DM
+    0x01, 0x01, 0x01, 0x03, 0x04, 0x03,  17,  // D#M
+    0x02, 0x02, 0x02, 0x01, 0x00, 0x00,   7,  // EM
+    0x03, 0x00, 0x03, 0x02, 0x01, 0x01,  12,  // FM
+    0x04, 0x04, 0x80, 0x03, 0x02, 0x02,  22,  // F#M
+    0x00, 0x02, 0x00, 0x00, 0x00, 0x03,  29,  // GM
+    0x01, 0x03, 0x01, 0x01, 0x01, 0x04,  37,  // G#M
+    0x80, 0x00, 0x02, 0x02, 0x02, 0x00,  12,  // AM
+    0x80, 0x01, 0x00, 0x03, 0x03, 0x01,  20,  // A#M
+    0x80, 0x02, 0x04, 0x04, 0x04, 0x02,  22,  // BM
+    // m
+    0x80, 0x03, 0x01, 0x00, 0x01, 0x03,  20,  // Cm
+    0x80, 0x04, 0x02, 0x01, 0x02, 0x00,  25,  // C#m
+    0x00, 0x00, 0x00, 0x02, 0x03, 0x01,  12,  // Dm
+    0x01, 0x01, 0x01, 0x03, 0x04, 0x02,  17,  // D#m
+    0x02, 0x02, 0x02, 0x00, 0x00, 0x00,   4,  // Em
+    0x03, 0x03, 0x03, 0x01, 0x01, 0x01,  12,  // Fm
+    0x04, 0x00, 0x04, 0x02, 0x02, 0x02,  14,  // F#m
+    0x00, 0x01, 0x00, 0x00, 0x03, 0x03,  32,  // Gm
+    0x01, 0x02, 0x01, 0x01, 0x00, 0x80,  35,  // G#m
+    0x80, 0x00, 0x02, 0x02, 0x01, 0x00,  15,  // Am
+    0x80, 0x01, 0x03, 0x03, 0x02, 0x01,  20,  // A#m
+    0x80, 0x02, 0x00, 0x80, 0x00, 0x02,  20,  // Bm
+    // 7
+    0x80, 0x03, 0x02, 0x03, 0x80, 0x03,  25,  // C7
+    0x80, 0x04, 0x03, 0x04, 0x00, 0x04,  19,  // C#7
+    0x00, 0x00, 0x00, 0x02, 0x01, 0x02,   7,  // D7
+    0x01, 0x01, 0x01, 0x03, 0x02, 0x03,  12,  // D#7
+    0x02, 0x02, 0x00, 0x01, 0x00, 0x00,   7,  // E7
+    0x03, 0x00, 0x01, 0x02, 0x01, 0x01,  12,  // F7
+    0x04, 0x04, 0x02, 0x03, 0x02, 0x02,  14,  // F#7
+    0x00, 0x02, 0x00, 0x00, 0x00, 0x01,  27,  // G7
+    0x01, 0x03, 0x01, 0x01, 0x01, 0x02,  32,  // G#7
+    0x80, 0x00, 0x02, 0x00, 0x02, 0x00,  12,  // A7
+    0x80, 0x01, 0x00, 0x01, 0x80, 0x01,  18,  // A#7
+    0x80, 0x02, 0x01, 0x02, 0x00, 0x02,  15,  // B7
+    // m7
+    0x80, 0x03, 0x01, 0x03, 0x01, 0x03,  20,  // Cm7
+    0x80, 0x04, 0x02, 0x04, 0x00, 0x04,  22,  // C#m7
+    0x00, 0x00, 0x00, 0x02, 0x01, 0x01,   7,  // Dm7
+    0x01, 0x01, 0x01, 0x03, 0x02, 0x02,  12,  // D#m7
+    0x02, 0x02, 0x00, 0x00, 0x00, 0x00,   4,  // Em7
+    0x03, 0x03, 0x01, 0x01, 0x01, 0x01,  12,  // Fm7
+    0x04, 0x00, 0x02, 0x02, 0x02, 0x00,  14,  // F#m7
+    0x00, 0x01, 0x00, 0x00, 0x80, 0x01,  30,  // Gm7
+    0x01, 0x02, 0x01, 0x01, 0x80, 0x02,  35,  // G#m7
+    0x80, 0x00, 0x02, 0x00, 0x01, 0x00,  15,  // Am7
+    0x80, 0x01, 0x03, 0x01, 0x02, 0x01,  20,  // A#m7
+    0x80, 0x02, 0x00, 0x02, 0x00, 0x02,  12,  // Bm7
+    // 7M
+    0x80, 0x03, 0x02, 0x00, 0x00, 0x00,  17,  // C7M
+    0x80, 0x04, 0x03, 0x01, 0x01, 0x01,  25,  // C#7M
+    0x00, 0x00, 0x00, 0x02, 0x02, 0x02,   4,  // D7M
+    0x01, 0x01, 0x00, 0x00, 0x03, 0x03,  12,  // D#7M
+    0x02, 0x02, 0x01, 0x01, 0x00, 0x00,   7,  // E7M
+    0x03, 0x00, 0x02, 0x02, 0x01, 0x00,  12,  // F7M
+    0x04, 0x80, 0x03, 0x03, 0x02, 0x02,  22,  // F#7M
+    0x00, 0x02, 0x00, 0x00, 0x00, 0x02,  24,  // G7M
+    0x01, 0x03, 0x01, 0x01, 0x01, 0x03,  32,  // G#7M
+    0x80, 0x00, 0x02, 0x01, 0x02, 0x00,  15,  // A7M
+    0x80, 0x01, 0x00, 0x02, 0x03, 0x01,  20,  // A#7M
+    0x80, 0x02, 0x01, 0x03, 0x00, 0x02,  20,  // B7M
+    // 6
+    0x80, 0x03, 0x02, 0x02, 0x80, 0x03,  25,  // C6
+    0x80, 0x04, 0x03, 0x03, 0x80, 0x04,  27,  // C#6
+    0x00, 0x00, 0x00, 0x02, 0x00, 0x02,   4,  // D6
+    0x01, 0x01, 0x01, 0x00, 0x01, 0x80,  10,  // D#6
+    0x02, 0x02, 0x02, 0x04, 0x02, 0x04,  14,  // E6
+    0x03, 0x00, 0x00, 0x02, 0x01, 0x01,  12,  // F6
+    0x04, 0x01, 0x01, 0x03, 0x02, 0x80,  25,  // F#6
+    0x00, 0x02, 0x00, 0x00, 0x00, 0x00,  24,  // G6
+    0x01, 0x80, 0x01, 0x01, 0x01, 0x01,  30,  // G#6
+    0x80, 0x00, 0x02, 0x02, 0x02, 0x02,  12,  // A6
+    0x80, 0x01, 0x00, 0x00, 0x80, 0x01,  18,  // A#6
+    0x80, 0x02, 0x01, 0x01, 0x00, 0x02,  15,  // B6
+    // m6
+    0x80, 0x03, 0x01, 0x02, 0x01, 0x03,  20,  // Cm6
+    0x80, 0x04, 0x02, 0x03, 0x02, 0x04,  22,  // C#m6
+    0x00, 0x00, 0x00, 0x02, 0x00, 0x01,   7,  // Dm6
+    0x01, 0x01, 0x01, 0x03, 0x01, 0x02,  12,  // D#m6
+    0x02, 0x02, 0x02, 0x00, 0x02, 0x00,   4,  // Em6
+    0x03, 0x03, 0x00, 0x01, 0x01, 0x01,  12,  // Fm6
+    0x04, 0x04, 0x80, 0x02, 0x04, 0x02,  22,  // F#m6
+    0x00, 0x01, 0x00, 0x00, 0x80, 0x00,  30,  // Gm6
+    0x01, 0x80, 0x01, 0x01, 0x00, 0x01,  30,  // G#m6
+    0x80, 0x00, 0x02, 0x02, 0x01, 0x02,  15,  // Am6
+    0x80, 0x01, 0x03, 0x00, 0x02, 0x01,  20,  // A#m6
+    0x80, 0x02, 0x00, 0x01, 0x00, 0x02,  15,  // Bm6
+    // dim7
+    0x80, 0x03, 0x01, 0x02, 0x01, 0x02,  20,  // Cdim7
+    0x80, 0x04, 0x02, 0x03, 0x02, 0x03,  22,  // C#dim7
+    0x00, 0x02, 0x00, 0x01, 0x00, 0x01,   7,  // Ddim7
+    0x01, 0x03, 0x01, 0x02, 0x01, 0x02,  12,  // D#dim7
+    0x02, 0x01, 0x02, 0x00, 0x02, 0x00,   7,  // Edim7
+    0x03, 0x02, 0x00, 0x01, 0x00, 0x01,  12,  // Fdim7
+    0x04, 0x00, 0x01, 0x02, 0x01, 0x02,  17,  // F#dim7
+    0x02, 0x01, 0x02, 0x00, 0x02, 0x00,  27,  // Gdim7
+    0x00, 0x02, 0x00, 0x01, 0x00, 0x01,  27,  // G#dim7
+    0x80, 0x00, 0x01, 0x02, 0x01, 0x02,  15,  // Adim7
+    0x80, 0x01, 0x02, 0x00, 0x02, 0x00,  15,  // A#dim7
+    0x80, 0x02, 0x00, 0x01, 0x00, 0x01,  15,  // Bdim7
+    // m7(b5)
+    0x80, 0x03, 0x01, 0x03, 0x01, 0x02,  20,  // Cm7(b5)
+    0x80, 0x04, 0x02, 0x00, 0x00, 0x00,  22,  // C#m7(b5)
+    0x00, 0x80, 0x00, 0x01, 0x01, 0x01,  10,  // Dm7(b5)
+    0x01, 0x00, 0x01, 0x80, 0x02, 0x02,  15,  // D#m7(b5)
+    0x02, 0x01, 0x00, 0x00, 0x03, 0x00,  12,  // Em7(b5)
+    0x03, 0x02, 0x01, 0x01, 0x04, 0x01,  17,  // Fm7(b5)
+    0x04, 0x00, 0x02, 0x02, 0x01, 0x00,  17,  // F#m7(b5)
+    0x03, 0x04, 0x03, 0x03, 0x80, 0x03,  39,  // Gm7(b5)
+    0x00, 0x02, 0x00, 0x01, 0x00, 0x02,  27,  // G#m7(b5)
+    0x80, 0x00, 0x01, 0x00, 0x01, 0x80,  18,  // Am7(b5)
+    0x80, 0x01, 0x02, 0x01, 0x02, 0x00,  15,  // A#m7(b5)
+    0x80, 0x02, 0x00, 0x02, 0x00, 0x01,  15,  // Bm7(b5)
+    // aug
+    0x80, 0x03, 0x02, 0x01, 0x01, 0x00,  20,  // Caug
+    0x80, 0x04, 0x03, 0x02, 0x02, 0x80,  30,  // C#aug
+    0x00, 0x01, 0x00, 0x03, 0x03, 0x02,  12,  // Daug
+    0x01, 0x02, 0x01, 0x00, 0x00, 0x03,  12,  // D#aug
+    0x02, 0x80, 0x02, 0x01, 0x01, 0x00,  15,  // Eaug
+    0x03, 0x00, 0x03, 0x02, 0x02, 0x80,  17,  // Faug
+    0x04, 0x80, 0x00, 0x03, 0x03, 0x02,  22,  // F#aug
+    0x01, 0x02, 0x01, 0x00, 0x00, 0x03,  32,  // Gaug
+    0x80, 0x80, 0x80, 0x01, 0x01, 0x00,  26,  // G#aug
+    0x80, 0x00, 0x03, 0x02, 0x02, 0x01,  20,  // Aaug
+    0x80, 0x01, 0x00, 0x03, 0x03, 0x02,  20,  // A#aug
+    0x80, 0x02, 0x01, 0x00, 0x00, 0x03,  20,  // Baug
+    // sus2
+    0x80, 0x03, 0x00, 0x00, 0x03, 0x03,  14,  // Csus2
+    0x80, 0x04, 0x01, 0x01, 0x02, 0x04,  25,  // C#sus2
+    0x00, 0x00, 0x00, 0x02, 0x03, 0x00,   9,  // Dsus2
+    0x01, 0x01, 0x01, 0x03, 0x04, 0x01,  17,  // D#sus2
+    0x02, 0x02, 0x02, 0x80, 0x00, 0x02,  12,  // Esus2
+    0x03, 0x03, 0x03, 0x00, 0x01, 0x01,  12,  // Fsus2
+    0x04, 0x04, 0x04, 0x80, 0x80, 0x04,  24,  // F#sus2
+    0x00, 0x00, 0x00, 0x00, 0x03, 0x03,  26,  // Gsus2
+    0x01, 0x01, 0x01, 0x01, 0x04, 0x04,  37,  // G#sus2
+    0x80, 0x00, 0x02, 0x02, 0x00, 0x00,  12,  // Asus2
+    0x80, 0x01, 0x03, 0x03, 0x01, 0x01,  20,  // A#sus2
+    0x80, 0x02, 0x04, 0x04, 0x02, 0x02,  22,  // Bsus2
+    // sus4
+    0x80, 0x03, 0x03, 0x00, 0x01, 0x01,  20,  // Csus4
+    0x80, 0x04, 0x04, 0x80, 0x02, 0x04,  30,  // C#sus4
+    0x00, 0x00, 0x00, 0x00, 0x03, 0x03,   6,  // Dsus4
+    0x01, 0x01, 0x01, 0x01, 0x04, 0x04,  17,  // D#sus4
+    0x02, 0x00, 0x02, 0x02, 0x00, 0x00,   4,  // Esus4
+    0x03, 0x01, 0x03, 0x03, 0x01, 0x01,  12,  // Fsus4
+    0x04, 0x02, 0x04, 0x04, 0x02, 0x02,  14,  // F#sus4
+    0x00, 0x03, 0x00, 0x00, 0x03, 0x03,  26,  // Gsus4
+    0x01, 0x04, 0x01, 0x01, 0x02, 0x04,  37,  // G#sus4
+    0x80, 0x00, 0x00, 0x02, 0x03, 0x00,  17,  // Asus4
+    0x80, 0x01, 0x01, 0x03, 0x04, 0x01,  25,  // A#sus4
+    0x80, 0x02, 0x02, 0x80, 0x00, 0x02,  20,  // Bsus4
+};
+
+static const uint8_t SHAPES_OPEN_G[1008] PROGMEM = {
+    // M
+    0x02, 0x00, 0x02, 0x00, 0x01, 0x02,  27,  // CM
+    0x03, 0x01, 0x03, 0x01, 0x02, 0x80,  40,  // C#M
+    0x00, 0x02, 0x00, 0x02, 0x03, 0x04,  14,  // DM
+    0x01, 0x00, 0x01, 0x03, 0x80, 0x01,  20,  // D#M
+    0x02, 0x01, 0x02, 0x01, 0x00, 0x80,  15,  // EM
+    0x03, 0x02, 0x03, 0x80, 0x01, 0x80,  28,  // FM
+    0x04, 0x03, 0x04, 0x80, 0x02, 0x80,  30,  // F#M
+    0x80, 0x00, 0x00, 0x00, 0x00, 0x00,   8,  // GM
+    0x80, 0x01, 0x01, 0x01, 0x01, 0x01,  10,  // G#M
+    0x80, 0x02, 0x02, 0x02, 0x02, 0x02,  12,  // AM
+    0x80, 0x03, 0x00, 0x03, 0x03, 0x03,  14,  // A#M
+    0x80, 0x04, 0x04, 0x04, 0x04, 0x04,  16,  // BM
+    // m
+    0x01, 0x00, 0x01, 0x00, 0x01, 0x01,  22,  // Cm
+    0x02, 0x01, 0x02, 0x01, 0x02, 0x80,  35,  // C#m
+    0x00, 0x02, 0x00, 0x02, 0x03, 0x03,   9,  // Dm
+    0x01, 0x03, 0x01, 0x03, 0x80, 0x04,  25,  // D#m
+    0x02, 0x00, 0x02, 0x00, 0x00, 0x02,   4,  // Em
+    0x03, 0x01, 0x03, 0x01, 0x01, 0x03,  12,  // Fm
+    0x04, 0x02, 0x04, 0x02, 0x02, 0x04,  14,  // F#m
+    0x80, 0x00, 0x00, 0x03, 0x03, 0x00,  14,  // Gm
+    0x80, 0x01, 0x01, 0x01, 0x00, 0x01,  10,  // G#m
+    0x80, 0x02, 0x02, 0x02, 0x01, 0x80,  23,  // Am
+    0x80, 0x03, 0x03, 0x03, 0x02, 0x80,  25,  // A#m
+    0x80, 0x04, 0x00, 0x04, 0x00, 0x04,  16,  // Bm
+    // 7
+    0x02, 0x00, 0x02, 0x03, 0x01, 0x80,  40,  // C7
+    0x03, 0x01, 0x80, 0x04, 0x02, 0x80,  53,  // C#7
+    0x00, 0x02, 0x00, 0x02, 0x01, 0x04,  17,  // D7
+    0x01, 0x00, 0x01, 0x03, 0x02, 0x80,  20,  // D#7
+    0x02, 0x01, 0x00, 0x01, 0x00, 0x00,   7,  // E7
+    0x03, 0x02, 0x01, 0x02, 0x01, 0x01,  12,  // F7
+    0x04, 0x03, 0x02, 0x03, 0x02, 0x02,  14,  // F#7
+    0x80, 0x00, 0x00, 0x00, 0x00, 0x03,  14,  // G7
+    0x80, 0x01, 0x01, 0x01, 0x01, 0x04,  25,  // G#7
+    0x80, 0x02, 0x02, 0x00, 0x02, 0x02,  12,  // A7
+    0x80, 0x03, 0x00, 0x01, 0x03, 0x03,  20,  // A#7
+    0x80, 0x04, 0x01, 0x02, 0x00, 0x04,  25,  // B7
+    // m7
+    0x01, 0x00, 0x01, 0x03, 0x01, 0x80,  40,  // Cm7
+    0x02, 0x01, 0x80, 0x04, 0x02, 0x80,  53,  // C#m7
+    0x00, 0x02, 0x00, 0x02, 0x01, 0x03,  12,  // Dm7
+    0x01, 0x03, 0x01, 0x80, 0x02, 0x04,  25,  // D#m7
+    0x02, 0x00, 0x00, 0x00, 0x00, 0x00,   4,  // Em7
+    0x03, 0x01, 0x01, 0x01, 0x01, 0x01,  12,  // Fm7
+    0x04, 0x02, 0x02, 0x02, 0x02, 0x02,  14,  // F#m7
+    0x80, 0x00, 0x00, 0x03, 0x03, 0x03,  14,  // Gm7
+    0x80, 0x01, 0x01, 0x01, 0x00, 0x04,  25,  // G#m7
+    0x80, 0x02, 0x02, 0x00, 0x01, 0x02,  15,  // Am7
+    0x80, 0x03, 0x03, 0x01, 0x02, 0x80,  28,  // A#m7
+    0x80, 0x04, 0x00, 0x02, 0x00, 0x04,  22,  // Bm7
+    // 7M
+    0x02, 0x00, 0x02, 0x04, 0x01, 0x80,  45,  // C7M
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // C#7M
+    0x00, 0x02, 0x00, 0x02, 0x02, 0x04,  14,  // D7M
+    0x01, 0x00, 0x00, 0x03, 0x03, 0x00,  12,  // D#7M
+    0x02, 0x01, 0x01, 0x01, 0x00, 0x80,  15,  // E7M
+    0x03, 0x02, 0x02, 0x80, 0x01, 0x80,  28,  // F7M
+    0x04, 0x03, 0x03, 0x80, 0x02, 0x80,  30,  // F#7M
+    0x80, 0x00, 0x00, 0x00, 0x00, 0x04,  16,  // G7M
+    0x80, 0x01, 0x01, 0x00, 0x01, 0x01,  10,  // G#7M
+    0x80, 0x02, 0x02, 0x01, 0x02, 0x80,  23,  // A7M
+    0x80, 0x03, 0x00, 0x02, 0x03, 0x03,  17,  // A#7M
+    0x80, 0x04, 0x01, 0x03, 0x00, 0x04,  25,  // B7M
+    // 6
+    0x02, 0x00, 0x02, 0x02, 0x01, 0x80,  35,  // C6
+    0x03, 0x01, 0x80, 0x03, 0x02, 0x80,  48,  // C#6
+    0x00, 0x02, 0x00, 0x02, 0x00, 0x04,  14,  // D6
+    0x01, 0x00, 0x01, 0x03, 0x01, 0x80,  20,  // D#6
+    0x02, 0x01, 0x80, 0x04, 0x02, 0x80,  33,  // E6
+    0x03, 0x02, 0x00, 0x02, 0x01, 0x00,  12,  // F6
+    0x04, 0x03, 0x01, 0x80, 0x02, 0x01,  25,  // F#6
+    0x80, 0x00, 0x00, 0x00, 0x00, 0x02,  12,  // G6
+    0x80, 0x01, 0x01, 0x01, 0x01, 0x03,  20,  // G#6
+    0x80, 0x02, 0x02, 0x02, 0x02, 0x04,  22,  // A6
+    0x80, 0x03, 0x00, 0x00, 0x03, 0x03,  14,  // A#6
+    0x80, 0x04, 0x01, 0x01, 0x00, 0x04,  25,  // B6
+    // m6
+    0x01, 0x00, 0x01, 0x02, 0x01, 0x80,  35,  // Cm6
+    0x02, 0x01, 0x80, 0x03, 0x02, 0x80,  48,  // C#m6
+    0x00, 0x02, 0x00, 0x02, 0x00, 0x03,   9,  // Dm6
+    0x01, 0x03, 0x01, 0x03, 0x01, 0x04,  17,  // D#m6
+    0x02, 0x00, 0x02, 0x04, 0x02, 0x80,  22,  // Em6
+    0x03, 0x01, 0x00, 0x01, 0x01, 0x00,  12,  // Fm6
+    0x04, 0x02, 0x01, 0x80, 0x02, 0x01,  25,  // F#m6
+    0x80, 0x00, 0x00, 0x03, 0x03, 0x02,  17,  // Gm6
+    0x80, 0x01, 0x01, 0x01, 0x00, 0x03,  20,  // G#m6
+    0x80, 0x02, 0x02, 0x80, 0x01, 0x04,  33,  // Am6
+    0x80, 0x03, 0x03, 0x00, 0x02, 0x03,  17,  // A#m6
+    0x80, 0x04, 0x00, 0x01, 0x00, 0x04,  25,  // Bm6
+    // dim7
+    0x01, 0x02, 0x01, 0x02, 0x01, 0x04,  37,  // Cdim7
+    0x02, 0x00, 0x02, 0x03, 0x02, 0x80,  37,  // C#dim7
+    0x00, 0x01, 0x00, 0x01, 0x00, 0x03,  12,  // Ddim7
+    0x01, 0x02, 0x01, 0x02, 0x01, 0x04,  17,  // D#dim7
+    0x02, 0x00, 0x02, 0x03, 0x02, 0x80,  17,  // Edim7
+    0x03, 0x01, 0x00, 0x01, 0x00, 0x00,  12,  // Fdim7
+    0x04, 0x02, 0x01, 0x02, 0x01, 0x01,  17,  // F#dim7
+    0x80, 0x00, 0x02, 0x03, 0x02, 0x02,  17,  // Gdim7
+    0x80, 0x01, 0x00, 0x01, 0x00, 0x03,  20,  // G#dim7
+    0x80, 0x02, 0x01, 0x02, 0x01, 0x04,  25,  // Adim7
+    0x80, 0x03, 0x02, 0x00, 0x02, 0x02,  17,  // A#dim7
+    0x80, 0x04, 0x00, 0x01, 0x00, 0x03,  25,  // Bdim7
+    // m7(b5)
+    0x01, 0x03, 0x01, 0x03, 0x01, 0x04,  37,  // Cm7(b5)
+    0x02, 0x00, 0x02, 0x04, 0x02, 0x80,  42,  // C#m7(b5)
+    0x00, 0x01, 0x00, 0x01, 0x01, 0x03,  12,  // Dm7(b5)
+    0x01, 0x02, 0x01, 0x80, 0x02, 0x04,  25,  // D#m7(b5)
+    0x02, 0x00, 0x00, 0x03, 0x03, 0x00,   9,  // Em7(b5)
+    0x03, 0x01, 0x01, 0x04, 0x04, 0x01,  17,  // Fm7(b5)
+    0x04, 0x02, 0x02, 0x80, 0x01, 0x80,  33,  // F#m7(b5)
+    0x80, 0x00, 0x03, 0x03, 0x02, 0x03,  17,  // Gm7(b5)
+    0x80, 0x01, 0x00, 0x01, 0x00, 0x04,  25,  // G#m7(b5)
+    0x80, 0x02, 0x01, 0x00, 0x01, 0x01,  15,  // Am7(b5)
+    0x80, 0x03, 0x02, 0x01, 0x02, 0x80,  28,  // A#m7(b5)
+    0x80, 0x04, 0x00, 0x02, 0x00, 0x03,  22,  // Bm7(b5)
+    // aug
+    0x02, 0x01, 0x02, 0x01, 0x01, 0x02,  27,  // Caug
+    0x03, 0x02, 0x03, 0x02, 0x02, 0x03,  29,  // C#aug
+    0x00, 0x03, 0x00, 0x03, 0x03, 0x04,  11,  // Daug
+    0x01, 0x00, 0x01, 0x00, 0x00, 0x01,   2,  // D#aug
+    0x02, 0x01, 0x02, 0x01, 0x01, 0x02,   7,  // Eaug
+    0x03, 0x02, 0x03, 0x02, 0x02, 0x03,   9,  // Faug
+    0x04, 0x03, 0x00, 0x03, 0x03, 0x00,  11,  // F#aug
+    0x80, 0x00, 0x01, 0x00, 0x00, 0x01,  10,  // Gaug
+    0x80, 0x01, 0x02, 0x01, 0x01, 0x02,  15,  // G#aug
+    0x80, 0x02, 0x03, 0x02, 0x02, 0x03,  17,  // Aaug
+    0x80, 0x03, 0x00, 0x03, 0x03, 0x04,  19,  // A#aug
+    0x01, 0x00, 0x01, 0x00, 0x00, 0x01,  22,  // Baug
+    // sus2
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x00,  22,  // Csus2
+    0x01, 0x01, 0x01, 0x01, 0x02, 0x01,  27,  // C#sus2
+    0x00, 0x02, 0x00, 0x02, 0x03, 0x02,   9,  // Dsus2
+    0x01, 0x03, 0x01, 0x03, 0x80, 0x03,  20,  // D#sus2
+    0x02, 0x04, 0x02, 0x04, 0x80, 0x04,  22,  // Esus2
+    0x03, 0x00, 0x03, 0x00, 0x01, 0x03,  12,  // Fsus2
+    0x04, 0x01, 0x04, 0x01, 0x02, 0x80,  25,  // F#sus2
+    0x80, 0x00, 0x00, 0x02, 0x03, 0x00,  17,  // Gsus2
+    0x80, 0x01, 0x01, 0x03, 0x04, 0x01,  25,  // G#sus2
+    0x80, 0x02, 0x02, 0x02, 0x00, 0x02,  12,  // Asus2
+    0x80, 0x03, 0x03, 0x03, 0x01, 0x80,  28,  // A#sus2
+    0x80, 0x04, 0x04, 0x04, 0x02, 0x80,  30,  // Bsus2
+    // sus4
+    0x03, 0x00, 0x03, 0x00, 0x01, 0x03,  32,  // Csus4
+    0x04, 0x01, 0x04, 0x01, 0x02, 0x80,  45,  // C#sus4
+    0x00, 0x00, 0x00, 0x02, 0x03, 0x00,   9,  // Dsus4
+    0x01, 0x01, 0x01, 0x03, 0x04, 0x01,  17,  // D#sus4
+    0x02, 0x02, 0x02, 0x02, 0x00, 0x80,  12,  // Esus4
+    0x03, 0x03, 0x03, 0x80, 0x01, 0x80,  28,  // Fsus4
+    0x04, 0x04, 0x04, 0x80, 0x02, 0x80,  30,  // F#sus4
+    0x80, 0x00, 0x00, 0x00, 0x01, 0x00,  10,  // Gsus4
+    0x80, 0x01, 0x01, 0x01, 0x02, 0x01,  15,  // G#sus4
+    0x80, 0x02, 0x00, 0x02, 0x03, 0x02,  17,  // Asus4
+    0x80, 0x03, 0x03, 0x03, 0x04, 0x03,  19,  // A#sus4
+    0x80, 0x04, 0x02, 0x04, 0x00, 0x04,  22,  // Bsus4
+};
+
+static const uint8_t SHAPES_DADGAD[1008] PROGMEM = {
+    // M
+    0x80, 0x03, 0x02, 0x00, 0x03, 0x02,  17,  // CM
+    0x80, 0x04, 0x03, 0x01, 0x04, 0x80,  33,  // C#M
+    0x00, 0x00, 0x00, 0x02, 0x00, 0x04,  14,  // DM
+    0x01, 0x01, 0x01, 0x00, 0x01, 0x80,  10,  // D#M
+    0x02, 0x02, 0x02, 0x01, 0x80, 0x80,  23,  // EM
+    0x03, 0x00, 0x03, 0x80, 0x03, 0x03,  14,  // FM
+    0x04, 0x04, 0x04, 0x03, 0x80, 0x80,  27,  // F#M
+    0x00, 0x02, 0x00, 0x00, 0x02, 0x00,  24,  // GM
+    0x01, 0x03, 0x01, 0x01, 0x03, 0x01,  32,  // G#M
+    0x80, 0x00, 0x02, 0x02, 0x04, 0x02,  22,  // AM
+    0x80, 0x01, 0x00, 0x03, 0x01, 0x03,  20,  // A#M
+    0x80, 0x02, 0x01, 0x04, 0x80, 0x04,  33,  // BM
+    // m
+    0x80, 0x03, 0x01, 0x00, 0x03, 0x01,  20,  // Cm
+    0x80, 0x04, 0x02, 0x01, 0x04, 0x80,  33,  // C#m
+    0x00, 0x00, 0x00, 0x02, 0x00, 0x03,   9,  // Dm
+    0x01, 0x01, 0x01, 0x03, 0x01, 0x04,  17,  // D#m
+    0x02, 0x02, 0x02, 0x00, 0x02, 0x80,  12,  // Em
+    0x03, 0x03, 0x03, 0x01, 0x80, 0x80,  28,  // Fm
+    0x04, 0x00, 0x04, 0x80, 0x04, 0x04,  16,  // F#m
+    0x00, 0x01, 0x00, 0x00, 0x01, 0x00,  22,  // Gm
+    0x01, 0x02, 0x01, 0x01, 0x02, 0x01,  27,  // G#m
+    0x80, 0x00, 0x02, 0x02, 0x03, 0x02,  17,  // Am
+    0x03, 0x04, 0x03, 0x03, 0x04, 0x03,  31,  // A#m
+    0x80, 0x02, 0x00, 0x04, 0x02, 0x04,  22,  // Bm
+    // 7
+    0x80, 0x03, 0x02, 0x00, 0x01, 0x02,  20,  // C7
+    0x80, 0x04, 0x03, 0x01, 0x02, 0x80,  33,  // C#7
+    0x00, 0x00, 0x00, 0x02, 0x03, 0x04,  14,  // D7
+    0x01, 0x01, 0x01, 0x00, 0x04, 0x80,  25,  // D#7
+    0x02, 0x02, 0x00, 0x01, 0x02, 0x00,   7,  // E7
+    0x03, 0x00, 0x01, 0x02, 0x03, 0x01,  12,  // F7
+    0x04, 0x04, 0x02, 0x03, 0x80, 0x02,  22,  // F#7
+    0x00, 0x02, 0x00, 0x00, 0x02, 0x03,  29,  // G7
+    0x01, 0x03, 0x01, 0x01, 0x03, 0x04,  37,  // G#7
+    0x80, 0x00, 0x02, 0x00, 0x04, 0x02,  22,  // A7
+    0x80, 0x01, 0x00, 0x01, 0x01, 0x03,  20,  // A#7
+    0x80, 0x02, 0x01, 0x02, 0x00, 0x04,  25,  // B7
+    // m7
+    0x80, 0x03, 0x01, 0x00, 0x01, 0x01,  20,  // Cm7
+    0x80, 0x04, 0x02, 0x01, 0x02, 0x80,  33,  // C#m7
+    0x00, 0x00, 0x00, 0x02, 0x03, 0x03,   9,  // Dm7
+    0x01, 0x01, 0x01, 0x03, 0x04, 0x04,  17,  // D#m7
+    0x02, 0x02, 0x00, 0x00, 0x02, 0x00,   4,  // Em7
+    0x03, 0x03, 0x01, 0x01, 0x03, 0x01,  12,  // Fm7
+    0x04, 0x00, 0x02, 0x02, 0x04, 0x02,  14,  // F#m7
+    0x00, 0x01, 0x00, 0x00, 0x01, 0x03,  32,  // Gm7
+    0x01, 0x02, 0x01, 0x01, 0x02, 0x04,  37,  // G#m7
+    0x80, 0x00, 0x02, 0x00, 0x03, 0x02,  17,  // Am7
+    0x80, 0x01, 0x03, 0x01, 0x04, 0x03,  25,  // A#m7
+    0x80, 0x02, 0x00, 0x02, 0x00, 0x04,  22,  // Bm7
+    // 7M
+    0x80, 0x03, 0x02, 0x00, 0x02, 0x02,  17,  // C7M
+    0x80, 0x04, 0x03, 0x01, 0x03, 0x80,  33,  // C#7M
+    0x00, 0x00, 0x00, 0x02, 0x04, 0x04,  14,  // D7M
+    0x01, 0x01, 0x00, 0x00, 0x01, 0x00,   2,  // D#7M
+    0x02, 0x02, 0x01, 0x01, 0x02, 0x01,   7,  // E7M
+    0x03, 0x00, 0x02, 0x02, 0x03, 0x02,   9,  // F7M
+    0x04, 0x04, 0x03, 0x03, 0x04, 0x03,  11,  // F#7M
+    0x00, 0x02, 0x00, 0x00, 0x02, 0x04,  34,  // G7M
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // G#7M
+    0x80, 0x00, 0x02, 0x01, 0x04, 0x02,  25,  // A7M
+    0x80, 0x01, 0x00, 0x02, 0x00, 0x03,  20,  // A#7M
+    0x80, 0x02, 0x01, 0x03, 0x01, 0x04,  25,  // B7M
+    // 6
+    0x80, 0x03, 0x02, 0x00, 0x00, 0x02,  17,  // C6
+    0x80, 0x04, 0x03, 0x01, 0x01, 0x03,  25,  // C#6
+    0x00, 0x00, 0x00, 0x04, 0x00, 0x04,   8,  // D6
+    0x01, 0x01, 0x01, 0x00, 0x03, 0x80,  20,  // D#6
+    0x02, 0x02, 0x80, 0x01, 0x04, 0x80,  33,  // E6
+    0x03, 0x00, 0x00, 0x02, 0x03, 0x00,   9,  // F6
+    0x04, 0x01, 0x01, 0x03, 0x04, 0x01,  17,  // F#6
+    0x00, 0x02, 0x00, 0x00, 0x02, 0x02,  24,  // G6
+    0x01, 0x03, 0x01, 0x01, 0x03, 0x03,  32,  // G#6
+    0x80, 0x00, 0x02, 0x02, 0x04, 0x04,  22,  // A6
+    0x80, 0x01, 0x00, 0x00, 0x01, 0x03,  20,  // A#6
+    0x80, 0x02, 0x01, 0x01, 0x02, 0x04,  25,  // B6
+    // m6
+    0x80, 0x03, 0x01, 0x00, 0x00, 0x01,  20,  // Cm6
+    0x80, 0x04, 0x02, 0x01, 0x01, 0x02,  25,  // C#m6
+    0x00, 0x00, 0x00, 0x02, 0x02, 0x03,   9,  // Dm6
+    0x01, 0x01, 0x01, 0x03, 0x03, 0x04,  17,  // D#m6
+    0x02, 0x02, 0x02, 0x00, 0x04, 0x80,  22,  // Em6
+    0x03, 0x03, 0x00, 0x01, 0x03, 0x00,  12,  // Fm6
+    0x04, 0x00, 0x01, 0x02, 0x04, 0x01,  17,  // F#m6
+    0x00, 0x01, 0x00, 0x00, 0x01, 0x02,  27,  // Gm6
+    0x01, 0x02, 0x01, 0x01, 0x02, 0x03,  32,  // G#m6
+    0x80, 0x00, 0x02, 0x02, 0x03, 0x04,  22,  // Am6
+    0x80, 0x01, 0x03, 0x00, 0x04, 0x03,  25,  // A#m6
+    0x80, 0x02, 0x00, 0x01, 0x02, 0x04,  25,  // Bm6
+    // dim7
+    0x80, 0x03, 0x01, 0x02, 0x00, 0x04,  25,  // Cdim7
+    0x80, 0x04, 0x02, 0x00, 0x01, 0x02,  25,  // C#dim7
+    0x00, 0x02, 0x00, 0x01, 0x02, 0x03,  12,  // Ddim7
+    0x01, 0x00, 0x01, 0x80, 0x03, 0x04,  25,  // D#dim7
+    0x02, 0x01, 0x02, 0x00, 0x04, 0x80,  25,  // Edim7
+    0x03, 0x02, 0x00, 0x01, 0x02, 0x00,  12,  // Fdim7
+    0x04, 0x00, 0x01, 0x02, 0x03, 0x01,  17,  // F#dim7
+    0x02, 0x01, 0x02, 0x00, 0x04, 0x80,  45,  // Gdim7
+    0x00, 0x02, 0x00, 0x01, 0x02, 0x03,  32,  // G#dim7
+    0x80, 0x00, 0x01, 0x02, 0x03, 0x04,  25,  // Adim7
+    0x80, 0x01, 0x02, 0x00, 0x04, 0x02,  25,  // A#dim7
+    0x80, 0x02, 0x00, 0x01, 0x02, 0x03,  20,  // Bdim7
+    // m7(b5)
+    0x80, 0x03, 0x01, 0x03, 0x01, 0x04,  25,  // Cm7(b5)
+    0x80, 0x04, 0x02, 0x00, 0x02, 0x02,  22,  // C#m7(b5)
+    0x00, 0x03, 0x00, 0x01, 0x03, 0x03,  12,  // Dm7(b5)
+    0x01, 0x00, 0x01, 0x80, 0x04, 0x04,  25,  // D#m7(b5)
+    0x02, 0x01, 0x00, 0x00, 0x01, 0x00,   7,  // Em7(b5)
+    0x03, 0x02, 0x01, 0x01, 0x02, 0x01,  12,  // Fm7(b5)
+    0x04, 0x00, 0x02, 0x02, 0x03, 0x02,  14,  // F#m7(b5)
+    0x03, 0x01, 0x03, 0x00, 0x04, 0x80,  45,  // Gm7(b5)
+    0x00, 0x02, 0x00, 0x01, 0x02, 0x04,  37,  // G#m7(b5)
+    0x80, 0x00, 0x01, 0x00, 0x03, 0x01,  20,  // Am7(b5)
+    0x80, 0x01, 0x02, 0x01, 0x04, 0x02,  25,  // A#m7(b5)
+    0x80, 0x02, 0x00, 0x02, 0x00, 0x03,  17,  // Bm7(b5)
+    // aug
+    0x80, 0x03, 0x02, 0x01, 0x03, 0x80,  28,  // Caug
+    0x80, 0x04, 0x03, 0x02, 0x00, 0x03,  22,  // C#aug
+    0x00, 0x01, 0x00, 0x03, 0x01, 0x04,  17,  // Daug
+    0x01, 0x02, 0x01, 0x00, 0x02, 0x80,  15,  // D#aug
+    0x02, 0x03, 0x02, 0x01, 0x80, 0x80,  28,  // Eaug
+    0x03, 0x00, 0x03, 0x80, 0x04, 0x03,  19,  // Faug
+    0x04, 0x01, 0x00, 0x03, 0x01, 0x00,  17,  // F#aug
+    0x80, 0x80, 0x80, 0x00, 0x02, 0x01,  31,  // Gaug
+    0x80, 0x80, 0x80, 0x01, 0x03, 0x02,  36,  // G#aug
+    0x80, 0x00, 0x03, 0x02, 0x04, 0x03,  22,  // Aaug
+    0x80, 0x01, 0x00, 0x03, 0x01, 0x04,  25,  // A#aug
+    0x80, 0x02, 0x01, 0x00, 0x02, 0x01,  15,  // Baug
+    // sus2
+    0x80, 0x03, 0x00, 0x00, 0x03, 0x00,  14,  // Csus2
+    0x80, 0x04, 0x01, 0x01, 0x04, 0x01,  25,  // C#sus2
+    0x00, 0x00, 0x00, 0x02, 0x00, 0x02,   4,  // Dsus2
+    0x01, 0x01, 0x01, 0x03, 0x01, 0x03,  12,  // D#sus2
+    0x02, 0x02, 0x02, 0x04, 0x02, 0x04,  14,  // Esus2
+    0x03, 0x03, 0x03, 0x00, 0x03, 0x80,  14,  // Fsus2
+    0x04, 0x04, 0x04, 0x01, 0x80, 0x80,  33,  // F#sus2
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  20,  // Gsus2
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01,  22,  // G#sus2
+    0x80, 0x00, 0x02, 0x02, 0x02, 0x02,  12,  // Asus2
+    0x03, 0x03, 0x03, 0x03, 0x03, 0x03,  26,  // A#sus2
+    0x04, 0x04, 0x04, 0x04, 0x04, 0x04,  28,  // Bsus2
+    // sus4
+    0x80, 0x03, 0x03, 0x00, 0x03, 0x03,  14,  // Csus4
+    0x80, 0x04, 0x04, 0x01, 0x04, 0x80,  33,  // C#sus4
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   0,  // Dsus4
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01,   2,  // D#sus4
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02,   4,  // Esus4
+    0x03, 0x03, 0x03, 0x03, 0x03, 0x03,   6,  // Fsus4
+    0x04, 0x04, 0x04, 0x04, 0x04, 0x04,   8,  // F#sus4
+    0x00, 0x03, 0x00, 0x00, 0x03, 0x00,  26,  // Gsus4
+    0x01, 0x04, 0x01, 0x01, 0x04, 0x01,  37,  // G#sus4
+    0x80, 0x00, 0x00, 0x02, 0x00, 0x02,  12,  // Asus4
+    0x80, 0x01, 0x01, 0x03, 0x01, 0x03,  20,  // A#sus4
+    0x80, 0x02, 0x02, 0x04, 0x02, 0x04,  22,  // Bsus4
+};
+
+static const uint8_t SHAPES_UKULELE[720] PROGMEM = {
+    // M
+    0x00, 0x00, 0x00, 0x03,   6,  // CM
+    0x01, 0x01, 0x01, 0x80,  10,  // C#M
+    0x02, 0x02, 0x02, 0x00,   4,  // DM
+    0x00, 0x03, 0x03, 0x01,  12,  // D#M
+    0x04, 0x04, 0x04, 0x02,  14,  // EM
+    0x02, 0x80, 0x01, 0x03,  20,  // FM
+    0x03, 0x80, 0x02, 0x04,  22,  // F#M
+    0x00, 0x02, 0x03, 0x02,  29,  // GM
+    0x01, 0x03, 0x04, 0x03,  37,  // G#M
+    0x02, 0x01, 0x00, 0x00,  27,  // AM
+    0x03, 0x02, 0x01, 0x01,  32,  // A#M
+    0x04, 0x03, 0x02, 0x02,  34,  // BM
+    // m
+    0x00, 0x03, 0x03, 0x03,  26,  // Cm
+    0x01, 0x01, 0x00, 0x80,  10,  // C#m
+    0x02, 0x02, 0x01, 0x00,   7,  // Dm
+    0x03, 0x03, 0x02, 0x01,  12,  // D#m
+    0x00, 0x80, 0x00, 0x02,  12,  // Em
+    0x01, 0x80, 0x01, 0x03,  20,  // Fm
+    0x02, 0x80, 0x02, 0x04,  22,  // F#m
+    0x00, 0x02, 0x03, 0x01,  32,  // Gm
+    0x04, 0x03, 0x04, 0x02,  34,  // G#m
+    0x02, 0x00, 0x00, 0x00,  24,  // Am
+    0x80, 0x01, 0x01, 0x01,  30,  // A#m
+    0x80, 0x02, 0x02, 0x02,  32,  // Bm
+    // 7
+    0x00, 0x00, 0x00, 0x01,   2,  // C7
+    0x01, 0x01, 0x01, 0x02,   7,  // C#7
+    0x02, 0x02, 0x02, 0x03,   9,  // D7
+    0x03, 0x03, 0x03, 0x04,  11,  // D#7
+    0x01, 0x02, 0x00, 0x02,  27,  // E7
+    0x02, 0x03, 0x01, 0x03,  32,  // F7
+    0x03, 0x04, 0x02, 0x04,  34,  // F#7
+    0x00, 0x02, 0x01, 0x02,  27,  // G7
+    0x01, 0x03, 0x02, 0x03,  32,  // G#7
+    0x00, 0x01, 0x00, 0x00,  22,  // A7
+    0x01, 0x02, 0x01, 0x01,  27,  // A#7
+    0x02, 0x03, 0x02, 0x02,  29,  // B7
+    // m7
+    0x03, 0x03, 0x03, 0x03,  26,  // Cm7
+    0x01, 0x01, 0x00, 0x02,   7,  // C#m7
+    0x02, 0x02, 0x01, 0x03,  12,  // Dm7
+    0x03, 0x03, 0x02, 0x04,  14,  // D#m7
+    0x00, 0x02, 0x00, 0x02,  24,  // Em7
+    0x01, 0x03, 0x01, 0x03,  32,  // Fm7
+    0x02, 0x04, 0x02, 0x04,  34,  // F#m7
+    0x00, 0x02, 0x01, 0x01,  27,  // Gm7
+    0x01, 0x03, 0x02, 0x02,  32,  // G#m7
+    0x00, 0x00, 0x00, 0x00,  20,  // Am7
+    0x01, 0x01, 0x01, 0x01,  22,  // A#m7
+    0x02, 0x02, 0x02, 0x02,  24,  // Bm7
+    // 7M
+    0x00, 0x00, 0x00, 0x02,   4,  // C7M
+    0x01, 0x01, 0x01, 0x03,  12,  // C#7M
+    0x02, 0x02, 0x02, 0x04,  14,  // D7M
+    0xFF, 0x00, 0x00, 0x00, 0x00,  // D#7M
+    0x01, 0x03, 0x00, 0x02,  32,  // E7M
+    0x02, 0x04, 0x01, 0x03,  37,  // F7M
+    0xFF, 0x00, 0x00, 0x00, 0x00,  // F#7M
+    0x00, 0x02, 0x02, 0x02,  24,  // G7M
+    0x00, 0x03, 0x04, 0x03,  31,  // G#7M
+    0x01, 0x01, 0x00, 0x00,  22,  // A7M
+    0x02, 0x02, 0x01, 0x01,  27,  // A#7M
+    0x03, 0x03, 0x02, 0x02,  29,  // B7M
+    // 6
+    0x00, 0x00, 0x00, 0x00,   0,  // C6
+    0x01, 0x01, 0x01, 0x01,   2,  // C#6
+    0x02, 0x02, 0x02, 0x02,   4,  // D6
+    0x03, 0x03, 0x03, 0x03,   6,  // D#6
+    0x04, 0x04, 0x04, 0x04,   8,  // E6
+    0x02, 0x02, 0x01, 0x03,  32,  // F6
+    0x03, 0x03, 0x02, 0x04,  34,  // F#6
+    0x00, 0x02, 0x00, 0x02,  24,  // G6
+    0x01, 0x03, 0x01, 0x03,  32,  // G#6
+    0x02, 0x04, 0x02, 0x04,  34,  // A6
+    0x00, 0x02, 0x01, 0x01,  27,  // A#6
+    0x01, 0x03, 0x02, 0x02,  32,  // B6
+    // m6
+    0x02, 0x03, 0x03, 0x03,  29,  // Cm6
+    0x01, 0x01, 0x00, 0x01,   2,  // C#m6
+    0x02, 0x02, 0x01, 0x02,   7,  // Dm6
+    0x03, 0x03, 0x02, 0x03,   9,  // D#m6
+    0x04, 0x04, 0x03, 0x04,  11,  // Em6
+    0x01, 0x02, 0x01, 0x03,  32,  // Fm6
+    0x02, 0x03, 0x02, 0x04,  34,  // F#m6
+    0x00, 0x02, 0x00, 0x01,  27,  // Gm6
+    0x01, 0x03, 0x01, 0x02,  32,  // G#m6
+    0x02, 0x04, 0x02, 0x03,  34,  // Am6
+    0x00, 0x01, 0x01, 0x01,  22,  // A#m6
+    0x01, 0x02, 0x02, 0x02,  27,  // Bm6
+    // dim7
+    0x02, 0x03, 0x02, 0x03,  29,  // Cdim7
+    0x00, 0x01, 0x00, 0x01,   2,  // C#dim7
+    0x01, 0x02, 0x01, 0x02,   7,  // Ddim7
+    0x02, 0x03, 0x02, 0x03,   9,  // D#dim7
+    0x03, 0x04, 0x03, 0x04,  11,  // Edim7
+    0x01, 0x02, 0x01, 0x02,  27,  // Fdim7
+    0x02, 0x03, 0x02, 0x03,  29,  // F#dim7
+    0x00, 0x01, 0x00, 0x01,  22,  // Gdim7
+    0x01, 0x02, 0x01, 0x02,  27,  // G#dim7
+    0x02, 0x03, 0x02, 0x03,  29,  // Adim7
+    0x00, 0x01, 0x00, 0x01,  22,  // A#dim7
+    0x01, 0x02, 0x01, 0x02,  27,  // Bdim7
+    // m7(b5)
+    0x03, 0x03, 0x02, 0x03,  29,  // Cm7(b5)
+    0x00, 0x01, 0x00, 0x02,   7,  // C#m7(b5)
+    0x01, 0x02, 0x01, 0x03,  12,  // Dm7(b5)
+    0x02, 0x03, 0x02, 0x04,  14,  // D#m7(b5)
+    0x00, 0x02, 0x00, 0x01,  27,  // Em7(b5)
+    0x01, 0x03, 0x01, 0x02,  32,  // Fm7(b5)
+    0x02, 0x04, 0x02, 0x03,  34,  // F#m7(b5)
+    0x00, 0x01, 0x01, 0x01,  22,  // Gm7(b5)
+    0x01, 0x02, 0x02, 0x02,  27,  // G#m7(b5)
+    0x02, 0x03, 0x03, 0x03,  29,  // Am7(b5)
+    0x01, 0x01, 0x00, 0x01,  22,  // A#m7(b5)
+    0x02, 0x02, 0x01, 0x02,  27,  // Bm7(b5)
+    // aug
+    0x01, 0x00, 0x00, 0x80,  10,  // Caug
+    0x02, 0x01, 0x01, 0x00,   7,  // C#aug
+    0x03, 0x02, 0x02, 0x01,  12,  // Daug
+    0x00, 0x03, 0x03, 0x02,   9,  // D#aug
+    0x01, 0x04, 0x00, 0x03,  17,  // Eaug
+    0x02, 0x80, 0x01, 0x04,  25,  // Faug
+    0x03, 0x02, 0x02, 0x01,  32,  // F#aug
+    0x00, 0x03, 0x03, 0x02,  29,  // Gaug
+    0x01, 0x00, 0x00, 0x80,  30,  // G#aug
+    0x02, 0x01, 0x01, 0x00,  27,  // Aaug
+    0x03, 0x02, 0x02, 0x01,  32,  // A#aug
+    0x00, 0x03, 0x03, 0x02,  29,  // Baug
+    // sus2
+    0x00, 0x02, 0x03, 0x03,  29,  // Csus2
+    0x01, 0x03, 0x04, 0x04,  37,  // C#sus2
+    0x02, 0x02, 0x00, 0x00,   4,  // Dsus2
+    0x03, 0x03, 0x01, 0x01,  12,  // D#sus2
+    0x04, 0x04, 0x02, 0x02,  14,  // Esus2
+    0x00, 0x80, 0x01, 0x03,  20,  // Fsus2
+    0x01, 0x80, 0x02, 0x04,  25,  // F#sus2
+    0x00, 0x02, 0x03, 0x00,  29,  // Gsus2
+    0x01, 0x03, 0x04, 0x01,  37,  // G#sus2
+    0x04, 0x04, 0x00, 0x00,  28,  // Asus2
+    0x80, 0x00, 0x01, 0x01,  30,  // A#sus2
+    0x80, 0x01, 0x02, 0x02,  35,  // Bsus2
+    // sus4
+    0x00, 0x00, 0x01, 0x80,  10,  // Csus4
+    0x01, 0x01, 0x02, 0x80,  15,  // C#sus4
+    0x00, 0x02, 0x03, 0x00,   9,  // Dsus4
+    0x01, 0x03, 0x04, 0x01,  17,  // D#sus4
+    0x04, 0x04, 0x00, 0x00,   8,  // Esus4
+    0x03, 0x80, 0x01, 0x03,  20,  // Fsus4
+    0x04, 0x80, 0x02, 0x04,  22,  // F#sus4
+    0x00, 0x02, 0x03, 0x03,  29,  // Gsus4
+    0x01, 0x03, 0x04, 0x04,  37,  // G#sus4
+    0x02, 0x02, 0x00, 0x00,  24,  // Asus4
+    0x03, 0x03, 0x01, 0x01,  32,  // A#sus4
+    0x04, 0x04, 0x02, 0x02,  34,  // Bsus4
+};
+
+static const uint8_t SHAPES_CAVAQUINHO[720] PROGMEM = {
+    // M
+    0x02, 0x00, 0x01, 0x02,  27,  // CM
+    0x03, 0x01, 0x02, 0x03,  32,  // C#M
+    0x00, 0x02, 0x03, 0x04,  14,  // DM
+    0xFF, 0x00, 0x00, 0x00, 0x00,  // D#M
+    0x02, 0x01, 0x00, 0x02,   7,  // EM
+    0x03, 0x02, 0x01, 0x03,  12,  // FM
+    0x04, 0x03, 0x02, 0x04,  14,  // F#M
+    0x80, 0x00, 0x00, 0x00,   8,  // GM
+    0x80, 0x01, 0x01, 0x01,  10,  // G#M
+    0x80, 0x02, 0x02, 0x02,  12,  // AM
+    0x80, 0x03, 0x03, 0x03,  14,  // A#M
+    0x80, 0x04, 0x04, 0x04,  16,  // BM
+    // m
+    0x01, 0x00, 0x01, 0x01,  22,  // Cm
+    0x02, 0x01, 0x02, 0x02,  27,  // C#m
+    0x00, 0x02, 0x03, 0x03,   9,  // Dm
+    0x01, 0x03, 0x04, 0x04,  17,  // D#m
+    0x02, 0x00, 0x00, 0x02,   4,  // Em
+    0x03, 0x01, 0x01, 0x03,  12,  // Fm
+    0x04, 0x02, 0x02, 0x04,  14,  // F#m
+    0xFF, 0x00, 0x00, 0x00, 0x00,  // Gm
+    0x80, 0x01, 0x00, 0x01,  10,  // G#m
+    0x80, 0x02, 0x01, 0x02,  15,  // Am
+    0x80, 0x03, 0x02, 0x03,  17,  // A#m
+    0x80, 0x04, 0x03, 0x04,  19,  // Bm
+    // 7
+    0xFF, 0x00, 0x00, 0x00, 0x00,  // C7
+    0xFF, 0x00, 0x00, 0x00, 0x00,  // C#7
+    0x00, 0x02, 0x01, 0x04,  17,  // D7
+    0xFF, 0x00, 0x00, 0x00, 0x00,  // D#7
+    0x02, 0x01, 0x00, 0x00,   7,  // E7
+    0x03, 0x02, 0x01, 0x01,  12,  // F7
+    0x04, 0x03, 0x02, 0x02,  14,  // F#7
+    0x00, 0x00, 0x00, 0x03,  26,  // G7
+    0x01, 0x01, 0x01, 0x04,  37,  // G#7
+    0xFF, 0x00, 0x00, 0x00, 0x00,  // A7
+    0xFF, 0x00, 0x00, 0x00, 0x00,  // A#7
+    0x01, 0x02, 0x00, 0x04,  37,  // B7
+    // m7
+    0xFF, 0x00, 0x00, 0x00, 0x00,  // Cm7
+    0xFF, 0x00, 0x00, 0x00, 0x00,  // C#m7
+    0x00, 0x02, 0x01, 0x03,  12,  // Dm7
+    0x01, 0x03, 0x02, 0x04,  17,  // D#m7
+    0x02, 0x00, 0x00, 0x00,   4,  // Em7
+    0x03, 0x01, 0x01, 0x01,  12,  // Fm7
+    0x04, 0x02, 0x02, 0x02,  14,  // F#m7
+    0xFF, 0x00, 0x00, 0x00, 0x00,  // Gm7
+    0x01, 0x01, 0x00, 0x04,  37,  // G#m7
+    0xFF, 0x00, 0x00, 0x00, 0x00,  // Am7
+    0xFF, 0x00, 0x00, 0x00, 0x00,  // A#m7
+    0x00, 0x02, 0x00, 0x04,  34,  // Bm7
+    // 7M
+    0xFF, 0x00, 0x00, 0x00, 0x00,  // C7M
+    0xFF, 0x00, 0x00, 0x00, 0x00,  // C#7M
+    0x00, 0x02, 0x02, 0x04,  14,  // D7M
+    0xFF, 0x00, 0x00, 0x00, 0x00,  // D#7M
+    0x02, 0x01, 0x00, 0x01,   7,  // E7M
+    0x03, 0x02, 0x01, 0x02,  12,  // F7M
+    0x04, 0x03, 0x02, 0x03,  14,  // F#7M
+    0x00, 0x00, 0x00, 0x04,  28,  // G7M
+    0xFF, 0x00, 0x00, 0x00, 0x00,  // G#7M
+    0xFF, 0x00, 0x00, 0x00, 0x00,  // A7M
+    0xFF, 0x00, 0x00, 0x00, 0x00,  // A#7M
+    0x01, 0x03, 0x00, 0x04,  37,  // B7M
+    // 6
+    0xFF, 0x00, 0x00, 0x00, 0x00,  // C6
+    0xFF, 0x00, 0x00, 0x00, 0x00,  // C#6
+    0x00, 0x02, 0x00, 0x04,  14,  // D6
+    0xFF, 0x00, 0x00, 0x00, 0x00,  // D#6
+    0xFF, 0x00, 0x00, 0x00, 0x00,  // E6
+    0x03, 0x02, 0x01, 0x00,  12,  // F6
+    0x04, 0x03, 0x02, 0x01,  17,  // F#6
+    0x00, 0x00, 0x00, 0x02,  24,  // G6
+    0x01, 0x01, 0x01, 0x03,  32,  // G#6
+    0x02, 0x02, 0x02, 0x04,  34,  // A6
+    0xFF, 0x00, 0x00, 0x00, 0x00,  // A#6
+    0x01, 0x01, 0x00, 0x04,  37,  // B6
+    // m6
+    0xFF, 0x00, 0x00, 0x00, 0x00,  // Cm6
+    0xFF, 0x00, 0x00, 0x00, 0x00,  // C#m6
+    0x00, 0x02, 0x00, 0x03,   9,  // Dm6
+    0x01, 0x03, 0x01, 0x04,  17,  // D#m6
+    0xFF, 0x00, 0x00, 0x00, 0x00,  // Em6
+    0x03, 0x01, 0x01, 0x00,  12,  // Fm6
+    0x04, 0x02, 0x02, 0x01,  17,  // F#m6
+    0xFF, 0x00, 0x00, 0x00, 0x00,  // Gm6
+    0x01, 0x01, 0x00, 0x03,  32,  // G#m6
+    0x02, 0x02, 0x01, 0x04,  37,  // Am6
+    0xFF, 0x00, 0x00, 0x00, 0x00,  // A#m6
+    0x00, 0x01, 0x00, 0x04,  37,  // Bm6
+    // dim7
+    0x01, 0x02, 0x01, 0x04,  37,  // Cdim7
+    0xFF, 0x00, 0x00, 0x00, 0x00,  // C#dim7
+    0x00, 0x01, 0x00, 0x03,  12,  // Ddim7
+    0x01, 0x02, 0x01, 0x04,  17,  // D#dim7
+    0xFF, 0x00, 0x00, 0x00, 0x00,  // Edim7
+    0x03, 0x01, 0x00, 0x00,  12,  // Fdim7
+    0x04, 0x02, 0x01, 0x01,  17,  // F#dim7
+    0xFF, 0x00, 0x00, 0x00, 0x00,  // Gdim7
+    0x00, 0x01, 0x00, 0x03,  32,  // G#dim7
+    0x01, 0x02, 0x01, 0x04,  37,  // Adim7
+    0xFF, 0x00, 0x00, 0x00, 0x00,  // A#dim7
+    0x00, 0x01, 0x00, 0x03,  32,  // Bdim7
+    // m7(b5)
+    0x01, 0x03, 0x01, 0x04,  37,  // Cm7(b5)
+    0xFF, 0x00, 0x00, 0x00, 0x00,  // C#m7(b5)
+    0x00, 0x01, 0x01, 0x03,  12,  // Dm7(b5)
+    0x01, 0x02, 0x02, 0x04,  17,  // D#m7(b5)
+    0xFF, 0x00, 0x00, 0x00, 0x00,  // Em7(b5)
+    0x03, 0x01, 0x00, 0x01,  12,  // Fm7(b5)
+    0x04, 0x02, 0x01, 0x02,  17,  // F#m7(b5)
+    0xFF, 0x00, 0x00, 0x00, 0x00,  // Gm7(b5)
+    0x00, 0x01, 0x00, 0x04,  37,  // G#m7(b5)
+    0xFF, 0x00, 0x00, 0x00, 0x00,  // Am7(b5)
+    0xFF, 0x00, 0x00, 0x00, 0x00,  // A#m7(b5)
+    0x00, 0x02, 0x00, 0x03,  29,  // Bm7(b5)
+    // aug
+    0x02, 0x01, 0x01, 0x02,  27,  // Caug
+    0x03, 0x02, 0x02, 0x03,  29,  // C#aug
+    0x00, 0x03, 0x03, 0x04,  11,  // Daug
+    0x01, 0x00, 0x00, 0x01,   2,  // D#aug
+    0x02, 0x01, 0x01, 0x02,   7,  // Eaug
+    0x03, 0x02, 0x02, 0x03,   9,  // Faug
+    0x04, 0x03, 0x03, 0x00,  11,  // F#aug
+    0x80, 0x00, 0x00, 0x01,  10,  // Gaug
+    0x80, 0x01, 0x01, 0x02,  15,  // G#aug
+    0x80, 0x02, 0x02, 0x03,  17,  // Aaug
+    0x80, 0x03, 0x03, 0x04,  19,  // A#aug
+    0x01, 0x00, 0x00, 0x01,  22,  // Baug
+    // sus2
+    0x00, 0x00, 0x01, 0x00,  22,  // Csus2
+    0x01, 0x01, 0x02, 0x01,  27,  // C#sus2
+    0x00, 0x02, 0x03, 0x02,   9,  // Dsus2
+    0x01, 0x03, 0x04, 0x03,  17,  // D#sus2
+    0x02, 0x04, 0x00, 0x04,  14,  // Esus2
+    0x03, 0x00, 0x01, 0x03,  12,  // Fsus2
+    0x04, 0x01, 0x02, 0x04,  17,  // F#sus2
+    0xFF, 0x00, 0x00, 0x00, 0x00,  // Gsus2
+    0xFF, 0x00, 0x00, 0x00, 0x00,  // G#sus2
+    0x80, 0x02, 0x00, 0x02,  12,  // Asus2
+    0x80, 0x03, 0x01, 0x03,  20,  // A#sus2
+    0x80, 0x04, 0x02, 0x04,  22,  // Bsus2
+    // sus4
+    0x03, 0x00, 0x01, 0x03,  32,  // Csus4
+    0x04, 0x01, 0x02, 0x04,  37,  // C#sus4
+    0xFF, 0x00, 0x00, 0x00, 0x00,  // Dsus4
+    0xFF, 0x00, 0x00, 0x00, 0x00,  // D#sus4
+    0x02, 0x02, 0x00, 0x02,   4,  // Esus4
+    0x03, 0x03, 0x01, 0x03,  12,  // Fsus4
+    0x04, 0x04, 0x02, 0x04,  14,  // F#sus4
+    0x80, 0x00, 0x01, 0x00,  10,  // Gsus4
+    0x80, 0x01, 0x02, 0x01,  15,  // G#sus4
+    0x80, 0x02, 0x03, 0x02,  17,  // Asus4
+    0x80, 0x03, 0x04, 0x03,  19,  // A#sus4
+    0x02, 0x04, 0x00, 0x04,  34,  // Bsus4
+};
+
+static const uint8_t SHAPES_BANDOLIM[720] PROGMEM = {
+    // M
+    0x00, 0x02, 0x03, 0x00,  29,  // CM
+    0x01, 0x03, 0x04, 0x01,  37,  // C#M
+    0x80, 0x00, 0x00, 0x02,  12,  // DM
+    0x80, 0x01, 0x01, 0x03,  20,  // D#M
+    0x80, 0x02, 0x02, 0x04,  22,  // EM
+    0x02, 0x03, 0x03, 0x01,  32,  // FM
+    0x03, 0x04, 0x04, 0x02,  34,  // F#M
+    0x00, 0x00, 0x02, 0x03,   9,  // GM
+    0x01, 0x01, 0x03, 0x04,  17,  // G#M
+    0x02, 0x02, 0x04, 0x00,  14,  // AM
+    0x03, 0x00, 0x01, 0x01,  12,  // A#M
+    0x04, 0x01, 0x02, 0x02,  17,  // BM
+    // m
+    0x00, 0x01, 0x03, 0x03,  32,  // Cm
+    0x01, 0x02, 0x04, 0x00,  37,  // C#m
+    0x80, 0x00, 0x00, 0x01,  10,  // Dm
+    0x80, 0x01, 0x01, 0x02,  15,  // D#m
+    0x80, 0x02, 0x02, 0x03,  17,  // Em
+    0x80, 0x03, 0x03, 0x04,  19,  // Fm
+    0x02, 0x04, 0x04, 0x02,  34,  // F#m
+    0x00, 0x00, 0x01, 0x80,  10,  // Gm
+    0x01, 0x01, 0x02, 0x80,  15,  // G#m
+    0x02, 0x02, 0x03, 0x00,   9,  // Am
+    0x03, 0x03, 0x04, 0x01,  17,  // A#m
+    0x04, 0x00, 0x02, 0x02,  14,  // Bm
+    // 7
+    0x03, 0x02, 0x03, 0x03,  29,  // C7
+    0x04, 0x03, 0x04, 0x04,  31,  // C#7
+    0x02, 0x00, 0x03, 0x02,  29,  // D7
+    0x03, 0x01, 0x04, 0x03,  37,  // D#7
+    0x01, 0x00, 0x02, 0x00,  27,  // E7
+    0x02, 0x01, 0x03, 0x01,  32,  // F7
+    0x03, 0x04, 0x04, 0x00,  31,  // F#7
+    0x00, 0x00, 0x02, 0x01,   7,  // G7
+    0x01, 0x01, 0x03, 0x02,  12,  // G#7
+    0x02, 0x02, 0x04, 0x03,  14,  // A7
+    0x01, 0x00, 0x01, 0x01,  22,  // A#7
+    0x04, 0x01, 0x00, 0x02,  17,  // B7
+    // m7
+    0x03, 0x01, 0x03, 0x03,  32,  // Cm7
+    0x04, 0x02, 0x04, 0x04,  34,  // C#m7
+    0x02, 0x00, 0x03, 0x01,  32,  // Dm7
+    0x03, 0x01, 0x04, 0x02,  37,  // D#m7
+    0x00, 0x00, 0x02, 0x00,  24,  // Em7
+    0x01, 0x01, 0x03, 0x01,  32,  // Fm7
+    0x02, 0x02, 0x04, 0x02,  34,  // F#m7
+    0x00, 0x00, 0x01, 0x01,   2,  // Gm7
+    0x01, 0x01, 0x02, 0x02,   7,  // G#m7
+    0x02, 0x02, 0x03, 0x03,   9,  // Am7
+    0x03, 0x03, 0x04, 0x04,  11,  // A#m7
+    0x04, 0x00, 0x00, 0x02,  14,  // Bm7
+    // 7M
+    0x04, 0x02, 0x03, 0x03,  34,  // C7M
+    0xFF, 0x00, 0x00, 0x00, 0x00,  // C#7M
+    0x02, 0x00, 0x04, 0x02,  34,  // D7M
+    0xFF, 0x00, 0x00, 0x00, 0x00,  // D#7M
+    0x01, 0x01, 0x02, 0x00,  27,  // E7M
+    0x02, 0x03, 0x03, 0x00,  29,  // F7M
+    0x03, 0x03, 0x04, 0x02,  34,  // F#7M
+    0x00, 0x00, 0x02, 0x02,   4,  // G7M
+    0x01, 0x01, 0x03, 0x03,  12,  // G#7M
+    0x02, 0x02, 0x04, 0x04,  14,  // A7M
+    0x03, 0x00, 0x00, 0x01,  12,  // A#7M
+    0x04, 0x01, 0x01, 0x02,  17,  // B7M
+    // 6
+    0x02, 0x02, 0x03, 0x03,  29,  // C6
+    0x03, 0x03, 0x04, 0x04,  31,  // C#6
+    0x02, 0x00, 0x02, 0x02,  24,  // D6
+    0x03, 0x01, 0x03, 0x03,  32,  // D#6
+    0x04, 0x02, 0x04, 0x04,  34,  // E6
+    0x02, 0x00, 0x03, 0x01,  32,  // F6
+    0x03, 0x01, 0x04, 0x02,  37,  // F#6
+    0x00, 0x00, 0x02, 0x00,   4,  // G6
+    0x01, 0x01, 0x03, 0x01,  12,  // G#6
+    0x02, 0x02, 0x04, 0x02,  14,  // A6
+    0x00, 0x00, 0x01, 0x01,  22,  // A#6
+    0x01, 0x01, 0x02, 0x02,  27,  // B6
+    // m6
+    0x02, 0x01, 0x03, 0x03,  32,  // Cm6
+    0x03, 0x02, 0x04, 0x04,  34,  // C#m6
+    0x02, 0x00, 0x02, 0x01,  27,  // Dm6
+    0x03, 0x01, 0x03, 0x02,  32,  // D#m6
+    0x04, 0x02, 0x04, 0x03,  34,  // Em6
+    0x01, 0x00, 0x03, 0x01,  32,  // Fm6
+    0x02, 0x01, 0x04, 0x02,  37,  // F#m6
+    0x00, 0x00, 0x01, 0x00,   2,  // Gm6
+    0x01, 0x01, 0x02, 0x01,   7,  // G#m6
+    0x02, 0x02, 0x03, 0x02,   9,  // Am6
+    0x03, 0x03, 0x04, 0x03,  11,  // A#m6
+    0x01, 0x00, 0x02, 0x02,  27,  // Bm6
+    // dim7
+    0x02, 0x01, 0x03, 0x02,  32,  // Cdim7
+    0x03, 0x02, 0x04, 0x03,  34,  // C#dim7
+    0x01, 0x00, 0x02, 0x01,  27,  // Ddim7
+    0x02, 0x01, 0x03, 0x02,  32,  // D#dim7
+    0x03, 0x02, 0x04, 0x03,  34,  // Edim7
+    0x01, 0x00, 0x02, 0x01,  27,  // Fdim7
+    0x02, 0x01, 0x03, 0x02,  32,  // F#dim7
+    0x03, 0x02, 0x04, 0x03,  34,  // Gdim7
+    0x01, 0x00, 0x02, 0x01,   7,  // G#dim7
+    0x02, 0x01, 0x03, 0x02,  12,  // Adim7
+    0x03, 0x02, 0x04, 0x03,  14,  // A#dim7
+    0x01, 0x00, 0x02, 0x01,  27,  // Bdim7
+    // m7(b5)
+    0x03, 0x01, 0x03, 0x02,  32,  // Cm7(b5)
+    0x04, 0x02, 0x04, 0x03,  34,  // C#m7(b5)
+    0x01, 0x00, 0x03, 0x01,  32,  // Dm7(b5)
+    0x02, 0x01, 0x04, 0x02,  37,  // D#m7(b5)
+    0x00, 0x00, 0x01, 0x00,  22,  // Em7(b5)
+    0x01, 0x01, 0x02, 0x01,  27,  // Fm7(b5)
+    0x02, 0x02, 0x03, 0x02,  29,  // F#m7(b5)
+    0x03, 0x03, 0x04, 0x03,  31,  // Gm7(b5)
+    0x01, 0x00, 0x02, 0x02,   7,  // G#m7(b5)
+    0x02, 0x01, 0x03, 0x03,  12,  // Am7(b5)
+    0x03, 0x02, 0x04, 0x04,  14,  // A#m7(b5)
+    0x04, 0x00, 0x00, 0x01,  17,  // Bm7(b5)
+    // aug
+    0x01, 0x02, 0x03, 0x00,  32,  // Caug
+    0x02, 0x03, 0x04, 0x01,  37,  // C#aug
+    0x80, 0x00, 0x01, 0x02,  15,  // Daug
+    0x80, 0x01, 0x02, 0x03,  20,  // D#aug
+    0x80, 0x02, 0x03, 0x04,  22,  // Eaug
+    0x02, 0x03, 0x04, 0x01,  37,  // Faug
+    0x03, 0x00, 0x01, 0x02,  32,  // F#aug
+    0x00, 0x01, 0x02, 0x03,  12,  // Gaug
+    0x01, 0x02, 0x03, 0x00,  12,  // G#aug
+    0x02, 0x03, 0x04, 0x01,  17,  // Aaug
+    0x03, 0x00, 0x01, 0x02,  12,  // A#aug
+    0x04, 0x01, 0x02, 0x03,  17,  // Baug
+    // sus2
+    0x00, 0x00, 0x03, 0x03,  26,  // Csus2
+    0x01, 0x01, 0x04, 0x04,  37,  // C#sus2
+    0x80, 0x00, 0x00, 0x00,   8,  // Dsus2
+    0x80, 0x01, 0x01, 0x01,  10,  // D#sus2
+    0x80, 0x02, 0x02, 0x02,  12,  // Esus2
+    0x80, 0x03, 0x03, 0x03,  14,  // Fsus2
+    0x80, 0x04, 0x04, 0x04,  16,  // F#sus2
+    0x00, 0x00, 0x00, 0x03,   6,  // Gsus2
+    0x01, 0x01, 0x01, 0x80,  10,  // G#sus2
+    0x02, 0x02, 0x02, 0x00,   4,  // Asus2
+    0x03, 0x03, 0x03, 0x01,  12,  // A#sus2
+    0x04, 0x04, 0x04, 0x02,  14,  // Bsus2
+    // sus4
+    0x00, 0x03, 0x03, 0x03,  26,  // Csus4
+    0x80, 0x04, 0x04, 0x04,  36,  // C#sus4
+    0x80, 0x00, 0x00, 0x03,  14,  // Dsus4
+    0x80, 0x01, 0x01, 0x04,  25,  // D#sus4
+    0x02, 0x02, 0x02, 0x00,  24,  // Esus4
+    0x03, 0x03, 0x03, 0x01,  32,  // Fsus4
+    0x04, 0x04, 0x04, 0x02,  34,  // F#sus4
+    0x00, 0x00, 0x03, 0x03,   6,  // Gsus4
+    0x01, 0x01, 0x04, 0x04,  17,  // G#sus4
+    0x02, 0x00, 0x00, 0x00,   4,  // Asus4
+    0x03, 0x01, 0x01, 0x01,  12,  // A#sus4
+    0x04, 0x02, 0x02, 0x02,  14,  // Bsus4
+};
+
+struct ShapeTable {
+    const uint8_t* tuning;      // open strings (PROGMEM)
+    const uint8_t* shapes;      // packed shapes (PROGMEM)
+    uint8_t        numStrings;
+};
+
+static const ShapeTable SHAPE_TABLES[] PROGMEM = {
+    { TUNING_VIOLAO, SHAPES_VIOLAO, 6 },
+    { TUNING_DROP_D, SHAPES_DROP_D, 6 },
+    { TUNING_OPEN_G, SHAPES_OPEN_G, 6 },
+    { TUNING_DADGAD, SHAPES_DADGAD, 6 },
+    { TUNING_UKULELE, SHAPES_UKULELE, 4 },
+    { TUNING_CAVAQUINHO, SHAPES_CAVAQUINHO, 4 },
+    { TUNING_BANDOLIM, SHAPES_BANDOLIM, 4 },
+};
+
+static const uint8_t SHAPE_TABLE_COUNT = sizeof(SHAPE_TABLES) / sizeof(SHAPE_TABLES[0]);
+
+} // namespace data
+} // namespace gingoduino
+
+#endif // GINGODUINO_HAS_SHAPE_LIBRARY
+#endif // GINGODUINO_SHAPES_H